@@ -0,0 +1,16 @@
+#include <licd.h>
+
+LicDeviceManager device_manager;
+LicGateway gateway( device_manager, Serial );
+
+void setup( ) {
+	Serial.begin( 1000000 );
+
+	gateway.Subscribe( LICD_ADDRESS_SPACE, LICD_COMMAND_USER, 2, 10 );
+}
+
+void loop( ) {
+	gateway.Update( );
+
+	// REST OF YOUR CODE
+}
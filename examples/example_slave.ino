@@ -14,4 +14,6 @@ void setup( ) {
 
 void loop( ) {
 	// NORMAL ARDUINO LOOP
+
+	device.Update( );
 }
@@ -0,0 +1,749 @@
+/**
+ * @file licd-analyze.cpp
+ * @brief Offline decoder and analyzer of LICD bus captures.
+ *
+ * Reads a bus capture in a single pass, decodes the LICD transactions it holds
+ * and reports, for every device, the request latency distribution, the bus
+ * utilization, the retry storms and the gaps in the traffic.
+ *
+ * ## Inputs
+ * - Capture files of `LicCaptureWriter` (see `licd_capture.h`), recorded by
+ *   `licd-gatewayd --capture`. They are mapped, not loaded.
+ * - I2C analyzer CSV exports of Saleae Logic 2 (`name,type,start_time,...`,
+ *   one row per start, address, data byte and stop) and Logic 1
+ *   (`Time [s],Packet ID,Address,Data,Read/Write,ACK/NAK`, one row per byte).
+ *   Addresses are 7-bit. The file is read line by line.
+ *
+ * ## Decoding
+ * - Writes to the listener address are `UUID` polls, `ASSIGN` and `RETRY`,
+ *   the read that follows a poll is the `LicDeviceHeader` of the device.
+ * - Writes to a device are decoded by command, a read that follows a write to
+ *   the same device is its answer. `BULK_WRITE` chunks are checked against
+ *   their CRC-16.
+ *
+ * ## Report
+ * - Latency: time from the start of a command to the end of its answer.
+ *   Percentiles come from a logarithmic histogram, within 1/8 of the value.
+ * - Utilization: wire time over the span of the capture. A message lasts its
+ *   measured duration, never less than its bits at `--clock`.
+ * - Retry storms: runs of at least `--storm` failed transactions or `RETRY`
+ *   commands to the same address.
+ * - Gaps: idle periods of the bus longer than `--gap`, and the longest silence
+ *   of each device.
+ *
+ * ## Usage
+ * ```
+ * ./licd-analyze [--decode] [--clock HZ] [--gap US] [--storm N] FILE
+ * ```
+ *
+ * `--decode` also prints every decoded transaction, one per line.
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-analyze.cpp -o licd-analyze
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#define MESSAGE_SIZE 64
+#define BUCKET_STEPS 8
+#define BUCKET_COUNT ( 40 * BUCKET_STEPS )
+#define GAP_COUNT 10
+#define STORM_COUNT 20
+#define DEFAULT_GAP 100000
+#define DEFAULT_STORM 3
+
+/**
+ * @brief One I2C message, from a start to the next start or stop.
+ *
+ * A covered message shares the duration of the message it follows, its wire
+ * time is already accounted.
+ **/
+struct Message {
+
+	uint64_t timestamp = 0;
+	uint32_t duration = 0;
+	uint8_t address = 0;
+	uint8_t status = 0;
+	bool is_read = false;
+	bool is_repeated = false;
+	bool is_covered = false;
+	uint16_t size = 0;
+	uint8_t data[ MESSAGE_SIZE ];
+
+};
+
+/**
+ * @brief Logarithmic histogram, `BUCKET_STEPS` buckets per power of two.
+ **/
+struct Histogram {
+
+	uint64_t buckets[ BUCKET_COUNT ] = { };
+	uint64_t count = 0;
+	uint64_t sum = 0;
+	uint64_t min = UINT64_MAX;
+	uint64_t max = 0;
+
+	static uint32_t index( const uint64_t value ) {
+		if ( value < BUCKET_STEPS )
+			return (uint32_t)value;
+
+		const uint32_t power = 63 - (uint32_t)__builtin_clzll( value );
+		const uint32_t step = (uint32_t)( value >> ( power - 3 ) ) & ( BUCKET_STEPS - 1 );
+		const uint32_t bucket = ( power - 2 ) * BUCKET_STEPS + step;
+
+		return ( bucket < BUCKET_COUNT ) ? bucket : BUCKET_COUNT - 1;
+	}
+
+	static uint64_t upper( const uint32_t bucket ) {
+		if ( bucket < BUCKET_STEPS )
+			return bucket;
+
+		const uint32_t power = bucket / BUCKET_STEPS + 2;
+		const uint64_t step = bucket % BUCKET_STEPS;
+
+		return ( ( BUCKET_STEPS + step + 1 ) << ( power - 3 ) ) - 1;
+	}
+
+	void add( const uint64_t value ) {
+		buckets[ index( value ) ] += 1;
+		count += 1;
+		sum += value;
+		min = ( value < min ) ? value : min;
+		max = ( value > max ) ? value : max;
+	}
+
+	uint64_t percentile( const double ratio ) const {
+		const uint64_t rank = (uint64_t)ceil( ratio * count );
+		uint64_t seen = 0;
+
+		for ( uint32_t bucket = 0; bucket < BUCKET_COUNT; bucket++ ) {
+			seen += buckets[ bucket ];
+
+			if ( seen >= rank && seen > 0 )
+				return ( upper( bucket ) < max ) ? upper( bucket ) : max;
+		}
+
+		return max;
+	}
+
+};
+
+/**
+ * @brief Statistics and decoder state of one address.
+ **/
+struct Device {
+
+	uint64_t messages = 0;
+	uint64_t failures = 0;
+	uint64_t bytes = 0;
+	uint64_t samples = 0;
+	uint64_t wire_time = 0;
+	uint64_t first = 0;
+	uint64_t last = 0;
+	uint64_t max_gap = 0;
+	uint64_t max_gap_time = 0;
+	uint32_t uuid = 0;
+	bool is_seen = false;
+	bool is_assigned = false;
+	Histogram latency;
+
+	bool is_waiting = false;
+	uint8_t command = 0;
+	uint64_t command_time = 0;
+
+	uint32_t storm_count = 0;
+	uint64_t storm_start = 0;
+	uint64_t storm_end = 0;
+
+};
+
+/**
+ * @brief Run of failed or retried transactions.
+ **/
+struct Storm {
+
+	uint8_t address;
+	uint32_t count;
+	uint64_t start;
+	uint64_t end;
+
+};
+
+/**
+ * @brief Idle period of the bus.
+ **/
+struct Gap {
+
+	uint64_t start;
+	uint64_t duration;
+
+};
+
+static bool is_decoding = false;
+static uint32_t bus_clock = LICD_DEFAULT_CLOCK;
+static uint64_t gap_threshold = DEFAULT_GAP;
+static uint32_t storm_threshold = DEFAULT_STORM;
+
+static Device devices[ LICD_CAPTURE_ADDRESS_COUNT ];
+static uint64_t first_time = UINT64_MAX;
+static uint64_t last_end = 0;
+static uint64_t wire_time = 0;
+static uint64_t message_count = 0;
+static uint64_t bad_crc_count = 0;
+static uint64_t retry_count = 0;
+static uint64_t poll_count = 0;
+static uint64_t gap_count = 0;
+static uint64_t storm_count = 0;
+static std::vector<Gap> gaps;
+static std::vector<Storm> storms;
+static uint32_t pending_uuid = 0;
+
+static const char* command_name( const uint8_t command ) {
+	switch ( command ) {
+		case LICD_COMMAND_UUID : return "UUID";
+		case LICD_COMMAND_ASSIGN : return "ASSIGN";
+		case LICD_COMMAND_RETRY : return "RETRY";
+		case LICD_COMMAND_AGGREGATE : return "AGGREGATE";
+		case LICD_COMMAND_REGISTER : return "REGISTER";
+		case LICD_COMMAND_STREAM : return "STREAM";
+		case LICD_COMMAND_CREDIT : return "CREDIT";
+		case LICD_COMMAND_BULK_WRITE : return "BULK_WRITE";
+		case LICD_COMMAND_BULK_STATUS : return "BULK_STATUS";
+		case LICD_COMMAND_BULK_READ : return "BULK_READ";
+		case LICD_COMMAND_FIRMWARE : return "FIRMWARE";
+		default : break;
+	}
+
+	return ( command >= LICD_COMMAND_USER ) ? "USER" : "?";
+}
+
+static uint32_t read_u32( const uint8_t* data ) {
+	return (uint32_t)data[ 0 ] | ( (uint32_t)data[ 1 ] << 8 ) | ( (uint32_t)data[ 2 ] << 16 ) | ( (uint32_t)data[ 3 ] << 24 );
+}
+
+/**
+ * @brief Closes the retry run of a device, kept as a storm when long enough.
+ **/
+static void end_storm( const uint8_t address ) {
+	Device& device = devices[ address ];
+
+	if ( device.storm_count >= storm_threshold ) {
+		storm_count += 1;
+
+		if ( storms.size( ) < STORM_COUNT )
+			storms.push_back( { address, device.storm_count, device.storm_start, device.storm_end } );
+	}
+
+	device.storm_count = 0;
+}
+
+/**
+ * @brief Keeps the longest idle periods of the bus.
+ **/
+static void add_gap( const uint64_t start, const uint64_t duration ) {
+	gap_count += 1;
+
+	if ( gaps.size( ) < GAP_COUNT ) {
+		gaps.push_back( { start, duration } );
+
+		return;
+	}
+
+	size_t shortest = 0;
+
+	for ( size_t gap_id = 1; gap_id < gaps.size( ); gap_id++ ) {
+		if ( gaps[ gap_id ].duration < gaps[ shortest ].duration )
+			shortest = gap_id;
+	}
+
+	if ( gaps[ shortest ].duration < duration )
+		gaps[ shortest ] = { start, duration };
+}
+
+/**
+ * @brief Prints a decoded message.
+ **/
+static void print_message( const Message& message, const char* text ) {
+	printf(
+		"%14.6f %c 0x%02X%c %-5s %s",
+		message.timestamp / 1e6,
+		message.is_read ? 'R' : 'W',
+		message.address,
+		message.is_repeated ? '+' : ' ',
+		( message.status == 0 ) ? "ACK" : "NAK",
+		text
+	);
+
+	for ( uint16_t byte_id = 0; byte_id < message.size && byte_id < MESSAGE_SIZE; byte_id++ )
+		printf( " %02X", message.data[ byte_id ] );
+
+	printf( "\n" );
+}
+
+/**
+ * @brief Decodes a message and accounts it in the statistics.
+ **/
+static void analyze( const Message& message ) {
+	const uint8_t address = message.address % LICD_CAPTURE_ADDRESS_COUNT;
+	const uint64_t bits_time = LicSimBus::wireTime( message.size, bus_clock ) / 1000;
+	const uint64_t duration = ( message.duration > bits_time ) ? message.duration : bits_time;
+	const uint64_t end = message.timestamp + duration;
+	const bool is_idle = address == LICD_LISTENER_ADDRESS && !message.is_read && message.size > 0 && message.data[ 0 ] == LICD_COMMAND_UUID && message.status == 2;
+	const bool is_failed = message.status != 0 && !is_idle;
+	Device& device = devices[ address ];
+	char text[ 96 ] = "";
+
+	message_count += 1;
+
+	if ( message.timestamp < first_time )
+		first_time = message.timestamp;
+
+	if ( last_end > 0 && message.timestamp > last_end && message.timestamp - last_end > gap_threshold )
+		add_gap( last_end, message.timestamp - last_end );
+
+	if ( !message.is_covered )
+		wire_time += duration;
+
+	last_end = ( end > last_end ) ? end : last_end;
+
+	if ( device.is_seen && message.timestamp - device.last > device.max_gap ) {
+		device.max_gap = message.timestamp - device.last;
+		device.max_gap_time = device.last;
+	}
+
+	if ( !device.is_seen )
+		device.first = message.timestamp;
+
+	device.is_seen = true;
+	device.last = message.timestamp;
+	device.messages += 1;
+	device.bytes += message.size;
+	device.failures += is_failed ? 1 : 0;
+
+	if ( !message.is_covered )
+		device.wire_time += duration;
+
+	bool is_retry = is_failed;
+
+	if ( !message.is_read && message.size > 0 ) {
+		const uint8_t command = message.data[ 0 ];
+
+		if ( address == LICD_LISTENER_ADDRESS ) {
+			if ( command == LICD_COMMAND_UUID ) {
+				poll_count += 1;
+
+				snprintf( text, sizeof( text ), is_idle ? "UUID poll, no device" : "UUID poll" );
+			} else if ( command == LICD_COMMAND_ASSIGN && message.size > 1 ) {
+				const uint8_t assigned = message.data[ 1 ] % LICD_CAPTURE_ADDRESS_COUNT;
+
+				devices[ assigned ].uuid = pending_uuid;
+				devices[ assigned ].is_assigned = true;
+
+				snprintf( text, sizeof( text ), "ASSIGN 0x%02X to uuid 0x%08X", assigned, pending_uuid );
+			} else if ( command == LICD_COMMAND_RETRY ) {
+				retry_count += 1;
+				is_retry = true;
+
+				snprintf( text, sizeof( text ), "RETRY, no free address" );
+			} else
+				snprintf( text, sizeof( text ), "%s", command_name( command ) );
+		} else {
+			int length = snprintf( text, sizeof( text ), "%s", command_name( command ) );
+
+			if ( command == LICD_COMMAND_REGISTER && message.size > 1 )
+				snprintf( text + length, sizeof( text ) - length, " offset %u", message.data[ 1 ] );
+			else if ( ( command == LICD_COMMAND_BULK_WRITE || command == LICD_COMMAND_BULK_READ ) && message.size >= 6 )
+				snprintf( text + length, sizeof( text ) - length, " object %u offset %u", message.data[ 1 ], read_u32( message.data + 2 ) );
+
+			if ( command == LICD_COMMAND_BULK_WRITE && message.size >= 8 && message.size <= MESSAGE_SIZE ) {
+				const uint16_t crc = (uint16_t)( message.data[ 6 ] | ( message.data[ 7 ] << 8 ) );
+
+				if ( LicCRC::crc16( message.data + 8, message.size - 8 ) != crc ) {
+					bad_crc_count += 1;
+
+					snprintf( text + strlen( text ), sizeof( text ) - strlen( text ), " bad CRC" );
+				}
+			}
+		}
+
+		device.is_waiting = message.status == 0;
+		device.command = command;
+		device.command_time = message.timestamp;
+	} else if ( message.is_read ) {
+		if ( device.is_waiting && message.status == 0 ) {
+			device.latency.add( end - device.command_time );
+
+			snprintf( text, sizeof( text ), "answer to %s, %llu us", command_name( device.command ), (unsigned long long)( end - device.command_time ) );
+		}
+
+		if ( address == LICD_LISTENER_ADDRESS && message.size >= sizeof( LicDeviceHeader ) && message.status == 0 ) {
+			pending_uuid = read_u32( message.data );
+
+			snprintf( text, sizeof( text ), "header uuid 0x%08X flags 0x%08X", pending_uuid, read_u32( message.data + 4 ) );
+		}
+
+		device.is_waiting = false;
+	}
+
+	if ( is_retry ) {
+		if ( device.storm_count++ == 0 )
+			device.storm_start = message.timestamp;
+
+		device.storm_end = end;
+	} else if ( message.status == 0 && device.storm_count > 0 )
+		end_storm( address );
+
+	if ( text[ 0 ] == '\0' && message.status == 2 )
+		snprintf( text, sizeof( text ), "no device" );
+
+	if ( is_decoding )
+		print_message( message, text );
+}
+
+/**
+ * @brief Reads a capture file of `LicCaptureWriter`.
+ **/
+static bool read_capture( const char* path ) {
+	LicCaptureReader reader;
+
+	if ( !reader.Open( path ) )
+		return false;
+
+	LicCaptureCursor cursor = reader.Find( );
+	const LicCaptureRecord* record = nullptr;
+	const uint8_t* payload = nullptr;
+
+	while ( reader.Next( cursor, record, payload ) ) {
+		if ( record->kind == LICD_CAPTURE_SAMPLE ) {
+			devices[ record->address % LICD_CAPTURE_ADDRESS_COUNT ].samples += 1;
+
+			continue;
+		}
+
+		Message message;
+
+		message.timestamp = record->timestamp;
+		message.duration = record->duration;
+		message.address = record->address;
+		message.status = record->status;
+		message.is_read = record->kind == LICD_CAPTURE_READ;
+		message.is_repeated = ( record->flags & LICD_CAPTURE_REPEATED ) != 0;
+		message.is_covered = message.is_repeated;
+		message.size = record->size;
+
+		memcpy( message.data, payload, ( record->size < MESSAGE_SIZE ) ? record->size : MESSAGE_SIZE );
+
+		analyze( message );
+	}
+
+	return true;
+}
+
+/**
+ * @brief Splits a CSV line, quotes removed.
+ **/
+static void split_csv( const char* line, std::vector<std::string>& fields ) {
+	std::string field;
+	bool is_quoted = false;
+
+	fields.clear( );
+
+	for ( const char* character = line; *character != '\0' && *character != '\n' && *character != '\r'; character++ ) {
+		if ( *character == '"' )
+			is_quoted = !is_quoted;
+		else if ( *character == ',' && !is_quoted ) {
+			fields.push_back( field );
+			field.clear( );
+		} else
+			field += *character;
+	}
+
+	fields.push_back( field );
+}
+
+/**
+ * @brief Finds a CSV column by a prefix of its name, case insensitive.
+ **/
+static int find_column( const std::vector<std::string>& header, const char* name ) {
+	for ( size_t column = 0; column < header.size( ); column++ ) {
+		std::string lower = header[ column ];
+
+		for ( char& character : lower )
+			character = (char)tolower( character );
+
+		if ( lower.compare( 0, strlen( name ), name ) == 0 )
+			return (int)column;
+	}
+
+	return -1;
+}
+
+static const std::string& get_field( const std::vector<std::string>& fields, const int column ) {
+	static const std::string empty;
+
+	return ( column >= 0 && (size_t)column < fields.size( ) ) ? fields[ column ] : empty;
+}
+
+static uint64_t parse_time( const std::string& field ) {
+	return (uint64_t)llround( strtod( field.c_str( ), nullptr ) * 1e6 );
+}
+
+/**
+ * @brief Appends a byte to a message, bytes over `MESSAGE_SIZE` are only counted.
+ **/
+static void push_byte( Message& message, const std::string& field ) {
+	if ( message.size < MESSAGE_SIZE )
+		message.data[ message.size ] = (uint8_t)strtoul( field.c_str( ), nullptr, 0 );
+
+	message.size += 1;
+}
+
+/**
+ * @brief Reads a Saleae Logic 2 I2C export, one row per bus event.
+ **/
+static void read_logic2( FILE* file, const std::vector<std::string>& header ) {
+	const int type_column = find_column( header, "type" );
+	const int time_column = find_column( header, "start_time" );
+	const int duration_column = find_column( header, "duration" );
+	const int ack_column = find_column( header, "ack" );
+	const int address_column = find_column( header, "address" );
+	const int read_column = find_column( header, "read" );
+	const int data_column = find_column( header, "data" );
+
+	std::vector<std::string> fields;
+	Message message;
+	bool is_open = false;
+	char line[ 512 ];
+
+	while ( fgets( line, sizeof( line ), file ) != nullptr ) {
+		split_csv( line, fields );
+
+		const std::string& type = get_field( fields, type_column );
+		const uint64_t time = parse_time( get_field( fields, time_column ) );
+		const uint64_t end = time + parse_time( get_field( fields, duration_column ) );
+		const bool is_ack = get_field( fields, ack_column ) == "true";
+
+		if ( type == "start" ) {
+			const bool is_repeated = is_open;
+
+			if ( is_open )
+				analyze( message );
+
+			message = Message( );
+			message.timestamp = time;
+			message.is_repeated = is_repeated;
+			is_open = true;
+		} else if ( !is_open )
+			continue;
+		else if ( type == "address" ) {
+			message.address = (uint8_t)strtoul( get_field( fields, address_column ).c_str( ), nullptr, 0 );
+			message.is_read = get_field( fields, read_column ) == "true";
+			message.status = is_ack ? 0 : 2;
+		} else if ( type == "data" ) {
+			push_byte( message, get_field( fields, data_column ) );
+
+			if ( !is_ack && !message.is_read && message.status == 0 )
+				message.status = 3;
+		} else if ( type == "stop" ) {
+			message.duration = (uint32_t)( end - message.timestamp );
+			is_open = false;
+
+			analyze( message );
+		}
+
+		if ( is_open )
+			message.duration = (uint32_t)( end - message.timestamp );
+	}
+
+	if ( is_open )
+		analyze( message );
+}
+
+/**
+ * @brief Reads a Saleae Logic 1 I2C export, one row per data byte.
+ **/
+static void read_logic1( FILE* file, const std::vector<std::string>& header ) {
+	const int time_column = find_column( header, "time" );
+	const int packet_column = find_column( header, "packet" );
+	const int address_column = find_column( header, "address" );
+	const int data_column = find_column( header, "data" );
+	const int direction_column = find_column( header, "read" );
+	const int ack_column = find_column( header, "ack" );
+	const uint64_t byte_time = LicSimBus::wireTime( 0, bus_clock ) / 1000;
+
+	std::vector<std::string> fields;
+	std::string packet;
+	Message message;
+	bool is_open = false;
+	char line[ 512 ];
+
+	while ( fgets( line, sizeof( line ), file ) != nullptr ) {
+		split_csv( line, fields );
+
+		const uint64_t time = parse_time( get_field( fields, time_column ) );
+		const std::string& data = get_field( fields, data_column );
+		const bool is_ack = get_field( fields, ack_column ).compare( 0, 3, "ACK" ) == 0;
+
+		if ( !is_open || get_field( fields, packet_column ) != packet ) {
+			if ( is_open )
+				analyze( message );
+
+			message = Message( );
+			message.timestamp = time;
+			message.address = (uint8_t)strtoul( get_field( fields, address_column ).c_str( ), nullptr, 0 );
+			message.is_read = get_field( fields, direction_column ).compare( 0, 4, "Read" ) == 0;
+			packet = get_field( fields, packet_column );
+			is_open = true;
+		}
+
+		if ( !data.empty( ) )
+			push_byte( message, data );
+
+		if ( !is_ack && !message.is_read && message.status == 0 )
+			message.status = data.empty( ) ? 2 : 3;
+
+		message.duration = (uint32_t)( time - message.timestamp + byte_time );
+	}
+
+	if ( is_open )
+		analyze( message );
+}
+
+/**
+ * @brief Reads an I2C analyzer CSV export.
+ **/
+static bool read_csv( const char* path ) {
+	FILE* file = fopen( path, "r" );
+	std::vector<std::string> header;
+	char line[ 512 ];
+
+	if ( file == nullptr || fgets( line, sizeof( line ), file ) == nullptr ) {
+		if ( file != nullptr )
+			fclose( file );
+
+		return false;
+	}
+
+	split_csv( line, header );
+
+	const bool is_logic2 = find_column( header, "start_time" ) >= 0;
+	const bool is_logic1 = find_column( header, "packet" ) >= 0;
+
+	if ( is_logic2 )
+		read_logic2( file, header );
+	else if ( is_logic1 )
+		read_logic1( file, header );
+
+	fclose( file );
+
+	return is_logic1 || is_logic2;
+}
+
+static void print_report( ) {
+	if ( message_count == 0 ) {
+		printf( "no transaction\n" );
+
+		return;
+	}
+
+	const uint64_t span = ( last_end > first_time ) ? last_end - first_time : 1;
+
+	printf( "span          %.6f s\n", span / 1e6 );
+	printf( "messages      %llu\n", (unsigned long long)message_count );
+	printf( "utilization   %.2f %% (%llu us on the wire)\n", 100.0 * wire_time / span, (unsigned long long)wire_time );
+	printf( "uuid polls    %llu\n", (unsigned long long)poll_count );
+	printf( "retries       %llu\n", (unsigned long long)retry_count );
+	printf( "bad crc       %llu\n", (unsigned long long)bad_crc_count );
+
+	printf( "\n%-4s %-10s %9s %7s %8s %6s %8s %8s %8s %8s %8s %10s\n",
+		"addr", "uuid", "messages", "failed", "samples", "busy%", "lat.n", "p50 us", "p90 us", "p99 us", "max us", "max gap us" );
+
+	for ( uint32_t address = 0; address < LICD_CAPTURE_ADDRESS_COUNT; address++ ) {
+		const Device& device = devices[ address ];
+
+		if ( !device.is_seen && device.samples == 0 )
+			continue;
+
+		char uuid[ 16 ] = "-";
+
+		if ( device.is_assigned )
+			snprintf( uuid, sizeof( uuid ), "0x%08X", device.uuid );
+
+		printf(
+			"0x%02X %-10s %9llu %7llu %8llu %6.2f %8llu %8llu %8llu %8llu %8llu %10llu\n",
+			address,
+			uuid,
+			(unsigned long long)device.messages,
+			(unsigned long long)device.failures,
+			(unsigned long long)device.samples,
+			100.0 * device.wire_time / span,
+			(unsigned long long)device.latency.count,
+			(unsigned long long)device.latency.percentile( 0.5 ),
+			(unsigned long long)device.latency.percentile( 0.9 ),
+			(unsigned long long)device.latency.percentile( 0.99 ),
+			(unsigned long long)device.latency.max,
+			(unsigned long long)device.max_gap
+		);
+	}
+
+	printf( "\nretry storms  %llu (runs of %u or more)\n", (unsigned long long)storm_count, storm_threshold );
+
+	for ( const Storm& storm : storms )
+		printf( "  0x%02X %6u at %.6f s for %llu us\n", storm.address, storm.count, storm.start / 1e6, (unsigned long long)( storm.end - storm.start ) );
+
+	printf( "\nbus gaps      %llu (over %llu us)\n", (unsigned long long)gap_count, (unsigned long long)gap_threshold );
+
+	for ( const Gap& gap : gaps )
+		printf( "  at %.6f s for %llu us\n", gap.start / 1e6, (unsigned long long)gap.duration );
+}
+
+int main( int argc, char** argv ) {
+	const char* path = nullptr;
+
+	for ( int arg_id = 1; arg_id < argc; arg_id++ ) {
+		const std::string argument = argv[ arg_id ];
+
+		if ( argument == "--decode" )
+			is_decoding = true;
+		else if ( argument == "--clock" && arg_id + 1 < argc )
+			bus_clock = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+		else if ( argument == "--gap" && arg_id + 1 < argc )
+			gap_threshold = strtoull( argv[ ++arg_id ], nullptr, 0 );
+		else if ( argument == "--storm" && arg_id + 1 < argc )
+			storm_threshold = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+		else
+			path = argv[ arg_id ];
+	}
+
+	if ( path == nullptr || bus_clock == 0 ) {
+		fprintf( stderr, "usage: %s [--decode] [--clock HZ] [--gap US] [--storm N] FILE\n", argv[ 0 ] );
+
+		return 1;
+	}
+
+	if ( !read_capture( path ) && !read_csv( path ) ) {
+		fprintf( stderr, "unable to read %s, neither a capture nor an I2C CSV export\n", path );
+
+		return 1;
+	}
+
+	for ( uint32_t address = 0; address < LICD_CAPTURE_ADDRESS_COUNT; address++ )
+		end_storm( (uint8_t)address );
+
+	print_report( );
+
+	return 0;
+}
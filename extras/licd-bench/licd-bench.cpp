@@ -0,0 +1,253 @@
+/**
+ * @file licd-bench.cpp
+ * @brief Throughput micro-benchmarks of the `WireHelper` templates.
+ *
+ * Runs `WireHelper::write<T>`, `WireHelper::read<T>` and `WireHelper::wait<T>`
+ * against one device of the simulated bus, for several payload types and
+ * sizes, and compares the host time they take with the time the same
+ * transactions take on the wire at 100, 400 and 1000 kHz.
+ *
+ * ## Columns
+ * - `helper`: time spent in the helper itself, marshalling bytes to or from
+ *   the transport (in nanoseconds per call, then per byte).
+ * - `transfer`: time of the transaction through `LicI2cDevTransport` and the
+ *   simulated bus, standing for the driver call.
+ * - `wire`: modeled wire time of the transaction at each clock.
+ * - `host/wire`: host time over wire time at 400 kHz, below 1 the bus is the
+ *   bottleneck, above 1 the marshalling is.
+ * - `payload`: share of the wire time carrying payload bits, the rest is the
+ *   address byte, start and stop.
+ *
+ * The time of reading the clock itself is measured first and removed from the
+ * host times.
+ *
+ * ## Usage
+ * ```
+ * ./licd-bench [--iterations N]
+ * ```
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-bench.cpp -o licd-bench
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_ADDRESS LICD_ADDRESS_SPACE
+#define BENCH_TIMEOUT 100
+
+static const uint32_t clocks[ ] = { 100000, 400000, 1000000 };
+
+static uint32_t iterations = 100000;
+static uint64_t timer_overhead = 0;
+
+/**
+ * @brief Gets the monotonic time.
+ *
+ * @return The time (in nanoseconds).
+ **/
+static uint64_t now_ns( ) {
+	struct timespec now;
+
+	clock_gettime( CLOCK_MONOTONIC, &now );
+
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Measures the time of one `now_ns` call, removed from every measure.
+ **/
+static void calibrate( ) {
+	uint64_t total = 0;
+
+	for ( uint32_t iteration = 0; iteration < iterations; iteration++ ) {
+		const uint64_t start = now_ns( );
+
+		total += now_ns( ) - start;
+	}
+
+	timer_overhead = total / iterations;
+}
+
+/**
+ * @brief Prints one benchmark line.
+ *
+ * @param operation Benchmarked helper.
+ * @param type Name of the payload type.
+ * @param count Number of elements per call.
+ * @param size Number of payload bytes per call.
+ * @param helper_time Total time spent in the helper (in nanoseconds).
+ * @param transfer_time Total time spent in the transactions (in nanoseconds).
+ **/
+static void print_line(
+	const char* operation,
+	const char* type,
+	const uint32_t count,
+	const uint32_t size,
+	const uint64_t helper_time,
+	const uint64_t transfer_time
+) {
+	const double helper = ( helper_time > timer_overhead * iterations ) ? (double)helper_time / iterations - timer_overhead : 0.0;
+	const double transfer = ( transfer_time > timer_overhead * iterations ) ? (double)transfer_time / iterations - timer_overhead : 0.0;
+	const double payload = 100.0 * 9 * size / ( 9 * ( size + 1 ) + 2 );
+
+	printf( "%-6s %-9s %5u %5u %9.1f %8.2f %9.1f", operation, type, count, size, helper, helper / size, transfer );
+
+	for ( const uint32_t clock : clocks )
+		printf( " %8.1f", LicSimBus::wireTime( size, clock ) / 1000.0 );
+
+	printf( " %9.3f %7.1f%%\n", ( helper + transfer ) / LicSimBus::wireTime( size, 400000 ), payload );
+}
+
+/**
+ * @brief Benchmarks `WireHelper::write<T>` for one element count.
+ **/
+template<typename T>
+static void bench_write( const char* type, const uint32_t count ) {
+	T data[ LICD_FRAME_SIZE / sizeof( T ) ];
+	uint64_t helper_time = 0;
+	uint64_t transfer_time = 0;
+
+	memset( data, 0x5A, sizeof( data ) );
+
+	for ( uint32_t iteration = 0; iteration < iterations; iteration++ ) {
+		LicTransport::beginTransmission( BENCH_ADDRESS );
+
+		const uint64_t start = now_ns( );
+
+		WireHelper::write( data, count );
+
+		const uint64_t middle = now_ns( );
+
+		LicTransport::endTransmission( true );
+
+		const uint64_t end = now_ns( );
+
+		helper_time += middle - start;
+		transfer_time += end - middle;
+	}
+
+	print_line( "write", type, count, sizeof( T ) * count, helper_time, transfer_time );
+}
+
+/**
+ * @brief Benchmarks `WireHelper::read<T>` for one element count.
+ **/
+template<typename T>
+static void bench_read( const char* type, const uint32_t count ) {
+	T data[ LICD_FRAME_SIZE / sizeof( T ) ];
+	uint64_t helper_time = 0;
+	uint64_t transfer_time = 0;
+	uint32_t failures = 0;
+
+	for ( uint32_t iteration = 0; iteration < iterations; iteration++ ) {
+		const uint64_t start = now_ns( );
+
+		LicTransport::requestFrom( BENCH_ADDRESS, (uint8_t)( sizeof( T ) * count ) );
+
+		const uint64_t middle = now_ns( );
+
+		failures += WireHelper::read( data, count, BENCH_TIMEOUT ) ? 0 : 1;
+
+		const uint64_t end = now_ns( );
+
+		transfer_time += middle - start;
+		helper_time += end - middle;
+	}
+
+	print_line( "read", type, count, sizeof( T ) * count, helper_time, transfer_time );
+
+	if ( failures > 0 )
+		printf( "       %u failed reads\n", failures );
+}
+
+/**
+ * @brief Benchmarks `WireHelper::wait<T>` on an answer already received.
+ **/
+template<typename T>
+static void bench_wait( const char* type ) {
+	uint64_t helper_time = 0;
+	uint64_t transfer_time = 0;
+
+	for ( uint32_t iteration = 0; iteration < iterations; iteration++ ) {
+		const uint64_t start = now_ns( );
+
+		LicTransport::requestFrom( BENCH_ADDRESS, sizeof( T ) );
+
+		const uint64_t middle = now_ns( );
+
+		WireHelper::wait<T>( BENCH_TIMEOUT );
+
+		const uint64_t end = now_ns( );
+
+		transfer_time += middle - start;
+		helper_time += end - middle;
+	}
+
+	print_line( "wait", type, 1, sizeof( T ), helper_time, transfer_time );
+}
+
+/**
+ * @brief Benchmarks every helper for one payload type, from one element up to a frame.
+ **/
+template<typename T>
+static void bench_type( const char* type ) {
+	for ( uint32_t count = 1; sizeof( T ) * count <= LICD_FRAME_SIZE; count *= 2 )
+		bench_write<T>( type, count );
+
+	for ( uint32_t count = 1; sizeof( T ) * count <= LICD_FRAME_SIZE; count *= 2 )
+		bench_read<T>( type, count );
+
+	bench_wait<T>( type );
+}
+
+int main( int argc, char** argv ) {
+	if ( argc == 3 && strcmp( argv[ 1 ], "--iterations" ) == 0 )
+		iterations = (uint32_t)strtoul( argv[ 2 ], nullptr, 0 );
+	else if ( argc != 1 ) {
+		fprintf( stderr, "usage: %s [--iterations N]\n", argv[ 0 ] );
+
+		return 1;
+	}
+
+	if ( iterations == 0 )
+		iterations = 1;
+
+	const uint8_t assign[ 2 ] = { LICD_COMMAND_ASSIGN, BENCH_ADDRESS };
+	LicSimDevice device( 0xBE0C0001 );
+
+	device.Receive( assign, sizeof( assign ) );
+
+	LicSimBus::attach( &device );
+	LicSimBus::install( );
+
+	calibrate( );
+
+	printf( "%u iterations per line, times in ns except wire times in us", iterations );
+	printf( ", %llu ns of timer overhead removed\n\n", (unsigned long long)timer_overhead );
+	printf(
+		"%-6s %-9s %5s %5s %9s %8s %9s %8s %8s %8s %9s %8s\n",
+		"op", "type", "count", "bytes", "helper", "ns/byte", "transfer", "@100k", "@400k", "@1M", "host/wire", "payload"
+	);
+
+	bench_type<uint8_t>( "uint8_t" );
+	bench_type<uint16_t>( "uint16_t" );
+	bench_type<uint32_t>( "uint32_t" );
+	bench_type<float>( "float" );
+	bench_type<uint64_t>( "uint64_t" );
+	bench_type<double>( "double" );
+
+	const LicSimStats& stats = LicSimBus::getStats( );
+
+	printf( "\n%u transactions, %llu bytes, %u NACKs\n", stats.transactions, (unsigned long long)stats.bytes, stats.nacks );
+
+	return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file licd-capture.cpp
+ * @brief Command line inspector of LICD capture files.
+ *
+ * Maps a capture file written by `LicCaptureWriter` (see `licd_capture.h`) and
+ * prints its index or its records, one per line.
+ *
+ * ## Usage
+ * ```
+ * ./licd-capture info FILE
+ * ./licd-capture dump FILE [ADDRESS [FROM [TO]]]
+ * ```
+ *
+ * `info` prints the segments and the time range of every device, `dump` prints
+ * the records of a device (`any` for all) between two times (in microseconds).
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-capture.cpp -o licd-capture
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <stdlib.h>
+
+static int run_info( const LicCaptureReader& reader ) {
+	uint32_t sealed_count = 0;
+
+	for ( uint32_t segment_id = 0; segment_id < reader.GetSegmentCount( ); segment_id++ ) {
+		const LicCaptureSegment* segment = reader.GetSegment( segment_id );
+
+		if ( segment != nullptr && segment->is_sealed )
+			sealed_count += 1;
+	}
+
+	printf( "%u segments, %u sealed\n", reader.GetSegmentCount( ), sealed_count );
+
+	LicCaptureRange range;
+
+	if ( reader.GetRange( LICD_CAPTURE_ANY, range ) )
+		printf( "any  %10u records %12llu - %12llu us\n", range.count, (unsigned long long)range.first, (unsigned long long)range.last );
+
+	for ( uint32_t address = 0; address < LICD_CAPTURE_ADDRESS_COUNT; address++ ) {
+		if ( reader.GetRange( (uint8_t)address, range ) )
+			printf( "0x%02X %10u records %12llu - %12llu us\n", address, range.count, (unsigned long long)range.first, (unsigned long long)range.last );
+	}
+
+	return 0;
+}
+
+static int run_dump( const LicCaptureReader& reader, int argc, char** argv ) {
+	static const char* names[ ] = { "?", "WRITE", "READ", "SAMPLE" };
+
+	const bool is_any = argc <= 3 || strcmp( argv[ 3 ], "any" ) == 0;
+	const uint8_t address = is_any ? LICD_CAPTURE_ANY : (uint8_t)strtoul( argv[ 3 ], nullptr, 0 );
+	const uint64_t from = ( argc > 4 ) ? strtoull( argv[ 4 ], nullptr, 0 ) : 0;
+	const uint64_t to = ( argc > 5 ) ? strtoull( argv[ 5 ], nullptr, 0 ) : UINT64_MAX;
+
+	LicCaptureCursor cursor = reader.Find( address, from, to );
+	const LicCaptureRecord* record = nullptr;
+	const uint8_t* payload = nullptr;
+
+	while ( reader.Next( cursor, record, payload ) ) {
+		printf(
+			"%12llu %-6s 0x%02X %c cmd=0x%02X status=%u %5uus",
+			(unsigned long long)record->timestamp,
+			names[ ( record->kind <= LICD_CAPTURE_SAMPLE ) ? record->kind : 0 ],
+			record->address,
+			( record->flags & LICD_CAPTURE_REPEATED ) ? 'r' : ' ',
+			record->command,
+			record->status,
+			record->duration
+		);
+
+		for ( uint16_t byte_id = 0; byte_id < record->size; byte_id++ )
+			printf( " %02X", payload[ byte_id ] );
+
+		printf( "\n" );
+	}
+
+	return 0;
+}
+
+int main( int argc, char** argv ) {
+	if ( argc < 3 ) {
+		fprintf( stderr, "usage: %s info|dump FILE ...\n", argv[ 0 ] );
+
+		return 1;
+	}
+
+	LicCaptureReader reader;
+
+	if ( !reader.Open( argv[ 2 ] ) ) {
+		fprintf( stderr, "unable to map %s\n", argv[ 2 ] );
+
+		return 1;
+	}
+
+	if ( strcmp( argv[ 1 ], "info" ) == 0 )
+		return run_info( reader );
+
+	if ( strcmp( argv[ 1 ], "dump" ) == 0 )
+		return run_dump( reader, argc, argv );
+
+	fprintf( stderr, "unknown action %s\n", argv[ 1 ] );
+
+	return 1;
+}
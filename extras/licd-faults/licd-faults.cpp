@@ -0,0 +1,322 @@
+/**
+ * @file licd-faults.cpp
+ * @brief Measures how the master copes with faults injected on the simulated bus.
+ *
+ * Simulated devices are registered and read by the real `LicDeviceManager`
+ * under virtual time, first without fault, then once per fault kind injected
+ * at the given rate. Each run reports the reads completed, failed and
+ * corrupted, the recoveries and registrations of the manager, and the cost of
+ * the faults in read throughput against the fault-free run.
+ *
+ * Every device answers its UUID, so a read returning anything else counts as
+ * corrupted.
+ *
+ * ## Fault Script
+ * With `--script`, the runs inject the faults of the script instead of random
+ * ones. Each line holds a message index and a fault kind:
+ * ```
+ * 120 stuck
+ * 400 reset
+ * ```
+ *
+ * ## Usage
+ * ```
+ * ./licd-faults [--devices N] [--duration S] [--rate P] [--clock HZ] [--seed N] [--kind KIND] [--script FILE]
+ * ```
+ *
+ * Kinds are `address-nack`, `data-nack`, `bit-flip`, `truncate`, `stretch`,
+ * `stuck` and `reset`. Manager error messages go to `stderr`.
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-faults.cpp -o licd-faults
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#define FAULTS_COMMAND 0x10
+#define FAULTS_POLL_PERIOD 100000
+#define FAULTS_READ_PERIOD 10000
+
+static const char* kind_names[ LICD_SIM_FAULT_COUNT ] = {
+	"address-nack",
+	"data-nack",
+	"bit-flip",
+	"truncate",
+	"stretch",
+	"stuck",
+	"reset"
+};
+
+/**
+ * @brief Options of the runs.
+ **/
+struct Options {
+
+	uint32_t device_count = 4;
+	uint64_t duration = 10000000;
+	float rate = 0.01f;
+	uint32_t clock = LICD_DEFAULT_CLOCK;
+	uint32_t seed = 1;
+	int kind = -1;
+	std::vector<LicSimFaultEvent> script;
+
+};
+
+/**
+ * @brief Outcome of a run.
+ **/
+struct Result {
+
+	uint64_t reads = 0;
+	uint64_t failures = 0;
+	uint64_t corrupted = 0;
+	uint32_t registered = 0;
+	uint32_t recoveries = 0;
+	LicSimStats bus;
+
+};
+
+/**
+ * @brief Answers the UUID of the device to every read.
+ **/
+static uint8_t answer_uuid( LicSimDevice& device, const uint8_t command, uint8_t* data, const uint8_t size ) {
+	const uint32_t uuid = device.GetHeader( ).uuid;
+	const uint8_t answer_size = ( size < sizeof( uint32_t ) ) ? size : sizeof( uint32_t );
+
+	(void)command;
+
+	memcpy( data, &uuid, answer_size );
+
+	return answer_size;
+}
+
+/**
+ * @brief Parses a fault kind name.
+ *
+ * @return The kind, -1 when unknown.
+ **/
+static int parse_kind( const std::string& name ) {
+	for ( int kind = 0; kind < LICD_SIM_FAULT_COUNT; kind++ ) {
+		if ( name == kind_names[ kind ] )
+			return kind;
+	}
+
+	return -1;
+}
+
+/**
+ * @brief Loads a fault script.
+ *
+ * @return true if every line was parsed; false otherwise.
+ **/
+static bool load_script( const char* path, std::vector<LicSimFaultEvent>& script ) {
+	std::ifstream file( path );
+	uint32_t message = 0;
+	std::string name;
+
+	if ( !file )
+		return false;
+
+	while ( file >> message >> name ) {
+		const int kind = parse_kind( name );
+
+		if ( kind < 0 )
+			return false;
+
+		script.push_back( { message, (LicSimFaultKind)kind } );
+	}
+
+	std::sort( script.begin( ), script.end( ), []( const LicSimFaultEvent& a, const LicSimFaultEvent& b ) { return a.message < b.message; } );
+
+	return file.eof( );
+}
+
+/**
+ * @brief Registers and reads the devices for the run duration.
+ *
+ * @param options Options of the runs.
+ * @param kind Fault kind injected at the option rate, -1 for none.
+ * @param is_scripted Whether the faults of the script are injected.
+ * @return The outcome of the run.
+ **/
+static Result run( const Options& options, const int kind, const bool is_scripted ) {
+	std::vector<LicSimDevice*> devices;
+	LicSimFaultConfig faults;
+	Result result;
+
+	faults.seed = options.seed;
+
+	if ( kind >= 0 )
+		faults.rates[ kind ] = options.rate;
+
+	licd_host_set_virtual( true, 0 );
+
+	LicSimBus::setClock( options.clock );
+	LicSimBus::clearFaults( );
+	LicSimBus::resetStats( );
+	LicSimBus::install( );
+
+	for ( uint32_t device_id = 0; device_id < options.device_count; device_id++ ) {
+		LicSimDevice* device = new LicSimDevice( 0xFA000001 + device_id );
+
+		device->SetHandlers( nullptr, answer_uuid );
+		devices.push_back( device );
+
+		LicSimBus::attach( device );
+	}
+
+	LicDeviceManager manager;
+	uint64_t poll_time = 0;
+
+	LicSimBus::setFaults( faults );
+
+	if ( is_scripted )
+		LicSimBus::setScript( options.script.data( ), (uint32_t)options.script.size( ) );
+
+	while ( micros( ) < options.duration ) {
+		if ( micros( ) >= poll_time ) {
+			manager.PollDevice( );
+
+			poll_time = micros( ) + FAULTS_POLL_PERIOD;
+		}
+
+		for ( uint8_t device_id = 0; device_id < LICD_DEVICE_COUNT; device_id++ ) {
+			const LicDeviceAddress address = LICD_ADDRESS_SPACE + device_id;
+			uint32_t value = 0;
+
+			if ( !manager.GetIsRegistered( address ) )
+				continue;
+
+			if ( !manager.Read( address, FAULTS_COMMAND, &value, 1 ) )
+				result.failures += 1;
+			else if ( value != manager.GetUUID( address ) )
+				result.corrupted += 1;
+			else
+				result.reads += 1;
+		}
+
+		delayMicroseconds( FAULTS_READ_PERIOD );
+	}
+
+	for ( uint8_t device_id = 0; device_id < LICD_DEVICE_COUNT; device_id++ )
+		result.registered += manager.GetIsRegistered( LICD_ADDRESS_SPACE + device_id ) ? 1 : 0;
+
+	result.recoveries = manager.GetRecoveries( );
+	result.bus = LicSimBus::getStats( );
+
+	for ( LicSimDevice* device : devices )
+		delete device;
+
+	LicSimBus::clearFaults( );
+	LicI2cDevTransport::setHandler( nullptr );
+
+	licd_host_set_virtual( false );
+
+	return result;
+}
+
+/**
+ * @brief Prints the outcome of a run.
+ **/
+static void print_result( const char* name, const Result& result, const Result& baseline, const Options& options ) {
+	const double seconds = options.duration / 1e6;
+	const double throughput = result.reads / seconds;
+	const double baseline_throughput = baseline.reads / seconds;
+	const double cost = ( baseline_throughput > 0 ) ? 100.0 * ( 1.0 - throughput / baseline_throughput ) : 0.0;
+	uint32_t injected = 0;
+
+	for ( uint8_t kind = 0; kind < LICD_SIM_FAULT_COUNT; kind++ )
+		injected += result.bus.faults[ kind ];
+
+	printf(
+		"%-13s %8u %10.1f %8llu %9llu %10u %10u/%-3u %8.1f%%\n",
+		name,
+		injected,
+		throughput,
+		(unsigned long long)result.failures,
+		(unsigned long long)result.corrupted,
+		result.recoveries,
+		result.registered,
+		options.device_count,
+		cost
+	);
+}
+
+int main( int argc, char** argv ) {
+	Options options;
+
+	for ( int arg_id = 1; arg_id < argc; arg_id++ ) {
+		const std::string argument = argv[ arg_id ];
+		const char* value = ( arg_id + 1 < argc ) ? argv[ arg_id + 1 ] : nullptr;
+
+		if ( value == nullptr ) {
+			fprintf( stderr, "usage: %s [--devices N] [--duration S] [--rate P] [--clock HZ] [--seed N] [--kind KIND] [--script FILE]\n", argv[ 0 ] );
+
+			return 1;
+		}
+
+		arg_id += 1;
+
+		if ( argument == "--devices" )
+			options.device_count = (uint32_t)strtoul( value, nullptr, 0 );
+		else if ( argument == "--duration" )
+			options.duration = (uint64_t)( strtod( value, nullptr ) * 1e6 );
+		else if ( argument == "--rate" )
+			options.rate = (float)strtod( value, nullptr );
+		else if ( argument == "--clock" )
+			options.clock = (uint32_t)strtoul( value, nullptr, 0 );
+		else if ( argument == "--seed" )
+			options.seed = (uint32_t)strtoul( value, nullptr, 0 );
+		else if ( argument == "--kind" && ( options.kind = parse_kind( value ) ) >= 0 )
+			continue;
+		else if ( argument == "--script" && load_script( value, options.script ) )
+			continue;
+		else {
+			fprintf( stderr, "%s: bad option %s %s\n", argv[ 0 ], argument.c_str( ), value );
+
+			return 1;
+		}
+	}
+
+	if ( options.device_count > LICD_SIM_DEVICE_COUNT )
+		options.device_count = LICD_SIM_DEVICE_COUNT;
+
+	printf( "%u devices, %.1f s virtual at %u Hz", options.device_count, options.duration / 1e6, options.clock );
+
+	if ( options.script.empty( ) )
+		printf( ", fault rate %g per message\n\n", options.rate );
+	else
+		printf( ", %zu scripted faults\n\n", options.script.size( ) );
+
+	printf( "%-13s %8s %10s %8s %9s %10s %14s %9s\n", "fault", "injected", "reads/s", "failed", "corrupted", "recoveries", "registered", "cost" );
+
+	const Result baseline = run( options, -1, false );
+
+	print_result( "none", baseline, baseline, options );
+
+	if ( !options.script.empty( ) ) {
+		print_result( "script", run( options, -1, true ), baseline, options );
+
+		return 0;
+	}
+
+	for ( int kind = 0; kind < LICD_SIM_FAULT_COUNT; kind++ ) {
+		if ( options.kind < 0 || options.kind == kind )
+			print_result( kind_names[ kind ], run( options, kind, false ), baseline, options );
+	}
+
+	return 0;
+}
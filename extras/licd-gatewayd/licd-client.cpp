@@ -0,0 +1,198 @@
+/**
+ * @file licd-client.cpp
+ * @brief Command line client of `licd-gatewayd`.
+ *
+ * Connects to a bus socket of the daemon, sends one command and prints the
+ * frames received, one per line.
+ *
+ * ## Usage
+ * ```
+ * ./licd-client SOCKET read ADDRESS COMMAND SIZE
+ * ./licd-client SOCKET write ADDRESS OFFSET BYTE...
+ * ./licd-client SOCKET subscribe ADDRESS COMMAND SIZE PERIOD [COUNT]
+ * ./licd-client SOCKET watch [COUNT]
+ * ./licd-client SOCKET ring RING_PATH ADDRESS COMMAND SIZE PERIOD [COUNT]
+ * ```
+ *
+ * `ring` subscribes without `DATA` frames on the socket and reads the samples
+ * from the shared-memory ring of the device, the daemon runs with `--ring`.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+static void print_frame( const LicGatewayFrame& frame ) {
+	static const char* names[ ] = { "?", "DATA", "ATTACH", "DETACH", "REPLY" };
+
+	printf( "%10u %-6s 0x%02X", frame.timestamp, names[ ( frame.type <= LICD_GATEWAY_REPLY ) ? frame.type : 0 ], frame.address );
+
+	for ( uint8_t byte_id = 0; byte_id < frame.size; byte_id++ )
+		printf( " %02X", frame.payload[ byte_id ] );
+
+	printf( "\n" );
+	fflush( stdout );
+}
+
+static void send_frame( const int file, const uint8_t type, const uint8_t address, const uint8_t* payload, const uint8_t size ) {
+	LicGatewayFrame frame;
+	uint8_t buffer[ LICD_GATEWAY_FRAME_SIZE ];
+
+	frame.type = type;
+	frame.address = address;
+	frame.size = size;
+
+	memcpy( frame.payload, payload, size );
+
+	const ssize_t written = write( file, buffer, LicGatewayParser::Encode( frame, buffer ) );
+
+	(void)written;
+}
+
+/**
+ * @brief Subscribes for the ring only and prints the samples read from the ring.
+ **/
+static int run_ring( const int file, int argc, char** argv ) {
+	const uint8_t address = (uint8_t)strtoul( argv[ 4 ], nullptr, 0 );
+	const uint16_t period = (uint16_t)strtoul( argv[ 7 ], nullptr, 0 );
+	const uint32_t sample_count = ( argc > 8 ) ? (uint32_t)strtoul( argv[ 8 ], nullptr, 0 ) : 0;
+	const uint8_t payload[ 5 ] = {
+		(uint8_t)strtoul( argv[ 5 ], nullptr, 0 ),
+		(uint8_t)strtoul( argv[ 6 ], nullptr, 0 ),
+		(uint8_t)period,
+		(uint8_t)( period >> 8 ),
+		0x01
+	};
+
+	send_frame( file, LICD_GATEWAY_SUBSCRIBE, address, payload, 5 );
+
+	LicSampleRing ring;
+	LicRingSample sample;
+	uint32_t read_count = 0;
+
+	while ( !ring.Open( argv[ 3 ] ) )
+		delay( 10 );
+
+	while ( sample_count == 0 || read_count < sample_count ) {
+		const LicRingStatus status = ring.Read( sample );
+
+		if ( status == LICD_RING_EMPTY ) {
+			delay( 1 );
+
+			continue;
+		}
+
+		printf( "%10u #%-8llu 0x%02X %s", sample.timestamp, (unsigned long long)sample.sequence, sample.command, ( status == LICD_RING_OVERRUN ) ? "overrun" : "" );
+
+		for ( uint8_t byte_id = 0; byte_id < sample.size; byte_id++ )
+			printf( " %02X", sample.data[ byte_id ] );
+
+		printf( "\n" );
+		fflush( stdout );
+
+		read_count += 1;
+	}
+
+	printf( "%llu samples lost\n", (unsigned long long)ring.GetLost( ) );
+
+	close( file );
+
+	return 0;
+}
+
+int main( int argc, char** argv ) {
+	if ( argc < 3 ) {
+		fprintf( stderr, "usage: %s SOCKET read|write|subscribe|watch|ring ...\n", argv[ 0 ] );
+
+		return 1;
+	}
+
+	const int file = socket( AF_UNIX, SOCK_STREAM, 0 );
+	struct sockaddr_un address;
+
+	memset( &address, 0, sizeof( address ) );
+
+	address.sun_family = AF_UNIX;
+
+	strncpy( address.sun_path, argv[ 1 ], sizeof( address.sun_path ) - 1 );
+
+	if ( file < 0 || connect( file, (struct sockaddr*)&address, sizeof( address ) ) != 0 ) {
+		fprintf( stderr, "unable to connect to %s\n", argv[ 1 ] );
+
+		return 1;
+	}
+
+	const char* action = argv[ 2 ];
+
+	if ( strcmp( action, "ring" ) == 0 && argc >= 8 )
+		return run_ring( file, argc, argv );
+
+	uint8_t payload[ LICD_GATEWAY_PAYLOAD_SIZE ];
+	uint8_t payload_size = 0;
+	uint32_t frame_count = 1;
+	uint8_t type = 0;
+
+	for ( int arg_id = 4; arg_id < argc && payload_size < LICD_GATEWAY_PAYLOAD_SIZE; arg_id++ )
+		payload[ payload_size++ ] = (uint8_t)strtoul( argv[ arg_id ], nullptr, 0 );
+
+	if ( strcmp( action, "read" ) == 0 && argc == 6 )
+		type = LICD_GATEWAY_READ;
+	else if ( strcmp( action, "write" ) == 0 && argc > 5 )
+		type = LICD_GATEWAY_WRITE;
+	else if ( strcmp( action, "subscribe" ) == 0 && argc >= 7 ) {
+		const uint16_t period = (uint16_t)strtoul( argv[ 6 ], nullptr, 0 );
+
+		type = LICD_GATEWAY_SUBSCRIBE;
+		payload[ 2 ] = (uint8_t)period;
+		payload[ 3 ] = (uint8_t)( period >> 8 );
+		payload_size = 4;
+		frame_count = ( argc > 7 ) ? (uint32_t)strtoul( argv[ 7 ], nullptr, 0 ) : 0;
+	} else if ( strcmp( action, "watch" ) == 0 )
+		frame_count = ( argc > 3 ) ? (uint32_t)strtoul( argv[ 3 ], nullptr, 0 ) : 0;
+	else {
+		fprintf( stderr, "bad arguments for %s\n", action );
+
+		return 1;
+	}
+
+	if ( type != 0 )
+		send_frame( file, type, (uint8_t)strtoul( argv[ 3 ], nullptr, 0 ), payload, payload_size );
+
+	LicGatewayParser parser;
+	uint8_t buffer[ 256 ];
+	ssize_t size = 0;
+
+	while ( ( size = read( file, buffer, sizeof( buffer ) ) ) > 0 ) {
+		for ( ssize_t byte_id = 0; byte_id < size; byte_id++ ) {
+			if ( !parser.Push( buffer[ byte_id ] ) )
+				continue;
+
+			const LicGatewayFrame& frame = parser.GetFrame( );
+
+			print_frame( frame );
+
+			if ( type == LICD_GATEWAY_SUBSCRIBE ) {
+				if ( frame.type != LICD_GATEWAY_DATA || frame_count == 0 || --frame_count > 0 )
+					continue;
+			} else if ( frame.type != LICD_GATEWAY_REPLY && type != 0 )
+				continue;
+			else if ( type == 0 && ( frame_count == 0 || --frame_count > 0 ) )
+				continue;
+
+			close( file );
+
+			return ( frame.type == LICD_GATEWAY_REPLY && frame.size > 1 && frame.payload[ 1 ] != 0 ) ? 1 : 0;
+		}
+	}
+
+	close( file );
+
+	return 0;
+}
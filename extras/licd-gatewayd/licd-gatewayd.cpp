@@ -0,0 +1,1099 @@
+/**
+ * @file licd-gatewayd.cpp
+ * @brief Linux daemon sharing LICD buses between many local processes.
+ *
+ * The daemon owns one or more buses and serves each of them on its own Unix
+ * domain socket. Clients speak the gateway frames of `licd_gateway.h` on the
+ * socket, the daemon multiplexes them on the bus.
+ *
+ * ## Buses
+ * - `serial:PATH[@BAUD]`, a master running `LicGateway` behind a serial port.
+ * - `i2c:PATH`, a `LicDeviceManager` in the daemon driving `/dev/i2c-N`.
+ * - `sim:COUNT`, a `LicDeviceManager` in the daemon driving `COUNT` simulated
+ *   devices (see `licd_sim.h`).
+ *
+ * The in-process buses run a `LicGateway` over a memory stream, so every bus
+ * speaks the same frames. The transport is static, a daemon runs at most one
+ * in-process bus.
+ *
+ * ## Multiplexing
+ * - Identical reads (device, command, size) waiting for the bus are sent once,
+ *   the reply goes to every client that asked.
+ * - Subscriptions of several clients to the same command become one bus
+ *   subscription at the shortest period, each client gets the samples at its
+ *   own period. They are sent again when the device attaches after a reset.
+ * - Frames from the bus are encoded once in a shared buffer, client queues hold
+ *   references to it and are flushed with `writev`.
+ * - Each client owns a token bucket of `--rate` requests per second. A request
+ *   over the limit gets a `REPLY` with status `STATUS_LIMITED`, a client whose
+ *   queue is full loses `DATA` frames, never replies.
+ *
+ * ## Shared-Memory Rings
+ * With `--ring DIR`, every sample of a device is also published in the
+ * `LicSampleRing` file `DIR/licd-BUS-ADDRESS.ring` (`/dev/shm/licd-0-02.ring`
+ * for device 0x02 of the first bus). A `SUBSCRIBE` with a fifth payload byte
+ * set to `SUBSCRIBE_RING` drives the bus without any `DATA` frame on the
+ * socket, the client reads the samples from the ring.
+ *
+ * ## Capture
+ * With `--capture DIR`, the session of every bus is recorded in the capture file
+ * `DIR/licd-BUS.lcap` (see `licd_capture.h`): every sample of its devices and,
+ * for the in-process bus, every transaction on the wire. The files are flushed
+ * every second and sealed when the daemon stops.
+ *
+ * ## Reply Status
+ * | Status | Meaning                                   |
+ * |--------|-------------------------------------------|
+ * | 0      | Success.                                  |
+ * | 1      | Failed on the gateway.                    |
+ * | 2      | Rate limited by the daemon.               |
+ * | 3      | No reply from the bus in time.            |
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-gatewayd.cpp -o licd-gatewayd
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-client.cpp -o licd-client
+ * ./licd-gatewayd /tmp/licd-bus0.sock=sim:2 &
+ * ./licd-client /tmp/licd-bus0.sock subscribe 0x02 0x10 4 100
+ * ./licd-gatewayd --ring /dev/shm /tmp/licd-bus0.sock=sim:2 &
+ * ./licd-client /tmp/licd-bus0.sock ring /dev/shm/licd-0-02.ring 0x02 0x10 4 10
+ * ./licd-gatewayd --capture /var/log /tmp/licd-bus0.sock=i2c:/dev/i2c-1 &
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define BUS_COUNT 8
+#define CLIENT_BACKLOG 16
+#define CLIENT_QUEUE 256
+#define REQUEST_TIMEOUT 500
+#define DEFAULT_RATE 200
+#define STATUS_LIMITED 2
+#define STATUS_TIMEOUT 3
+#define SUBSCRIBE_RING 0x01
+#define CAPTURE_FLUSH_PERIOD 1000
+
+typedef std::shared_ptr<const std::vector<uint8_t>> SharedFrame;
+
+static volatile sig_atomic_t is_running = 1;
+static double client_rate = DEFAULT_RATE;
+static const char* ring_directory = nullptr;
+static uint32_t ring_slots = LICD_RING_SLOT_COUNT;
+static const char* capture_directory = nullptr;
+
+/**
+ * @brief Encodes a frame once, for every queue it goes to.
+ **/
+static SharedFrame share( const LicGatewayFrame& frame ) {
+	uint8_t buffer[ LICD_GATEWAY_FRAME_SIZE ];
+	const uint8_t size = LicGatewayParser::Encode( frame, buffer );
+
+	return std::make_shared<const std::vector<uint8_t>>( buffer, buffer + size );
+}
+
+/**
+ * @brief Builds a reply frame generated by the daemon.
+ **/
+static SharedFrame make_reply( const uint8_t request, const uint8_t address, const uint8_t status ) {
+	LicGatewayFrame frame;
+
+	frame.type = LICD_GATEWAY_REPLY;
+	frame.address = address;
+	frame.timestamp = millis( );
+	frame.size = 2;
+	frame.payload[ 0 ] = request;
+	frame.payload[ 1 ] = status;
+
+	return share( frame );
+}
+
+/**
+ * @class Link
+ * @brief Byte pipe to a gateway, a serial port or an in-process gateway.
+ **/
+class Link {
+
+public:
+	virtual ~Link( ) { };
+
+	virtual int GetFile( ) const = 0;
+
+	virtual void Send( const uint8_t* data, const size_t size ) = 0;
+
+	virtual int Receive( uint8_t* data, const size_t size ) = 0;
+
+	virtual void Update( ) { };
+
+};
+
+/**
+ * @class SerialLink
+ * @brief Gateway behind a serial port.
+ **/
+class SerialLink final : public Link {
+
+private:
+	int m_file;
+
+public:
+	SerialLink( const char* path, const uint32_t baud_rate ) {
+		m_file = open( path, O_RDWR | O_NOCTTY | O_NONBLOCK );
+
+		struct termios options;
+		speed_t speed = B115200;
+
+		switch ( baud_rate ) {
+			case 230400 : speed = B230400; break;
+			case 460800 : speed = B460800; break;
+			case 500000 : speed = B500000; break;
+			case 921600 : speed = B921600; break;
+			case 1000000 : speed = B1000000; break;
+			case 2000000 : speed = B2000000; break;
+
+			default : break;
+		}
+
+		if ( m_file >= 0 && tcgetattr( m_file, &options ) == 0 ) {
+			cfmakeraw( &options );
+			cfsetispeed( &options, speed );
+			cfsetospeed( &options, speed );
+
+			options.c_cflag |= CLOCAL | CREAD;
+
+			tcsetattr( m_file, TCSANOW, &options );
+		}
+	};
+
+	~SerialLink( ) {
+		if ( m_file >= 0 )
+			close( m_file );
+	};
+
+	int GetFile( ) const override {
+		return m_file;
+	};
+
+	void Send( const uint8_t* data, const size_t size ) override {
+		size_t offset = 0;
+
+		while ( m_file >= 0 && offset < size ) {
+			const ssize_t written = write( m_file, data + offset, size - offset );
+
+			if ( written > 0 )
+				offset += (size_t)written;
+			else if ( written < 0 && errno != EAGAIN && errno != EINTR )
+				return;
+		}
+	};
+
+	int Receive( uint8_t* data, const size_t size ) override {
+		const ssize_t size_read = ( m_file >= 0 ) ? read( m_file, data, size ) : -1;
+
+		return ( size_read > 0 ) ? (int)size_read : 0;
+	};
+
+};
+
+/**
+ * @class MemoryStream
+ * @brief `Stream` joining the daemon and an in-process `LicGateway`.
+ **/
+class MemoryStream final : public Stream {
+
+public:
+	std::deque<uint8_t> m_input;
+	std::deque<uint8_t> m_output;
+
+public:
+	int available( ) override {
+		return (int)m_input.size( );
+	};
+
+	int read( ) override {
+		if ( m_input.empty( ) )
+			return -1;
+
+		const uint8_t value = m_input.front( );
+
+		m_input.pop_front( );
+
+		return value;
+	};
+
+	int peek( ) override {
+		return m_input.empty( ) ? -1 : m_input.front( );
+	};
+
+	size_t write( const uint8_t value ) override {
+		m_output.push_back( value );
+
+		return 1;
+	};
+
+	size_t write( const uint8_t* data, size_t size ) override {
+		m_output.insert( m_output.end( ), data, data + size );
+
+		return size;
+	};
+
+};
+
+/**
+ * @class LocalLink
+ * @brief `LicGateway` running in the daemon on the static transport.
+ **/
+class LocalLink final : public Link {
+
+private:
+	MemoryStream m_stream;
+	LicDeviceManager m_manager;
+	LicGateway m_gateway;
+
+public:
+	LocalLink( )
+		: m_stream{ },
+		m_manager{ 1, 0, 5 },
+		m_gateway{ m_manager, m_stream }
+	{ };
+
+	int GetFile( ) const override {
+		return -1;
+	};
+
+	void Send( const uint8_t* data, const size_t size ) override {
+		m_stream.m_input.insert( m_stream.m_input.end( ), data, data + size );
+	};
+
+	int Receive( uint8_t* data, const size_t size ) override {
+		size_t offset = 0;
+
+		while ( offset < size && !m_stream.m_output.empty( ) ) {
+			data[ offset++ ] = m_stream.m_output.front( );
+
+			m_stream.m_output.pop_front( );
+		}
+
+		return (int)offset;
+	};
+
+	void Update( ) override {
+		m_gateway.Update( );
+	};
+
+};
+
+/**
+ * @brief Local client connected to a bus socket.
+ **/
+struct Client {
+
+	int file = -1;
+	uint8_t bus = 0;
+	LicGatewayParser parser;
+	std::deque<SharedFrame> queue;
+	size_t offset = 0;
+	double tokens = DEFAULT_RATE;
+	uint64_t refill_time = 0;
+	uint32_t drops = 0;
+
+};
+
+/**
+ * @brief Client side of a subscription.
+ **/
+struct Subscriber {
+
+	uint16_t period = 0;
+	uint32_t timestamp = 0;
+	bool is_fresh = true;
+	bool is_ring = false;
+
+};
+
+/**
+ * @brief Bus subscription shared by clients.
+ **/
+struct Subscription {
+
+	uint8_t size = 0;
+	uint16_t period = 0;
+	std::map<int, Subscriber> clients;
+
+};
+
+/**
+ * @brief Request waiting for its reply from the bus.
+ **/
+struct Pending {
+
+	uint8_t type = 0;
+	uint8_t address = 0;
+	uint8_t command = 0;
+	uint8_t size = 0;
+	uint32_t timestamp = 0;
+	std::vector<int> clients;
+
+};
+
+/**
+ * @brief Bus served on a socket.
+ **/
+struct Bus {
+
+	std::string path;
+	int file = -1;
+	std::unique_ptr<Link> link;
+	LicGatewayParser parser;
+	std::deque<Pending> pending;
+	std::map<uint16_t, Subscription> subscriptions;
+	std::map<uint8_t, SharedFrame> attached;
+	std::map<uint8_t, std::unique_ptr<LicSampleRing>> rings;
+	std::unique_ptr<LicCaptureWriter> capture;
+	uint32_t coalesced = 0;
+
+};
+
+static Bus buses[ BUS_COUNT ];
+static uint8_t bus_count = 0;
+static std::map<int, Client> clients;
+static std::vector<LicSimDevice*> sim_devices;
+static uint8_t local_bus = BUS_COUNT;
+
+static uint16_t make_key( const uint8_t address, const uint8_t command ) {
+	return (uint16_t)( ( address << 8 ) | command );
+}
+
+static void enqueue( Client& client, const SharedFrame& frame, const bool is_droppable ) {
+	if ( is_droppable && client.queue.size( ) >= CLIENT_QUEUE ) {
+		client.drops += 1;
+
+		return;
+	}
+
+	client.queue.push_back( frame );
+}
+
+static void enqueue( const int file, const SharedFrame& frame ) {
+	std::map<int, Client>::iterator client = clients.find( file );
+
+	if ( client != clients.end( ) )
+		enqueue( client->second, frame, false );
+}
+
+/**
+ * @brief Sends a command frame to the gateway of a bus.
+ **/
+static void send_bus( Bus& bus, const uint8_t type, const uint8_t address, const uint8_t* payload, const uint8_t size ) {
+	LicGatewayFrame frame;
+	uint8_t buffer[ LICD_GATEWAY_FRAME_SIZE ];
+
+	frame.type = type;
+	frame.address = address;
+	frame.timestamp = millis( );
+	frame.size = size;
+
+	memcpy( frame.payload, payload, size );
+
+	bus.link->Send( buffer, LicGatewayParser::Encode( frame, buffer ) );
+}
+
+/**
+ * @brief Sends the bus subscription matching the clients of a command.
+ *
+ * @return true if a subscription frame was sent; false when the bus is already up to date.
+ **/
+static bool sync_subscription( Bus& bus, const uint16_t key, const bool is_forced, const int client ) {
+	Subscription& subscription = bus.subscriptions[ key ];
+	const uint8_t address = (uint8_t)( key >> 8 );
+	const uint8_t command = (uint8_t)key;
+	uint16_t period = 0xFFFF;
+
+	for ( const auto& subscriber : subscription.clients )
+		period = ( subscriber.second.period < period ) ? subscriber.second.period : period;
+
+	Pending pending;
+
+	pending.address = address;
+	pending.command = command;
+	pending.timestamp = millis( );
+
+	if ( client >= 0 )
+		pending.clients.push_back( client );
+
+	if ( subscription.clients.empty( ) ) {
+		pending.type = LICD_GATEWAY_UNSUBSCRIBE;
+
+		send_bus( bus, LICD_GATEWAY_UNSUBSCRIBE, address, &command, 1 );
+
+		bus.subscriptions.erase( key );
+		bus.pending.push_back( pending );
+
+		return true;
+	}
+
+	if ( !is_forced && period == subscription.period )
+		return false;
+
+	const uint8_t payload[ 4 ] = { command, subscription.size, (uint8_t)period, (uint8_t)( period >> 8 ) };
+
+	subscription.period = period;
+	pending.type = LICD_GATEWAY_SUBSCRIBE;
+
+	send_bus( bus, LICD_GATEWAY_SUBSCRIBE, address, payload, 4 );
+
+	bus.pending.push_back( pending );
+
+	return true;
+}
+
+/**
+ * @brief Consumes a request token of a client.
+ **/
+static bool take_token( Client& client ) {
+	const uint64_t now = micros( );
+
+	client.tokens += (double)( now - client.refill_time ) * client_rate / 1000000.0;
+	client.refill_time = now;
+
+	if ( client.tokens > client_rate )
+		client.tokens = client_rate;
+
+	if ( client.tokens < 1.0 )
+		return false;
+
+	client.tokens -= 1.0;
+
+	return true;
+}
+
+/**
+ * @brief Runs a frame received from a client.
+ **/
+static void handle_client( Client& client, const LicGatewayFrame& frame ) {
+	Bus& bus = buses[ client.bus ];
+
+	if ( !take_token( client ) ) {
+		enqueue( client, make_reply( frame.type, frame.address, STATUS_LIMITED ), false );
+
+		return;
+	}
+
+	switch ( frame.type ) {
+		case LICD_GATEWAY_READ : {
+			if ( frame.size < 2 )
+				break;
+
+			for ( Pending& pending : bus.pending ) {
+				if ( pending.type == LICD_GATEWAY_READ && pending.address == frame.address && pending.command == frame.payload[ 0 ] && pending.size == frame.payload[ 1 ] ) {
+					pending.clients.push_back( client.file );
+					bus.coalesced += 1;
+
+					return;
+				}
+			}
+
+			Pending pending;
+
+			pending.type = LICD_GATEWAY_READ;
+			pending.address = frame.address;
+			pending.command = frame.payload[ 0 ];
+			pending.size = frame.payload[ 1 ];
+			pending.timestamp = millis( );
+			pending.clients.push_back( client.file );
+
+			send_bus( bus, frame.type, frame.address, frame.payload, frame.size );
+
+			bus.pending.push_back( pending );
+
+			return;
+		}
+
+		case LICD_GATEWAY_WRITE : {
+			Pending pending;
+
+			pending.type = LICD_GATEWAY_WRITE;
+			pending.address = frame.address;
+			pending.timestamp = millis( );
+			pending.clients.push_back( client.file );
+
+			send_bus( bus, frame.type, frame.address, frame.payload, frame.size );
+
+			bus.pending.push_back( pending );
+
+			return;
+		}
+
+		case LICD_GATEWAY_SUBSCRIBE : {
+			if ( frame.size < 4 || frame.payload[ 1 ] == 0 || frame.payload[ 1 ] > LICD_FRAME_SIZE )
+				break;
+
+			const uint16_t key = make_key( frame.address, frame.payload[ 0 ] );
+			Subscription& subscription = bus.subscriptions[ key ];
+			const bool is_resized = subscription.size != frame.payload[ 1 ];
+			Subscriber& subscriber = subscription.clients[ client.file ];
+
+			subscription.size = ( subscription.size > frame.payload[ 1 ] ) ? subscription.size : frame.payload[ 1 ];
+			subscriber.period = (uint16_t)( frame.payload[ 2 ] | ( frame.payload[ 3 ] << 8 ) );
+			subscriber.is_fresh = true;
+			subscriber.is_ring = ( frame.size > 4 ) && ( frame.payload[ 4 ] & SUBSCRIBE_RING ) != 0;
+
+			if ( !sync_subscription( bus, key, is_resized, client.file ) )
+				enqueue( client, make_reply( frame.type, frame.address, 0 ), false );
+
+			return;
+		}
+
+		case LICD_GATEWAY_UNSUBSCRIBE : {
+			if ( frame.size < 1 )
+				break;
+
+			const uint16_t key = make_key( frame.address, frame.payload[ 0 ] );
+			std::map<uint16_t, Subscription>::iterator subscription = bus.subscriptions.find( key );
+
+			if ( subscription != bus.subscriptions.end( ) && subscription->second.clients.erase( client.file ) > 0 )
+				sync_subscription( bus, key, false, -1 );
+
+			enqueue( client, make_reply( frame.type, frame.address, 0 ), false );
+
+			return;
+		}
+
+		default : break;
+	}
+
+	enqueue( client, make_reply( frame.type, frame.address, 1 ), false );
+}
+
+/**
+ * @brief Publishes a sample in the ring of its device, created on first use.
+ **/
+static void publish_ring( const uint8_t bus_id, const LicGatewayFrame& frame ) {
+	if ( ring_directory == nullptr )
+		return;
+
+	std::unique_ptr<LicSampleRing>& ring = buses[ bus_id ].rings[ frame.address ];
+
+	if ( !ring ) {
+		char path[ 256 ];
+
+		snprintf( path, sizeof( path ), "%s/licd-%u-%02X.ring", ring_directory, bus_id, frame.address );
+
+		ring.reset( new LicSampleRing( ) );
+
+		if ( !ring->Create( path, ring_slots ) )
+			fprintf( stderr, "unable to create %s\n", path );
+	}
+
+	ring->Publish( frame.payload[ 0 ], frame.timestamp, frame.payload + 1, frame.size - 1 );
+}
+
+/**
+ * @brief Records the transactions of the in-process bus.
+ **/
+static void capture_transaction(
+	const struct i2c_rdwr_ioctl_data* transaction,
+	const uint8_t status,
+	const uint64_t start,
+	const uint64_t duration
+) {
+	if ( local_bus < bus_count && buses[ local_bus ].capture )
+		buses[ local_bus ].capture->AppendTransaction( transaction, status, start, duration );
+}
+
+/**
+ * @brief Opens the capture file of a bus.
+ **/
+static bool open_capture( const uint8_t bus_id ) {
+	char path[ 256 ];
+
+	snprintf( path, sizeof( path ), "%s/licd-%u.lcap", capture_directory, bus_id );
+
+	buses[ bus_id ].capture.reset( new LicCaptureWriter( ) );
+
+	if ( buses[ bus_id ].capture->Open( path ) )
+		return true;
+
+	fprintf( stderr, "unable to open %s\n", path );
+
+	return false;
+}
+
+/**
+ * @brief Fans a frame received from a bus out to its clients.
+ **/
+static void handle_bus( const uint8_t bus_id, const LicGatewayFrame& frame ) {
+	Bus& bus = buses[ bus_id ];
+
+	switch ( frame.type ) {
+		case LICD_GATEWAY_DATA : {
+			if ( frame.size < 1 )
+				return;
+
+			publish_ring( bus_id, frame );
+
+			if ( bus.capture )
+				bus.capture->AppendSample( frame.address, frame.payload[ 0 ], licd_host_micros( ), frame.payload + 1, frame.size - 1 );
+
+			std::map<uint16_t, Subscription>::iterator subscription = bus.subscriptions.find( make_key( frame.address, frame.payload[ 0 ] ) );
+
+			if ( subscription == bus.subscriptions.end( ) )
+				return;
+
+			SharedFrame shared;
+
+			for ( auto& subscriber : subscription->second.clients ) {
+				Subscriber& state = subscriber.second;
+
+				if ( state.is_ring )
+					continue;
+
+				if ( !state.is_fresh && ( frame.timestamp - state.timestamp ) < state.period )
+					continue;
+
+				if ( !shared )
+					shared = share( frame );
+
+				state.timestamp = frame.timestamp;
+				state.is_fresh = false;
+
+				std::map<int, Client>::iterator client = clients.find( subscriber.first );
+
+				if ( client != clients.end( ) )
+					enqueue( client->second, shared, true );
+			}
+
+			return;
+		}
+
+		case LICD_GATEWAY_ATTACH :
+		case LICD_GATEWAY_DETACH : {
+			const SharedFrame shared = share( frame );
+
+			if ( frame.type == LICD_GATEWAY_ATTACH ) {
+				bus.attached[ frame.address ] = shared;
+
+				for ( auto& subscription : bus.subscriptions ) {
+					if ( ( subscription.first >> 8 ) == frame.address )
+						sync_subscription( bus, subscription.first, true, -1 );
+				}
+			} else
+				bus.attached.erase( frame.address );
+
+			for ( auto& client : clients ) {
+				if ( client.second.bus == bus_id )
+					enqueue( client.second, shared, false );
+			}
+
+			return;
+		}
+
+		case LICD_GATEWAY_REPLY : {
+			if ( frame.size < 2 )
+				return;
+
+			while ( !bus.pending.empty( ) ) {
+				const Pending pending = bus.pending.front( );
+
+				bus.pending.pop_front( );
+
+				if ( pending.type == frame.payload[ 0 ] && pending.address == frame.address ) {
+					const SharedFrame shared = share( frame );
+
+					for ( const int client : pending.clients )
+						enqueue( client, shared );
+
+					return;
+				}
+
+				for ( const int client : pending.clients )
+					enqueue( client, make_reply( pending.type, pending.address, STATUS_TIMEOUT ) );
+			}
+
+			return;
+		}
+
+		default : break;
+	}
+}
+
+/**
+ * @brief Fails the requests the bus did not answer in time.
+ **/
+static void expire_pending( Bus& bus ) {
+	const uint32_t now = millis( );
+
+	while ( !bus.pending.empty( ) && ( now - bus.pending.front( ).timestamp ) > REQUEST_TIMEOUT ) {
+		const Pending& pending = bus.pending.front( );
+
+		for ( const int client : pending.clients )
+			enqueue( client, make_reply( pending.type, pending.address, STATUS_TIMEOUT ) );
+
+		bus.pending.pop_front( );
+	}
+}
+
+static void accept_client( const uint8_t bus_id ) {
+	const int file = accept( buses[ bus_id ].file, nullptr, nullptr );
+
+	if ( file < 0 )
+		return;
+
+	fcntl( file, F_SETFL, fcntl( file, F_GETFL ) | O_NONBLOCK );
+
+	Client& client = clients[ file ];
+
+	client.file = file;
+	client.bus = bus_id;
+	client.tokens = client_rate;
+	client.refill_time = micros( );
+
+	for ( const auto& attached : buses[ bus_id ].attached )
+		enqueue( client, attached.second, false );
+}
+
+static void close_client( const int file ) {
+	Bus& bus = buses[ clients[ file ].bus ];
+
+	for ( auto subscription = bus.subscriptions.begin( ); subscription != bus.subscriptions.end( ); ) {
+		const uint16_t key = subscription->first;
+		const bool is_removed = subscription->second.clients.erase( file ) > 0;
+
+		++subscription;
+
+		if ( is_removed )
+			sync_subscription( bus, key, false, -1 );
+	}
+
+	for ( Pending& pending : bus.pending ) {
+		for ( auto waiter = pending.clients.begin( ); waiter != pending.clients.end( ); ) {
+			if ( *waiter == file )
+				waiter = pending.clients.erase( waiter );
+			else
+				++waiter;
+		}
+	}
+
+	clients.erase( file );
+
+	close( file );
+}
+
+/**
+ * @brief Reads the frames of a client.
+ *
+ * @return false when the client disconnected.
+ **/
+static bool read_client( Client& client ) {
+	uint8_t buffer[ 256 ];
+	const ssize_t size = read( client.file, buffer, sizeof( buffer ) );
+
+	if ( size == 0 || ( size < 0 && errno != EAGAIN && errno != EINTR ) )
+		return false;
+
+	for ( ssize_t byte_id = 0; byte_id < size; byte_id++ ) {
+		if ( client.parser.Push( buffer[ byte_id ] ) )
+			handle_client( client, client.parser.GetFrame( ) );
+	}
+
+	return true;
+}
+
+/**
+ * @brief Writes the queued frames of a client in one system call.
+ *
+ * @return false when the client disconnected.
+ **/
+static bool flush_client( Client& client ) {
+	struct iovec vectors[ 64 ];
+	int vector_count = 0;
+
+	for ( const SharedFrame& frame : client.queue ) {
+		if ( vector_count == 64 )
+			break;
+
+		const size_t offset = ( vector_count == 0 ) ? client.offset : 0;
+
+		vectors[ vector_count ].iov_base = const_cast<uint8_t*>( frame->data( ) ) + offset;
+		vectors[ vector_count ].iov_len = frame->size( ) - offset;
+		vector_count += 1;
+	}
+
+	if ( vector_count == 0 )
+		return true;
+
+	ssize_t written = writev( client.file, vectors, vector_count );
+
+	if ( written < 0 )
+		return ( errno == EAGAIN || errno == EINTR );
+
+	while ( written > 0 ) {
+		const size_t left = client.queue.front( )->size( ) - client.offset;
+
+		if ( (size_t)written < left ) {
+			client.offset += (size_t)written;
+
+			break;
+		}
+
+		written -= (ssize_t)left;
+		client.offset = 0;
+		client.queue.pop_front( );
+	}
+
+	return true;
+}
+
+static void read_bus( const uint8_t bus_id ) {
+	Bus& bus = buses[ bus_id ];
+	uint8_t buffer[ 256 ];
+	int size = 0;
+
+	while ( ( size = bus.link->Receive( buffer, sizeof( buffer ) ) ) > 0 ) {
+		for ( int byte_id = 0; byte_id < size; byte_id++ ) {
+			if ( bus.parser.Push( buffer[ byte_id ] ) )
+				handle_bus( bus_id, bus.parser.GetFrame( ) );
+		}
+	}
+}
+
+/**
+ * @brief Creates the link described by a bus argument.
+ **/
+static Link* make_link( const std::string& description, bool& is_local ) {
+	const size_t separator = description.find( ':' );
+	const std::string kind = description.substr( 0, separator );
+	const std::string value = ( separator == std::string::npos ) ? "" : description.substr( separator + 1 );
+
+	if ( kind == "serial" ) {
+		const size_t at = value.find( '@' );
+		const uint32_t baud_rate = ( at == std::string::npos ) ? 115200 : (uint32_t)strtoul( value.c_str( ) + at + 1, nullptr, 10 );
+		SerialLink* link = new SerialLink( value.substr( 0, at ).c_str( ), baud_rate );
+
+		if ( link->GetFile( ) < 0 ) {
+			delete link;
+
+			return nullptr;
+		}
+
+		return link;
+	}
+
+	if ( is_local || ( kind != "i2c" && kind != "sim" ) )
+		return nullptr;
+
+	is_local = true;
+
+	if ( kind == "i2c" ) {
+		static std::string path;
+
+		path = value;
+
+		LicI2cDevTransport::setDevice( path.c_str( ) );
+	} else {
+		const uint32_t device_count = (uint32_t)strtoul( value.c_str( ), nullptr, 0 );
+
+		for ( uint32_t device_id = 0; device_id < device_count && device_id < LICD_SIM_DEVICE_COUNT; device_id++ ) {
+			sim_devices.push_back( new LicSimDevice( 0x51D00000 + device_id ) );
+
+			LicSimBus::attach( sim_devices.back( ) );
+		}
+
+		LicSimBus::install( );
+	}
+
+	return new LocalLink( );
+}
+
+static int listen_on( const std::string& path ) {
+	const int file = socket( AF_UNIX, SOCK_STREAM, 0 );
+	struct sockaddr_un address;
+
+	memset( &address, 0, sizeof( address ) );
+
+	address.sun_family = AF_UNIX;
+
+	strncpy( address.sun_path, path.c_str( ), sizeof( address.sun_path ) - 1 );
+
+	unlink( path.c_str( ) );
+
+	if ( file < 0 || bind( file, (struct sockaddr*)&address, sizeof( address ) ) != 0 || listen( file, CLIENT_BACKLOG ) != 0 ) {
+		if ( file >= 0 )
+			close( file );
+
+		return -1;
+	}
+
+	fcntl( file, F_SETFL, fcntl( file, F_GETFL ) | O_NONBLOCK );
+
+	return file;
+}
+
+static void stop( int signal_id ) {
+	(void)signal_id;
+
+	is_running = 0;
+}
+
+int main( int argc, char** argv ) {
+	uint32_t flush_time = millis( );
+	bool is_local = false;
+
+	for ( int arg_id = 1; arg_id < argc; arg_id++ ) {
+		const std::string argument = argv[ arg_id ];
+
+		if ( argument == "--rate" && arg_id + 1 < argc ) {
+			client_rate = strtod( argv[ ++arg_id ], nullptr );
+
+			continue;
+		}
+
+		if ( argument == "--ring" && arg_id + 1 < argc ) {
+			ring_directory = argv[ ++arg_id ];
+
+			continue;
+		}
+
+		if ( argument == "--ring-slots" && arg_id + 1 < argc ) {
+			ring_slots = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+
+			continue;
+		}
+
+		if ( argument == "--capture" && arg_id + 1 < argc ) {
+			capture_directory = argv[ ++arg_id ];
+
+			continue;
+		}
+
+		const size_t separator = argument.find( '=' );
+
+		if ( separator == std::string::npos || bus_count == BUS_COUNT ) {
+			fprintf( stderr, "usage: %s [--rate N] [--ring DIR] [--ring-slots N] [--capture DIR] SOCKET=serial:PATH[@BAUD]|i2c:PATH|sim:COUNT ...\n", argv[ 0 ] );
+
+			return 1;
+		}
+
+		Bus& bus = buses[ bus_count ];
+		const bool was_local = is_local;
+
+		bus.path = argument.substr( 0, separator );
+		bus.link.reset( make_link( argument.substr( separator + 1 ), is_local ) );
+		bus.file = listen_on( bus.path );
+
+		if ( !bus.link || bus.file < 0 ) {
+			fprintf( stderr, "unable to serve %s\n", argument.c_str( ) );
+
+			return 1;
+		}
+
+		if ( capture_directory != nullptr && !open_capture( bus_count ) )
+			return 1;
+
+		if ( is_local && !was_local ) {
+			local_bus = bus_count;
+
+			LicI2cDevTransport::setObserver( capture_transaction );
+		}
+
+		bus_count += 1;
+	}
+
+	if ( bus_count == 0 ) {
+		fprintf( stderr, "usage: %s [--rate N] [--ring DIR] [--ring-slots N] [--capture DIR] SOCKET=serial:PATH[@BAUD]|i2c:PATH|sim:COUNT ...\n", argv[ 0 ] );
+
+		return 1;
+	}
+
+	signal( SIGINT, stop );
+	signal( SIGTERM, stop );
+	signal( SIGPIPE, SIG_IGN );
+
+	std::vector<struct pollfd> files;
+
+	while ( is_running ) {
+		files.clear( );
+
+		for ( uint8_t bus_id = 0; bus_id < bus_count; bus_id++ ) {
+			files.push_back( { buses[ bus_id ].file, POLLIN, 0 } );
+
+			if ( buses[ bus_id ].link->GetFile( ) >= 0 )
+				files.push_back( { buses[ bus_id ].link->GetFile( ), POLLIN, 0 } );
+		}
+
+		for ( const auto& client : clients )
+			files.push_back( { client.first, (short)( POLLIN | ( client.second.queue.empty( ) ? 0 : POLLOUT ) ), 0 } );
+
+		poll( files.data( ), files.size( ), is_local ? 1 : 50 );
+
+		for ( uint8_t bus_id = 0; bus_id < bus_count; bus_id++ ) {
+			accept_client( bus_id );
+
+			buses[ bus_id ].link->Update( );
+
+			read_bus( bus_id );
+			expire_pending( buses[ bus_id ] );
+		}
+
+		std::vector<int> closed;
+
+		for ( const struct pollfd& file : files ) {
+			std::map<int, Client>::iterator client = clients.find( file.fd );
+
+			if ( client == clients.end( ) )
+				continue;
+
+			if ( ( file.revents & ( POLLIN | POLLHUP | POLLERR ) ) && !read_client( client->second ) )
+				closed.push_back( file.fd );
+		}
+
+		for ( const int file : closed )
+			close_client( file );
+
+		closed.clear( );
+
+		for ( auto& client : clients ) {
+			if ( !flush_client( client.second ) )
+				closed.push_back( client.first );
+		}
+
+		for ( const int file : closed )
+			close_client( file );
+
+		if ( capture_directory != nullptr && ( millis( ) - flush_time ) >= CAPTURE_FLUSH_PERIOD ) {
+			flush_time = millis( );
+
+			for ( uint8_t bus_id = 0; bus_id < bus_count; bus_id++ )
+				buses[ bus_id ].capture->Flush( );
+		}
+	}
+
+	for ( uint8_t bus_id = 0; bus_id < bus_count; bus_id++ ) {
+		close( buses[ bus_id ].file );
+		unlink( buses[ bus_id ].path.c_str( ) );
+
+		buses[ bus_id ].capture.reset( );
+	}
+
+	return 0;
+}
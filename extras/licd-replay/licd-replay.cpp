@@ -0,0 +1,259 @@
+/**
+ * @file licd-replay.cpp
+ * @brief Replays a captured bus session against the real `LicDeviceManager`.
+ *
+ * The slave side of the capture is played by `LicSimReplay` on the simulated
+ * bus, the master side is played by issuing every recorded request through a
+ * `LicDeviceManager` at its recorded time, all under virtual time. The tool
+ * then reports how the manager coped with the recorded traffic, so scheduler
+ * or retry changes can be compared on the exact session that caused a stall.
+ *
+ * ## Master Requests
+ * - A `UUID` poll on the listener address runs `PollDevice`.
+ * - A command write followed by a read of the same device runs `Read`.
+ * - A `REGISTER` write runs `WriteRegisters`.
+ * - A gateway sample not preceded by its read runs `Read` of its size, so
+ *   captures of a serial gateway replay too.
+ *
+ * Recorded addresses are mapped to the addresses the manager assigned to the
+ * same replayed devices. A request issued after its recorded time counts as
+ * lag, the manager was still busy with earlier ones.
+ *
+ * ## Usage
+ * ```
+ * ./licd-replay [--clock HZ] [--retry N] [--retry-delay MS] [--wait MS] CAPTURE
+ * ```
+ *
+ * The options set the simulated bus clock and the `LicDeviceManager`
+ * constructor parameters.
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-replay.cpp -o licd-replay
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <string>
+
+/**
+ * @brief Counters of the master side.
+ **/
+struct Report {
+
+	uint64_t polls = 0;
+	uint64_t requests = 0;
+	uint64_t failures = 0;
+	uint64_t recorded_failures = 0;
+	uint64_t diverged = 0;
+	uint64_t unmapped = 0;
+	uint64_t skipped = 0;
+	uint64_t busy_time = 0;
+	uint64_t max_time = 0;
+	uint64_t lag_count = 0;
+	uint64_t max_lag = 0;
+
+};
+
+static Report report;
+
+/**
+ * @brief Gets the real monotonic time, the host clock is virtual while replaying.
+ *
+ * @return The time (in microseconds).
+ **/
+static uint64_t wall_micros( ) {
+	struct timespec now;
+
+	clock_gettime( CLOCK_MONOTONIC, &now );
+
+	return (uint64_t)now.tv_sec * 1000000 + (uint64_t)( now.tv_nsec / 1000 );
+}
+
+/**
+ * @brief Waits in virtual time for a recorded time, or counts the lag.
+ **/
+static void wait_until( LicSimReplay& replay, const uint64_t timestamp ) {
+	const uint64_t now = micros( );
+
+	if ( now < timestamp ) {
+		licd_host_sleep( timestamp - now );
+		replay.Update( );
+
+		return;
+	}
+
+	if ( now - timestamp > report.max_lag )
+		report.max_lag = now - timestamp;
+
+	report.lag_count += ( now > timestamp ) ? 1 : 0;
+}
+
+/**
+ * @brief Gets the address the manager assigned to a recorded device.
+ *
+ * @return The address, 0 when the manager did not register the device.
+ **/
+static uint8_t map_address( const LicSimReplay& replay, const uint8_t address ) {
+	const LicSimDevice* device = replay.Find( address );
+
+	if ( device == nullptr || device->GetAddress( ) == LICD_LISTENER_ADDRESS )
+		return 0;
+
+	return device->GetAddress( );
+}
+
+/**
+ * @brief Accounts a request run by the manager.
+ **/
+static void account( const uint64_t start, const bool is_done, const bool was_done ) {
+	const uint64_t duration = micros( ) - start;
+
+	report.requests += 1;
+	report.failures += is_done ? 0 : 1;
+	report.recorded_failures += was_done ? 0 : 1;
+	report.diverged += ( is_done != was_done ) ? 1 : 0;
+	report.busy_time += duration;
+	report.max_time = ( duration > report.max_time ) ? duration : report.max_time;
+}
+
+int main( int argc, char** argv ) {
+	uint32_t clock = LICD_DEFAULT_CLOCK;
+	uint32_t retry_count = 5;
+	uint32_t retry_delay = 30;
+	uint32_t wait_delay = 15;
+	const char* path = nullptr;
+
+	for ( int arg_id = 1; arg_id < argc; arg_id++ ) {
+		const std::string argument = argv[ arg_id ];
+
+		if ( argument == "--clock" && arg_id + 1 < argc )
+			clock = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+		else if ( argument == "--retry" && arg_id + 1 < argc )
+			retry_count = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+		else if ( argument == "--retry-delay" && arg_id + 1 < argc )
+			retry_delay = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+		else if ( argument == "--wait" && arg_id + 1 < argc )
+			wait_delay = (uint32_t)strtoul( argv[ ++arg_id ], nullptr, 0 );
+		else
+			path = argv[ arg_id ];
+	}
+
+	LicSimReplay replay;
+
+	if ( path == nullptr || !replay.Open( path ) ) {
+		fprintf( stderr, "usage: %s [--clock HZ] [--retry N] [--retry-delay MS] [--wait MS] CAPTURE\n", argv[ 0 ] );
+
+		return 1;
+	}
+
+	const LicCaptureReader& reader = replay.GetReader( );
+	const uint64_t wall_start = wall_micros( );
+
+	LicSimBus::setClock( clock );
+	replay.Start( );
+
+	LicDeviceManager manager( retry_count, retry_delay, wait_delay );
+	LicCaptureCursor cursor = reader.Find( );
+	const LicCaptureRecord* record = nullptr;
+	const uint8_t* payload = nullptr;
+	uint8_t last_kinds[ LICD_CAPTURE_ADDRESS_COUNT ] = { };
+	uint8_t data[ LICD_FRAME_SIZE ];
+
+	while ( reader.Next( cursor, record, payload ) ) {
+		const uint8_t address = record->address % LICD_CAPTURE_ADDRESS_COUNT;
+		const uint8_t last_kind = last_kinds[ address ];
+
+		last_kinds[ address ] = record->kind;
+
+		if ( address == LICD_LISTENER_ADDRESS ) {
+			if ( record->kind == LICD_CAPTURE_WRITE && record->size > 0 && payload[ 0 ] == LICD_COMMAND_UUID ) {
+				wait_until( replay, record->timestamp );
+
+				manager.PollDevice( );
+				report.polls += 1;
+			}
+
+			continue;
+		}
+
+		uint8_t command = record->command;
+		uint8_t size = 0;
+		bool was_done = record->status == 0;
+
+		if ( record->kind == LICD_CAPTURE_SAMPLE ) {
+			if ( last_kind == LICD_CAPTURE_READ )
+				continue;
+
+			size = ( record->size < LICD_FRAME_SIZE ) ? (uint8_t)record->size : LICD_FRAME_SIZE;
+		} else if ( record->kind == LICD_CAPTURE_WRITE && record->size > 0 ) {
+			LicCaptureCursor next = cursor;
+			const LicCaptureRecord* answer = nullptr;
+			const uint8_t* answer_payload = nullptr;
+
+			command = payload[ 0 ];
+
+			if ( reader.Next( next, answer, answer_payload ) && answer->kind == LICD_CAPTURE_READ && answer->address == record->address ) {
+				cursor = next;
+				size = ( answer->size < LICD_FRAME_SIZE ) ? (uint8_t)answer->size : LICD_FRAME_SIZE;
+				was_done = was_done && answer->status == 0;
+				last_kinds[ address ] = LICD_CAPTURE_READ;
+			} else if ( command != LICD_COMMAND_REGISTER || record->size < 2 ) {
+				report.skipped += 1;
+
+				continue;
+			}
+		} else {
+			report.skipped += 1;
+
+			continue;
+		}
+
+		wait_until( replay, record->timestamp );
+
+		const uint8_t mapped = map_address( replay, address );
+		const uint64_t start = micros( );
+
+		if ( mapped == 0 ) {
+			report.unmapped += 1;
+
+			continue;
+		}
+
+		if ( size > 0 )
+			account( start, manager.Read( mapped, command, data, size ), was_done );
+		else
+			account( start, manager.WriteRegisters( mapped, payload[ 1 ], payload + 2, record->size - 2U ), was_done );
+	}
+
+	const uint64_t virtual_span = micros( ) - replay.GetStart( );
+	const uint64_t wall_time = wall_micros( ) - wall_start;
+	const LicSimReplayStats replay_stats = replay.GetStats( );
+	const LicSimStats bus_stats = LicSimBus::getStats( );
+
+	replay.Stop( );
+
+	printf( "recorded span     %.6f s\n", ( replay.GetEnd( ) - replay.GetStart( ) ) / 1e6 );
+	printf( "replayed span     %.6f s virtual, %.3f s wall\n", virtual_span / 1e6, wall_time / 1e6 );
+	printf( "polls             %llu\n", (unsigned long long)report.polls );
+	printf( "requests          %llu (%llu failed, %llu failed in the capture)\n", (unsigned long long)report.requests, (unsigned long long)report.failures, (unsigned long long)report.recorded_failures );
+	printf( "diverged          %llu\n", (unsigned long long)report.diverged );
+	printf( "unmapped          %llu\n", (unsigned long long)report.unmapped );
+	printf( "skipped records   %llu\n", (unsigned long long)report.skipped );
+	printf( "request time      %.1f us mean, %llu us max\n", report.requests ? (double)report.busy_time / report.requests : 0.0, (unsigned long long)report.max_time );
+	printf( "lag               %llu late requests, %llu us max\n", (unsigned long long)report.lag_count, (unsigned long long)report.max_lag );
+	printf( "recoveries        %u\n", manager.GetRecoveries( ) );
+	printf( "replayed answers  %u (%u missing)\n", replay_stats.answers, replay_stats.misses );
+	printf( "device silences   %u, resets %u\n", replay_stats.silences, replay_stats.resets );
+	printf( "bus               %u transactions, %u NACKs, %.3f ms on the wire\n", bus_stats.transactions, bus_stats.nacks, bus_stats.wire_time / 1e6 );
+
+	return ( report.diverged > 0 ) ? 2 : 0;
+}
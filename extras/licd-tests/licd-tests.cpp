@@ -0,0 +1,807 @@
+/**
+ * @file licd-tests.cpp
+ * @brief Regression checks of the master, run against the simulated bus.
+ *
+ * Each check registers fresh simulated devices with a `LicDeviceManager`
+ * under virtual time and compares what reached the device registers with what
+ * the application asked for. Failed checks are printed, the exit code is the
+ * number of failed checks.
+ *
+ * ## Checks
+ * - `shadow-gap`: two writes staged apart are flushed without touching the
+ *   registers between them.
+ * - `shadow-direct`: a direct write overlapping staged bytes is not overwritten
+ *   by the next flush.
+ * - `payload-min`: writes to a device advertising a payload too small for any
+ *   header fail at once, nothing larger than the payload is sent.
+ * - `crc-write`: register writes to a device advertising CRC support are
+ *   checked, a corrupted write leaves the registers untouched.
+ * - `bulk-stall`: a bulk push to a device rejecting every chunk reports the
+ *   stall instead of a progress.
+ * - `codec-extremes`: signed extremes round-trip through every codec mode.
+ * - `codec-wrap`: a 16-bit counter wrapping around encodes as one byte deltas.
+ * - `codec-full`: a frame buffer too small for every sample keeps the leading
+ *   ones and never writes past its capacity.
+ * - `aggregate-sliding`: a sliding window keeps the exact min and max of its
+ *   samples and a mean that does not drift over a long run.
+ * - `deferred-nack`: a NACK on a command sent with a repeated start reaches the
+ *   NACK counter of the device.
+ * - `cache-free-slot`: a new answer takes an invalidated or expired cache slot
+ *   before evicting a live one, skipped when `LICD_CACHE_SIZE` is 0.
+ * - `ring-stall`: a consumer reading a slot left half written by a dead producer
+ *   returns instead of spinning, POSIX builds only.
+ * - `ring-reset`: a consumer still mapping a ring created again restarts on the
+ *   first sample of the new ring, POSIX builds only.
+ * - `reset-reuse`: a device that resets and registers again gets its address
+ *   back, its previous entry does not stay registered.
+ * - `gateway-resume`: a gateway polls an empty bus without blocking, and a
+ *   subscription streams again once its device attaches back.
+ * - `async-sleep-zero`: a task sleeping 0 in a loop under virtual time lets
+ *   every step return and the other tasks run, C++20 builds only.
+ *
+ * ## Usage
+ * ```
+ * ./licd-tests
+ * ```
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp licd-tests.cpp -o licd-tests
+ * ```
+ *
+ * Build with `-std=c++20` to run the `LicAsyncMaster` checks too.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __unix__ )
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#define TESTS_UUID 0x7E570001
+
+#define TESTS_CHECK( CONDITION )\
+	do {\
+		if ( !( CONDITION ) ) {\
+			fprintf( stderr, "  %s:%d: %s\n", __FILE__, __LINE__, #CONDITION );\
+			is_passed = false;\
+		}\
+	} while ( false )
+
+static uint32_t failures = 0;
+
+/**
+ * @class TestsStream
+ * @brief `Stream` keeping what a `LicGateway` sends, the host never writes.
+ **/
+class TestsStream final : public Stream {
+
+public:
+	uint8_t m_output[ 1024 ];
+	uint32_t m_size = 0;
+
+public:
+	int available( ) override {
+		return 0;
+	};
+
+	int read( ) override {
+		return -1;
+	};
+
+	int peek( ) override {
+		return -1;
+	};
+
+	size_t write( const uint8_t value ) override {
+		if ( m_size >= sizeof( m_output ) )
+			return 0;
+
+		m_output[ m_size++ ] = value;
+
+		return 1;
+	};
+
+};
+
+/**
+ * @brief Prints the outcome of a check and counts the failures.
+ *
+ * @param name Name of the check.
+ * @param is_passed Whether the check passed.
+ **/
+static void report( const char* name, const bool is_passed ) {
+	printf( "%-16s %s\n", name, is_passed ? "ok" : "FAILED" );
+
+	failures += is_passed ? 0 : 1;
+}
+
+/**
+ * @brief Registers one simulated device under virtual time.
+ *
+ * @param manager Manager registering the device.
+ * @return true if the device got an address; false otherwise.
+ **/
+static bool setup_device( LicDeviceManager& manager ) {
+	for ( uint8_t poll_id = 0; poll_id < 4 && !manager.GetIsRegistered( LICD_ADDRESS_SPACE ); poll_id++ )
+		manager.PollDevice( );
+
+	return manager.GetIsRegistered( LICD_ADDRESS_SPACE );
+}
+
+/**
+ * @brief Stages offsets 0 and 10, the registers between must keep their value.
+ **/
+static void check_shadow_gap( ) {
+	const uint8_t live[ 16 ] = { 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF };
+	const uint8_t first = 0x11;
+	const uint8_t second = 0x22;
+	LicSimDevice device( TESTS_UUID );
+	LicDeviceManager manager;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+	TESTS_CHECK( manager.WriteRegisters( LICD_ADDRESS_SPACE, 0, live, sizeof( live ) ) );
+	TESTS_CHECK( manager.Stage( LICD_ADDRESS_SPACE, 0, &first, 1 ) );
+	TESTS_CHECK( manager.Stage( LICD_ADDRESS_SPACE, 10, &second, 1 ) );
+	TESTS_CHECK( manager.Flush( ) );
+
+	const uint8_t* registers = device.GetRegisters( );
+
+	TESTS_CHECK( registers[ 0 ] == first );
+	TESTS_CHECK( registers[ 10 ] == second );
+	TESTS_CHECK( memcmp( registers + 1, live + 1, 9 ) == 0 );
+	TESTS_CHECK( memcmp( registers + 11, live + 11, 5 ) == 0 );
+
+	LicSimBus::detach( &device );
+
+	report( "shadow-gap", is_passed );
+}
+
+/**
+ * @brief Stages a value, overwrites part of it directly, then flushes.
+ *
+ * The staged write at 28 fits the shadow, the one at 30 does not and is sent
+ * at once: the flush must only send the bytes the direct write did not cover.
+ **/
+static void check_shadow_direct( ) {
+	const uint8_t stale[ 4 ] = { 0x51, 0x52, 0x53, 0x54 };
+	const uint8_t fresh[ 4 ] = { 0xF1, 0xF2, 0xF3, 0xF4 };
+	LicSimDevice device( TESTS_UUID );
+	LicDeviceManager manager;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+	TESTS_CHECK( manager.Stage( LICD_ADDRESS_SPACE, LICD_SHADOW_SIZE - 4, stale, 4 ) );
+	TESTS_CHECK( manager.Stage( LICD_ADDRESS_SPACE, LICD_SHADOW_SIZE - 2, fresh, 4 ) );
+	TESTS_CHECK( manager.Flush( ) );
+
+	const uint8_t* registers = device.GetRegisters( );
+
+	TESTS_CHECK( registers[ LICD_SHADOW_SIZE - 4 ] == stale[ 0 ] );
+	TESTS_CHECK( registers[ LICD_SHADOW_SIZE - 3 ] == stale[ 1 ] );
+	TESTS_CHECK( registers[ LICD_SHADOW_SIZE - 2 ] == fresh[ 0 ] );
+	TESTS_CHECK( registers[ LICD_SHADOW_SIZE - 1 ] == fresh[ 1 ] );
+
+	LicSimBus::detach( &device );
+
+	report( "shadow-direct", is_passed );
+}
+
+/**
+ * @brief Writes to a device advertising a 2 bytes payload.
+ *
+ * The payload is kept as advertised, so no write or bulk chunk fits: every
+ * operation must fail instead of looping on empty chunks or overrunning it.
+ **/
+static void check_payload_min( ) {
+	uint8_t values[ 24 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24 };
+	LicSimDevice device( TESTS_UUID, LicCapabilities::make( LICD_CAPABILITY_CLOCK_100K, 2, 0 ) );
+	LicDeviceManager manager;
+	LicBulkTransfer push( LICD_ADDRESS_SPACE, 1, LICD_BULK_PUSH, values, sizeof( values ) );
+	LicBulkTransfer pull( LICD_ADDRESS_SPACE, 1, LICD_BULK_PULL, values, sizeof( values ) );
+	const uint8_t zeros[ sizeof( values ) ] = { };
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+	TESTS_CHECK( manager.GetPayloadSize( LICD_ADDRESS_SPACE ) == 2 );
+	TESTS_CHECK( !manager.WriteRegisters( LICD_ADDRESS_SPACE, 0, values, sizeof( values ) ) );
+	TESTS_CHECK( !manager.Transfer( push, 4 ) );
+	TESTS_CHECK( !manager.Transfer( pull, 4 ) );
+	TESTS_CHECK( memcmp( device.GetRegisters( ), zeros, sizeof( zeros ) ) == 0 );
+
+	LicSimBus::detach( &device );
+
+	report( "payload-min", is_passed );
+}
+
+/**
+ * @brief Writes to a device checking CRCs, then corrupts the next write.
+ **/
+static void check_crc_write( ) {
+	const uint8_t values[ 24 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24 };
+	const uint8_t changed[ 4 ] = { 0xC0, 0xC1, 0xC2, 0xC3 };
+	LicSimDevice device( TESTS_UUID, LicCapabilities::make( LICD_CAPABILITY_CLOCK_100K, 16, LICD_CAPABILITY_CRC ) );
+	LicDeviceManager manager;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+	TESTS_CHECK( manager.WriteRegisters( LICD_ADDRESS_SPACE, 0, values, sizeof( values ) ) );
+	TESTS_CHECK( memcmp( device.GetRegisters( ), values, sizeof( values ) ) == 0 );
+
+	const LicSimFaultEvent flip = { LicSimBus::getStats( ).messages, LICD_SIM_FAULT_BIT_FLIP };
+
+	LicSimBus::setScript( &flip, 1 );
+
+	manager.WriteRegisters( LICD_ADDRESS_SPACE, 4, changed, sizeof( changed ) );
+
+	TESTS_CHECK( memcmp( device.GetRegisters( ), values, sizeof( values ) ) == 0 );
+
+	LicSimBus::clearFaults( );
+	LicSimBus::detach( &device );
+
+	report( "crc-write", is_passed );
+}
+
+/**
+ * @brief Answers a checkpoint of 0 to every bulk status query.
+ **/
+static uint8_t answer_zero( LicSimDevice& device, const uint8_t command, uint8_t* data, const uint8_t size ) {
+	(void)device;
+	(void)command;
+
+	memset( data, 0, size );
+
+	return size;
+}
+
+/**
+ * @brief Pushes an object to a device whose checkpoint never moves.
+ **/
+static void check_bulk_stall( ) {
+	uint8_t object[ 64 ] = { };
+	LicSimDevice device( TESTS_UUID );
+	LicDeviceManager manager;
+	LicBulkTransfer push( LICD_ADDRESS_SPACE, 1, LICD_BULK_PUSH, object, sizeof( object ) );
+	bool is_passed = true;
+
+	device.SetHandlers( nullptr, answer_zero );
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+	TESTS_CHECK( !manager.Transfer( push, 4 ) );
+	TESTS_CHECK( !push.GetIsDone( ) && push.GetOffset( ) == 0 );
+
+	LicSimBus::detach( &device );
+
+	report( "bulk-stall", is_passed );
+}
+
+/**
+ * @brief Encodes then decodes samples in a codec mode.
+ *
+ * @param mode Codec mode.
+ * @param samples Pointer to the samples.
+ * @param count Number of samples.
+ * @return true if every sample came back; false otherwise.
+ **/
+template<typename T>
+static bool round_trip( const LicCodecMode mode, const T* samples, const uint8_t count ) {
+	uint8_t frame[ 255 ];
+	T decoded[ 32 ];
+	const uint8_t size = LicCodec::encode( mode, samples, count, frame, sizeof( frame ) );
+
+	if ( size == 0 || frame[ 1 ] != count )
+		return false;
+
+	return LicCodec::decode( frame, size, decoded, 32 ) == count && memcmp( decoded, samples, count * sizeof( T ) ) == 0;
+}
+
+/**
+ * @brief Round-trips the extremes of every signed sample type.
+ **/
+static void check_codec_extremes( ) {
+	const int8_t bytes[ 6 ] = { INT8_MIN, INT8_MAX, 0, -1, INT8_MIN, 1 };
+	const int16_t words[ 6 ] = { INT16_MIN, INT16_MAX, 0, -1, INT16_MIN, 1 };
+	const int32_t longs[ 6 ] = { INT32_MIN, INT32_MAX, 0, -1, INT32_MIN, 1 };
+	const LicCodecMode modes[ 3 ] = { LICD_CODEC_RAW, LICD_CODEC_VARINT, LICD_CODEC_BITPACK };
+	bool is_passed = true;
+
+	for ( const LicCodecMode mode : modes ) {
+		TESTS_CHECK( round_trip( mode, bytes, 6 ) );
+		TESTS_CHECK( round_trip( mode, words, 6 ) );
+		TESTS_CHECK( round_trip( mode, longs, 6 ) );
+	}
+
+	TESTS_CHECK( LicCodec::unzigzag( LicCodec::zigzag( INT32_MIN ) ) == INT32_MIN );
+	TESTS_CHECK( LicCodec::unzigzag( LicCodec::zigzag( INT32_MAX ) ) == INT32_MAX );
+
+	report( "codec-extremes", is_passed );
+}
+
+/**
+ * @brief Encodes a 16-bit counter wrapping around.
+ **/
+static void check_codec_wrap( ) {
+	const uint16_t counter[ 4 ] = { 0xFFFE, 0xFFFF, 0x0000, 0x0001 };
+	const int16_t signed_counter[ 3 ] = { INT16_MAX, INT16_MIN, INT16_MIN + 1 };
+	uint8_t frame[ 32 ];
+	bool is_passed = true;
+
+	TESTS_CHECK( round_trip( LICD_CODEC_VARINT, counter, 4 ) );
+	TESTS_CHECK( round_trip( LICD_CODEC_BITPACK, counter, 4 ) );
+	TESTS_CHECK( round_trip( LICD_CODEC_VARINT, signed_counter, 3 ) );
+	TESTS_CHECK( round_trip( LICD_CODEC_BITPACK, signed_counter, 3 ) );
+
+	const uint8_t varint_size = LicCodec::encode( LICD_CODEC_VARINT, counter, 4, frame, sizeof( frame ) );
+
+	TESTS_CHECK( varint_size == LICD_CODEC_HEADER_SIZE + 4 );
+
+	const uint8_t bitpack_size = LicCodec::encode( LICD_CODEC_BITPACK, counter, 4, frame, sizeof( frame ) );
+
+	TESTS_CHECK( bitpack_size == LICD_CODEC_HEADER_SIZE + 3 );
+	TESTS_CHECK( frame[ LICD_CODEC_HEADER_SIZE + 1 ] == 2 );
+
+	report( "codec-wrap", is_passed );
+}
+
+/**
+ * @brief Encodes more samples than a frame buffer holds.
+ **/
+static void check_codec_full( ) {
+	int16_t samples[ 32 ];
+	int16_t decoded[ 32 ];
+	uint8_t frame[ 40 ];
+	bool is_passed = true;
+
+	for ( uint8_t sample_id = 0; sample_id < 32; sample_id++ )
+		samples[ sample_id ] = (int16_t)( sample_id * 300 - 4000 );
+
+	const LicCodecMode modes[ 3 ] = { LICD_CODEC_RAW, LICD_CODEC_VARINT, LICD_CODEC_BITPACK };
+
+	for ( const LicCodecMode mode : modes ) {
+		for ( uint8_t capacity = 0; capacity <= 24; capacity++ ) {
+			memset( frame, 0xA5, sizeof( frame ) );
+
+			const uint8_t size = LicCodec::encode( mode, samples, 32, frame, capacity );
+			const uint8_t count = ( size > 0 ) ? LicCodec::decode( frame, size, decoded, 32 ) : 0;
+			bool is_untouched = true;
+
+			for ( uint8_t byte_id = capacity; byte_id < sizeof( frame ); byte_id++ )
+				is_untouched = is_untouched && frame[ byte_id ] == 0xA5;
+
+			TESTS_CHECK( size <= capacity && is_untouched );
+			TESTS_CHECK( capacity < LICD_CODEC_HEADER_SIZE || ( size > 0 && count == frame[ 1 ] && count < 32 ) );
+			TESTS_CHECK( memcmp( decoded, samples, count * sizeof( int16_t ) ) == 0 );
+		}
+	}
+
+	report( "codec-full", is_passed );
+}
+
+/**
+ * @brief Slides a window over a long run of samples, then over a constant tail.
+ **/
+static void check_aggregate_sliding( ) {
+	const uint8_t length = ( LICD_AGGREGATOR_WINDOW < 5 ) ? LICD_AGGREGATOR_WINDOW : 5;
+	LicAggregator aggregator( LICD_WINDOW_SLIDING, length );
+	float samples[ LICD_AGGREGATOR_WINDOW ] = { };
+	uint32_t seed = 1;
+	bool is_passed = true;
+
+	for ( uint32_t sample_id = 0; sample_id < 100003; sample_id++ ) {
+		seed = seed * 1103515245 + 12345;
+
+		const float sample = (float)( ( seed >> 8 ) % 200001 ) / 10.f - 10000.f;
+
+		samples[ sample_id % length ] = sample;
+		aggregator.Push( sample );
+
+		const uint32_t count = ( sample_id + 1 < length ) ? sample_id + 1 : length;
+		float low = samples[ 0 ];
+		float high = samples[ 0 ];
+
+		for ( uint32_t other_id = 1; other_id < count; other_id++ ) {
+			low = ( samples[ other_id ] < low ) ? samples[ other_id ] : low;
+			high = ( samples[ other_id ] > high ) ? samples[ other_id ] : high;
+		}
+
+		const LicAggregate aggregate = aggregator.GetAggregate( );
+
+		if ( aggregate.min != low || aggregate.max != high || aggregate.count != count ) {
+			TESTS_CHECK( aggregate.min == low && aggregate.max == high && aggregate.count == count );
+
+			break;
+		}
+	}
+
+	for ( uint8_t sample_id = 0; sample_id < length; sample_id++ )
+		aggregator.Push( 1.5f );
+
+	const LicAggregate aggregate = aggregator.GetAggregate( );
+
+	TESTS_CHECK( aggregate.window == 100003u + length );
+	TESTS_CHECK( aggregate.min == 1.5f && aggregate.max == 1.5f );
+	TESTS_CHECK( fabs( aggregate.mean - 1.5f ) < 1e-3f );
+	TESTS_CHECK( fabs( aggregate.rms - 1.5f ) < 1e-2f );
+
+	report( "aggregate-sliding", is_passed );
+}
+
+/**
+ * @brief Queries a device over repeated starts, the command is not acknowledged.
+ **/
+static void check_deferred_nack( ) {
+	const uint8_t values[ 4 ] = { 1, 2, 3, 4 };
+	LicSimDevice device( TESTS_UUID, LicCapabilities::make( LICD_CAPABILITY_CLOCK_100K, 16, LICD_CAPABILITY_REPEATED_START ) );
+	LicDeviceManager manager;
+	LicAggregate aggregate;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+
+	const LicSimFaultEvent nack = { LicSimBus::getStats( ).messages, LICD_SIM_FAULT_ADDRESS_NACK };
+
+	LicSimBus::setScript( &nack, 1 );
+
+	TESTS_CHECK( !manager.ReadAggregate( LICD_ADDRESS_SPACE, aggregate ) );
+
+	manager.WriteRegisters( LICD_ADDRESS_SPACE, 0, values, sizeof( values ) );
+
+	TESTS_CHECK( manager.GetStats( LICD_ADDRESS_SPACE ).nack_errors == 1 );
+	TESTS_CHECK( manager.WriteRegisters( LICD_ADDRESS_SPACE, 0, values, sizeof( values ) ) );
+
+	LicSimBus::clearFaults( );
+	LicSimBus::detach( &device );
+
+	report( "deferred-nack", is_passed );
+}
+
+#if LICD_CACHE_SIZE > 0
+
+/**
+ * @brief Fills the read cache, frees a slot, then stores one more answer.
+ **/
+static void check_cache_free_slot( ) {
+	LicReadCache cache;
+	uint8_t data[ 1 ] = { 0 };
+	bool is_passed = true;
+
+	for ( uint8_t command = 0; command < LICD_CACHE_SIZE; command++ )
+		cache.Store( 8, command, data, 1, 0, ( command == LICD_CACHE_SIZE - 1 ) ? 10 : 1000 );
+
+	cache.Invalidate( 8, LICD_CACHE_SIZE - 2 );
+	cache.Store( 9, 0, data, 1, 20, 1000 );
+	cache.Store( 9, 1, data, 1, 20, 1000 );
+
+	for ( uint8_t command = 0; command < LICD_CACHE_SIZE - 2; command++ )
+		TESTS_CHECK( cache.Fetch( 8, command, data, 1, 20 ) );
+
+	TESTS_CHECK( cache.Fetch( 9, 0, data, 1, 20 ) );
+	TESTS_CHECK( cache.Fetch( 9, 1, data, 1, 20 ) );
+
+	report( "cache-free-slot", is_passed );
+}
+
+#endif
+
+#if defined( __unix__ )
+
+#define TESTS_RING_PATH "/tmp/licd-tests.ring"
+
+/**
+ * @brief Leaves a ring slot half written, as a producer dying in `Publish`.
+ *
+ * @param slot_id Index of the slot.
+ * @param head Number of the sample being written.
+ **/
+static void break_ring_slot( const uint32_t slot_id, const uint64_t head ) {
+	const int file = open( TESTS_RING_PATH, O_RDWR );
+	const size_t size = sizeof( LicRingHeader ) + ( slot_id + 1 ) * sizeof( LicRingSlot );
+	void* memory = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0 );
+
+	close( file );
+
+	if ( memory == MAP_FAILED )
+		return;
+
+	LicRingSlot* slots = reinterpret_cast<LicRingSlot*>( static_cast<LicRingHeader*>( memory ) + 1 );
+
+	slots[ slot_id ].sequence.store( 2 * head + 1 );
+
+	munmap( memory, size );
+}
+
+/**
+ * @brief Reads a ring lapped by a sample its producer never finished.
+ **/
+static void check_ring_stall( ) {
+	LicSampleRing producer;
+	LicSampleRing consumer;
+	LicRingSample sample;
+	uint8_t data[ 1 ] = { 0 };
+	bool is_passed = true;
+
+	TESTS_CHECK( producer.Create( TESTS_RING_PATH, 4 ) );
+	TESTS_CHECK( consumer.Open( TESTS_RING_PATH ) );
+
+	for ( uint8_t sample_id = 0; sample_id < 4; sample_id++ )
+		producer.Publish( sample_id, 0, data, 1 );
+
+	break_ring_slot( 0, 4 );
+
+	TESTS_CHECK( consumer.Read( sample ) == LICD_RING_OVERRUN );
+	TESTS_CHECK( sample.sequence == 1 );
+	TESTS_CHECK( consumer.GetLost( ) == 1 );
+
+	unlink( TESTS_RING_PATH );
+
+	report( "ring-stall", is_passed );
+}
+
+/**
+ * @brief Creates a ring again under a consumer.
+ **/
+static void check_ring_reset( ) {
+	LicSampleRing producer;
+	LicSampleRing consumer;
+	LicRingSample sample;
+	uint8_t data[ 1 ] = { 0 };
+	bool is_passed = true;
+
+	TESTS_CHECK( producer.Create( TESTS_RING_PATH, 4 ) );
+	TESTS_CHECK( consumer.Open( TESTS_RING_PATH ) );
+
+	for ( uint8_t sample_id = 0; sample_id < 3; sample_id++ )
+		producer.Publish( sample_id, 0, data, 1 );
+
+	while ( consumer.Read( sample ) != LICD_RING_EMPTY );
+
+	TESTS_CHECK( producer.Create( TESTS_RING_PATH, 2 ) );
+
+	producer.Publish( 0x10, 0, data, 1 );
+
+	TESTS_CHECK( consumer.Read( sample ) == LICD_RING_OK );
+	TESTS_CHECK( sample.sequence == 0 && sample.command == 0x10 );
+	TESTS_CHECK( consumer.Read( sample ) == LICD_RING_EMPTY );
+
+	unlink( TESTS_RING_PATH );
+
+	report( "ring-reset", is_passed );
+}
+
+#endif
+
+/**
+ * @brief Registers a device, resets it, then polls it again.
+ **/
+static void check_reset_reuse( ) {
+	LicSimDevice device( TESTS_UUID );
+	LicDeviceManager manager;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+
+	device.Reset( );
+	manager.PollDevice( );
+
+	TESTS_CHECK( device.GetAddress( ) == LICD_ADDRESS_SPACE );
+	TESTS_CHECK( manager.GetUUID( LICD_ADDRESS_SPACE ) == TESTS_UUID );
+	TESTS_CHECK( !manager.GetIsRegistered( LICD_ADDRESS_SPACE + 1 ) );
+
+	LicSimBus::detach( &device );
+
+	report( "reset-reuse", is_passed );
+}
+
+/**
+ * @brief Parses what a gateway sent and drops it.
+ *
+ * @param port Stream written by the gateway.
+ * @param type Frame type to count.
+ * @param is_framed Cleared when a byte is not part of a valid frame.
+ * @return The number of frames of the type.
+ **/
+static uint32_t count_frames( TestsStream& port, const uint8_t type, bool& is_framed ) {
+	LicGatewayParser parser;
+	uint32_t framed_size = 0;
+	uint32_t count = 0;
+
+	for ( uint32_t byte_id = 0; byte_id < port.m_size; byte_id++ ) {
+		if ( !parser.Push( port.m_output[ byte_id ] ) )
+			continue;
+
+		const LicGatewayFrame& frame = parser.GetFrame( );
+
+		framed_size += LICD_GATEWAY_HEADER_SIZE + frame.size + 2;
+		count += ( frame.type == type ) ? 1 : 0;
+	}
+
+	if ( framed_size != port.m_size )
+		is_framed = false;
+
+	port.m_size = 0;
+
+	return count;
+}
+
+/**
+ * @brief Streams a subscription, unplugs the device, then plugs it back.
+ *
+ * The poll of the empty bus must return at once without errors, and the
+ * subscription must survive the `DETACH` to stream again after the `ATTACH`.
+ **/
+static void check_gateway_resume( ) {
+	LicSimDevice device( TESTS_UUID );
+	LicDeviceManager manager;
+	TestsStream port;
+	LicGateway gateway( manager, port );
+	bool is_framed = true;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( gateway.Subscribe( LICD_ADDRESS_SPACE, 0x10, 4, 10 ) );
+
+	gateway.Update( );
+
+	TESTS_CHECK( count_frames( port, LICD_GATEWAY_DATA, is_framed ) == 1 );
+
+	LicSimBus::detach( &device );
+	device.Reset( );
+
+	for ( uint8_t recovery_id = 0; recovery_id < LICD_RECOVERY_MISSES; recovery_id++ )
+		manager.RecoverBus( );
+	LicClock::sleep( (uint64_t)LICD_GATEWAY_POLL_PERIOD * 1000 );
+
+	const uint32_t start = LicClock::millis( );
+
+	gateway.Update( );
+
+	TESTS_CHECK( LicClock::millis( ) - start < 10 );
+	TESTS_CHECK( manager.GetPollErrors( ) == 0 );
+	TESTS_CHECK( count_frames( port, LICD_GATEWAY_DETACH, is_framed ) == 1 );
+
+	LicSimBus::attach( &device );
+	LicClock::sleep( (uint64_t)LICD_GATEWAY_POLL_PERIOD * 1000 );
+
+	gateway.Update( );
+
+	TESTS_CHECK( count_frames( port, LICD_GATEWAY_DATA, is_framed ) == 1 );
+	TESTS_CHECK( is_framed );
+
+	LicSimBus::detach( &device );
+
+	report( "gateway-resume", is_passed );
+}
+
+#if defined( __linux__ ) && defined( __cpp_impl_coroutine )
+
+static uint32_t async_spins = 0;
+static uint32_t async_reads = 0;
+
+/**
+ * @brief Sleeps 0 in a loop, gives up after 1000 turns.
+ *
+ * @param master Master running the task.
+ **/
+static LicTask<> spin_task( LicAsyncMaster& master ) {
+	for ( uint32_t spin_id = 0; spin_id < 1000; spin_id++ ) {
+		co_await master.Sleep( 0 );
+
+		async_spins += 1;
+	}
+}
+
+/**
+ * @brief Reads the simulated device 4 times.
+ *
+ * @param master Master running the task.
+ **/
+static LicTask<> read_task( LicAsyncMaster& master ) {
+	for ( uint32_t read_id = 0; read_id < 4; read_id++ ) {
+		uint32_t value = 0;
+
+		if ( co_await master.Read( LICD_ADDRESS_SPACE, 0x10, &value, 1 ) )
+			async_reads += 1;
+	}
+}
+
+/**
+ * @brief Steps a master running a task that sleeps 0 next to a reader.
+ *
+ * The virtual clock does not move between steps, so the sleeping task is due
+ * again at once: each step must resume it once, and let the reads run.
+ **/
+static void check_async_sleep_zero( ) {
+	LicSimDevice device( TESTS_UUID );
+	LicDeviceManager manager;
+	bool is_passed = true;
+
+	LicSimBus::attach( &device );
+
+	TESTS_CHECK( setup_device( manager ) );
+
+	{
+		LicAsyncMaster master( manager );
+
+		async_spins = 0;
+		async_reads = 0;
+
+		master.Spawn( spin_task( master ) );
+		master.Spawn( read_task( master ) );
+
+		for ( uint32_t step_id = 0; step_id < 8; step_id++ ) {
+			const uint32_t spins = async_spins;
+
+			master.Step( );
+
+			TESTS_CHECK( async_spins - spins <= 1 );
+		}
+
+		TESTS_CHECK( async_reads == 4 );
+		TESTS_CHECK( master.GetTaskCount( ) == 1 );
+	}
+
+	LicSimBus::detach( &device );
+
+	report( "async-sleep-zero", is_passed );
+}
+
+#endif
+
+int main( ) {
+	licd_host_set_virtual( true, 0 );
+
+	LicSimBus::install( );
+
+	check_shadow_gap( );
+	check_shadow_direct( );
+	check_payload_min( );
+	check_crc_write( );
+	check_bulk_stall( );
+	check_codec_extremes( );
+	check_codec_wrap( );
+	check_codec_full( );
+	check_aggregate_sliding( );
+	check_deferred_nack( );
+
+#if LICD_CACHE_SIZE > 0
+	check_cache_free_slot( );
+#endif
+
+#if defined( __unix__ )
+	check_ring_stall( );
+	check_ring_reset( );
+#endif
+
+	check_reset_reuse( );
+	check_gateway_resume( );
+
+#if defined( __linux__ ) && defined( __cpp_impl_coroutine )
+	check_async_sleep_zero( );
+#endif
+
+	printf( "%u failed\n", failures );
+
+	return (int)failures;
+}
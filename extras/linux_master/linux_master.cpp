@@ -0,0 +1,103 @@
+/**
+ * @file linux_master.cpp
+ * @brief LICD master running on a Linux board through `/dev/i2c-N`.
+ *
+ * Registers the LICD slaves of the bus and reads command 0x10 from each of
+ * them every second. With `--stand-in`, the kernel is replaced by a userspace
+ * stand-in answering as one LICD slave, to run the master on any Linux box.
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src ../../src/licd*.cpp linux_master.cpp -o linux_master
+ * ./linux_master /dev/i2c-1
+ * ./linux_master --stand-in
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <errno.h>
+
+#define STAND_IN_UUID 0x00001234
+#define STAND_IN_COMMAND 0x10
+
+static uint8_t stand_in_address = LICD_LISTENER_ADDRESS;
+static uint8_t stand_in_command = 0;
+static uint16_t stand_in_counter = 0;
+
+/**
+ * @brief Answers an `I2C_RDWR` transaction as one LICD slave.
+ *
+ * @param transaction Transaction sent by `LicI2cDevTransport`.
+ * @return 0 on success, `ENXIO` when the slave does not own the address.
+ **/
+static int stand_in( struct i2c_rdwr_ioctl_data* transaction ) {
+	for ( uint32_t message_id = 0; message_id < transaction->nmsgs; message_id++ ) {
+		struct i2c_msg& message = transaction->msgs[ message_id ];
+
+		if ( message.addr != stand_in_address )
+			return ENXIO;
+
+		if ( !( message.flags & I2C_M_RD ) ) {
+			if ( message.len == 0 )
+				continue;
+
+			stand_in_command = message.buf[ 0 ];
+
+			if ( stand_in_command == LICD_COMMAND_ASSIGN && message.len > 1 )
+				stand_in_address = message.buf[ 1 ];
+
+			continue;
+		}
+
+		memset( message.buf, 0, message.len );
+
+		if ( stand_in_command == LICD_COMMAND_UUID ) {
+			LicDeviceHeader header;
+
+			header.uuid = STAND_IN_UUID;
+			header.flags = LicCapabilities::make( LICD_CAPABILITY_CLOCK_400K, 0, LICD_CAPABILITY_REPEATED_START );
+
+			memcpy( message.buf, &header, ( message.len < sizeof( header ) ) ? message.len : sizeof( header ) );
+		} else if ( stand_in_command == STAND_IN_COMMAND && message.len >= sizeof( uint16_t ) ) {
+			stand_in_counter += 1;
+
+			memcpy( message.buf, &stand_in_counter, sizeof( uint16_t ) );
+		}
+	}
+
+	return 0;
+}
+
+int main( int argc, char** argv ) {
+	if ( argc > 1 && strcmp( argv[ 1 ], "--stand-in" ) == 0 )
+		LicI2cDevTransport::setHandler( stand_in );
+	else if ( argc > 1 )
+		LicI2cDevTransport::setDevice( argv[ 1 ] );
+
+	LicDeviceManager manager;
+
+	for ( ; ; ) {
+		manager.PollDevice( );
+
+		for ( uint8_t device_id = 0; device_id < LICD_DEVICE_COUNT; device_id++ ) {
+			const LicDeviceAddress address = LICD_ADDRESS_SPACE + device_id;
+			uint16_t value = 0;
+
+			if ( !manager.GetIsRegistered( address ) )
+				continue;
+
+			if ( manager.Read( address, STAND_IN_COMMAND, &value, 1 ) )
+				printf( "0x%02X : %u (%lu Hz)\n", address, value, (unsigned long)manager.GetClock( address ) );
+		}
+
+		fflush( stdout );
+		delay( 1000 );
+	}
+
+	return 0;
+}
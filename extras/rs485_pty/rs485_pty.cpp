@@ -0,0 +1,105 @@
+/**
+ * @file rs485_pty.cpp
+ * @brief LICD over RS-485 between two processes joined by a pseudo-terminal.
+ *
+ * The process forks, the child runs a `LicDevice` on the terminal side of the
+ * pseudo-terminal and the parent a `LicDeviceManager` on the other side. The
+ * master registers the slave and reads command 0x10 from it, showing that the
+ * RS-485 transport runs the whole protocol without any hardware.
+ *
+ * ## Build
+ * ```
+ * g++ -std=c++11 -O2 -I../../src '-DLICD_TRANSPORT=LicRs485Transport<LicRs485PosixPort>' \
+ *     ../../src/licd*.cpp rs485_pty.cpp -o rs485_pty
+ * ./rs485_pty
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define SLAVE_COMMAND 0x10
+#define READ_COUNT 1000
+
+static uint16_t slave_counter = 0;
+
+static void receive( int byte_count ) {
+	while ( byte_count-- > 0 )
+		LicTransport::read( );
+}
+
+static void request( ) {
+	slave_counter += 1;
+
+	WireHelper::write( &slave_counter, 1 );
+}
+
+static void run_slave( const int file ) {
+	LicRs485PosixPort::setFile( file );
+
+	LicDevice device( &receive, &request, 0x5A5A );
+
+	for ( ; ; ) {
+		LicTransport::poll( );
+
+		yield( );
+	}
+}
+
+static int run_master( const int file ) {
+	LicRs485PosixPort::setFile( file );
+
+	LicDeviceManager manager;
+	const LicDeviceAddress address = LICD_ADDRESS_SPACE;
+
+	for ( uint8_t poll_id = 0; poll_id < 10 && !manager.GetIsRegistered( address ); poll_id++ )
+		manager.PollDevice( );
+
+	if ( !manager.GetIsRegistered( address ) ) {
+		printf( "slave not registered\n" );
+
+		return 1;
+	}
+
+	const unsigned long start_time = micros( );
+	uint32_t success_count = 0;
+	uint16_t value = 0;
+
+	for ( uint32_t read_id = 0; read_id < READ_COUNT; read_id++ )
+		success_count += manager.Read( address, SLAVE_COMMAND, &value, 1 ) ? 1 : 0;
+
+	const unsigned long duration = micros( ) - start_time;
+
+	printf( "registered 0x%02X, %u/%u reads, last value %u, %.1f us/read\n", address, success_count, READ_COUNT, value, (double)duration / READ_COUNT );
+
+	return ( success_count == READ_COUNT ) ? 0 : 1;
+}
+
+int main( ) {
+	const int master_file = posix_openpt( O_RDWR | O_NOCTTY );
+
+	if ( master_file < 0 || grantpt( master_file ) != 0 || unlockpt( master_file ) != 0 )
+		return 1;
+
+	const pid_t slave_pid = fork( );
+
+	if ( slave_pid == 0 ) {
+		run_slave( open( ptsname( master_file ), O_RDWR | O_NOCTTY ) );
+
+		return 0;
+	}
+
+	const int result = run_master( master_file );
+
+	kill( slave_pid, SIGTERM );
+
+	return result;
+}
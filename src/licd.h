@@ -1,16 +1,33 @@
 /**
  * LICD Library Header
  * 
- * This library use <Wire.h> for I2C.
+ * This library use <Wire.h> for I2C, see `licd_transport.h` for other transports.
  **/
 #ifndef LICD_H_
 #define LICD_H_
 
-#include <Arduino.h>
-#include "licd_globals.h."
+#include "licd_platform.h"
+#include "licd_globals.h"
 #include "licd_commands.h"
+#include "licd_crc.h"
+#include "licd_capabilities.h"
+#include "licd_codec.h"
+#include "licd_clock.h"
+#include "licd_transport.h"
 #include "licd_wire_helper.h"
+#include "licd_aggregator.h"
+#include "licd_read_cache.h"
+#include "licd_shadow_register.h"
+#include "licd_stream_buffer.h"
+#include "licd_bulk_transfer.h"
+#include "licd_firmware.h"
 #include "licd_device.h"
 #include "licd_device_manager.h"
+#include "licd_gateway.h"
+#include "licd_sim.h"
+#include "licd_ring.h"
+#include "licd_capture.h"
+#include "licd_replay.h"
+#include "licd_async.h"
 
 #endif /* !LICD_H_ */
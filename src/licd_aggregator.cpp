@@ -0,0 +1,322 @@
+/**
+ * @file licd_aggregator.cpp
+ * @brief Implementation of on-slave streaming aggregation.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicAggregator
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs the `LicAggregator` with a window mode and length.
+ *
+ * @param mode Window mode.
+ * @param length Number of samples per window.
+ **/
+LicAggregator::LicAggregator(
+	const LicAggregatorMode mode,
+	const uint8_t length
+)
+	: m_mode{ mode },
+	m_length{ length },
+	m_head{ 0 },
+	m_window{ 0 },
+	m_count{ 0 },
+	m_min{ 0.f },
+	m_max{ 0.f },
+	m_sum{ 0.f },
+	m_square{ 0.f },
+	m_sum_error{ 0.f },
+	m_square_error{ 0.f },
+	m_samples{ },
+	m_lows{ },
+	m_highs{ },
+	m_result{ }
+{
+	Setup( mode, length );
+}
+
+/**
+ * @brief Destructor for `LicAggregator`.
+ **/
+LicAggregator::~LicAggregator( ) { }
+
+/**
+ * @brief Changes the window mode and length, then resets the aggregator.
+ *
+ * @param mode Window mode.
+ * @param length Number of samples per window.
+ **/
+void LicAggregator::Setup( const LicAggregatorMode mode, const uint8_t length ) {
+	m_mode = mode;
+	m_length = ( length > 0 ) ? length : 1;
+
+	if ( m_mode == LICD_WINDOW_SLIDING && m_length > LICD_AGGREGATOR_WINDOW )
+		m_length = LICD_AGGREGATOR_WINDOW;
+
+	Reset( );
+}
+
+/**
+ * @brief Drops every accumulated sample and the published aggregate.
+ **/
+void LicAggregator::Reset( ) {
+	m_head = 0;
+	m_window = 0;
+	m_result = LicAggregate( );
+
+	ResetWindow( );
+}
+
+/**
+ * @brief Accumulates a new sample into the current window.
+ *
+ * In tumbling mode the window is published and restarted once it holds `m_length`
+ * samples. In sliding mode the sample replaces the oldest one of the ring once
+ * the window is full, the running sums and queues follow in O(1) amortized.
+ *
+ * @param sample Sample value.
+ **/
+void LicAggregator::Push( const float sample ) {
+	if ( m_mode == LICD_WINDOW_TUMBLING ) {
+		Accumulate( sample );
+
+		if ( m_count >= m_length ) {
+			m_window += 1;
+
+			Publish( m_result );
+			ResetWindow( );
+		}
+	} else
+		Slide( sample );
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Clears the running accumulators of the current window.
+ **/
+void LicAggregator::ResetWindow( ) {
+	m_count = 0;
+	m_min = 0.f;
+	m_max = 0.f;
+	m_sum = 0.f;
+	m_square = 0.f;
+	m_sum_error = 0.f;
+	m_square_error = 0.f;
+	m_lows = LicAggregatorQueue( );
+	m_highs = LicAggregatorQueue( );
+}
+
+/**
+ * @brief Accumulates a sample into the running sums, min and max.
+ *
+ * @param sample Sample value.
+ **/
+void LicAggregator::Accumulate( const float sample ) {
+	if ( m_count == 0 || sample < m_min )
+		m_min = sample;
+
+	if ( m_count == 0 || sample > m_max )
+		m_max = sample;
+
+	m_count += 1;
+	m_sum += sample;
+	m_square += sample * sample;
+}
+
+/**
+ * @brief Slides the window by one sample, evicting the oldest one once it is full.
+ *
+ * The oldest sample lives in the slot the new one is written to, it is removed
+ * from the sums and from the front of the queues first.
+ *
+ * @param sample Sample value.
+ **/
+void LicAggregator::Slide( const float sample ) {
+	if ( m_count == m_length ) {
+		const float oldest = m_samples[ m_head ];
+
+		Add( m_sum, m_sum_error, -oldest );
+		Add( m_square, m_square_error, -oldest * oldest );
+		Dequeue( m_lows );
+		Dequeue( m_highs );
+	} else
+		m_count += 1;
+
+	m_samples[ m_head ] = sample;
+
+	Add( m_sum, m_sum_error, sample );
+	Add( m_square, m_square_error, sample * sample );
+	Enqueue( m_lows, true );
+	Enqueue( m_highs, false );
+
+	m_head = ( m_head + 1 ) % m_length;
+	m_window += 1;
+
+	if ( m_head == 0 )
+		Rebase( );
+}
+
+/**
+ * @brief Sums the ring again, once per turn of the window.
+ *
+ * The compensation keeps the rounding errors of evicted samples out of the
+ * sums, but itself accumulates them over the whole run. Starting over every
+ * `m_length` pushes bounds it to two windows, at O(1) amortized cost.
+ **/
+void LicAggregator::Rebase( ) {
+	m_sum = 0.f;
+	m_square = 0.f;
+	m_sum_error = 0.f;
+	m_square_error = 0.f;
+
+	for ( uint8_t sample_id = 0; sample_id < m_count; sample_id++ ) {
+		const float sample = m_samples[ sample_id ];
+
+		Add( m_sum, m_sum_error, sample );
+		Add( m_square, m_square_error, sample * sample );
+	}
+}
+
+/**
+ * @brief Appends the newest ring slot to a monotonic queue.
+ *
+ * Slots whose sample can no longer be the extremum, older and not better than
+ * the new sample, are dropped from the back first.
+ *
+ * @param queue Queue to append to.
+ * @param is_low Whether the queue keeps the min, the max otherwise.
+ **/
+void LicAggregator::Enqueue( LicAggregatorQueue& queue, const bool is_low ) {
+	const float sample = m_samples[ m_head ];
+
+	while ( queue.count > 0 ) {
+		const uint8_t back = ( queue.first + queue.count - 1 ) % LICD_AGGREGATOR_WINDOW;
+		const float other = m_samples[ queue.slots[ back ] ];
+
+		if ( is_low ? ( other < sample ) : ( other > sample ) )
+			break;
+
+		queue.count -= 1;
+	}
+
+	queue.slots[ ( queue.first + queue.count ) % LICD_AGGREGATOR_WINDOW ] = m_head;
+	queue.count += 1;
+}
+
+/**
+ * @brief Drops the front of a monotonic queue when it is the slot being evicted.
+ *
+ * @param queue Queue to update.
+ **/
+void LicAggregator::Dequeue( LicAggregatorQueue& queue ) {
+	if ( queue.count == 0 || queue.slots[ queue.first ] != m_head )
+		return;
+
+	queue.first = ( queue.first + 1 ) % LICD_AGGREGATOR_WINDOW;
+	queue.count -= 1;
+}
+
+/**
+ * @brief Adds a value to a sum with Kahan compensation.
+ *
+ * Neumaier's variant: the rounding error of each addition is kept apart and
+ * only added back when the sum is read, it also holds when the value is larger
+ * than the sum, as when a large sample leaves the window.
+ *
+ * @param sum Running sum.
+ * @param error Running compensation of the sum.
+ * @param value Value to add, negative to remove a sample.
+ **/
+void LicAggregator::Add( float& sum, float& error, const float value ) {
+	const float total = sum + value;
+
+	if ( fabs( sum ) >= fabs( value ) )
+		error += ( sum - total ) + value;
+	else
+		error += ( value - total ) + sum;
+
+	sum = total;
+}
+
+/**
+ * @brief Copies the running accumulators into an aggregate.
+ *
+ * @param aggregate Aggregate to fill.
+ **/
+void LicAggregator::Publish( LicAggregate& aggregate ) const {
+	aggregate.window = m_window;
+	aggregate.count = m_count;
+	aggregate.min = m_min;
+	aggregate.max = m_max;
+
+	if ( m_count > 0 ) {
+		aggregate.mean = m_sum / m_count;
+		aggregate.rms = sqrt( m_square / m_count );
+	} else {
+		aggregate.mean = 0.f;
+		aggregate.rms = 0.f;
+	}
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the aggregator window mode.
+ *
+ * @return The current window mode.
+ **/
+LicAggregatorMode LicAggregator::GetMode( ) const {
+	return m_mode;
+}
+
+/**
+ * @brief Retrieves the aggregator window length.
+ *
+ * @return The number of samples per window.
+ **/
+uint8_t LicAggregator::GetLength( ) const {
+	return m_length;
+}
+
+/**
+ * @brief Retrieves the aggregate to send to the master.
+ *
+ * In sliding mode the running sums and the queue fronts are read as they are,
+ * the request handler answers in constant time. Removing samples can round the
+ * sum of squares just below 0, it then reads as 0.
+ *
+ * @return The last completed window in tumbling mode, the current window in sliding mode.
+ **/
+LicAggregate LicAggregator::GetAggregate( ) const {
+	if ( m_mode == LICD_WINDOW_TUMBLING )
+		return m_result;
+
+	LicAggregate aggregate;
+
+	aggregate.window = m_window;
+	aggregate.count = m_count;
+
+	if ( m_count > 0 ) {
+		const float sum = m_sum + m_sum_error;
+		const float square = m_square + m_square_error;
+
+		aggregate.min = m_samples[ m_lows.slots[ m_lows.first ] ];
+		aggregate.max = m_samples[ m_highs.slots[ m_highs.first ] ];
+		aggregate.mean = sum / m_count;
+		aggregate.rms = ( square > 0.f ) ? sqrt( square / m_count ) : 0.f;
+	}
+
+	return aggregate;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file licd_aggregator.h
+ * @brief Provides on-slave streaming aggregation for the LICD framework.
+ *
+ * This header defines the `LicAggregator` class, which computes min, max, mean,
+ * RMS and sample count over a window of samples directly on the slave device. The
+ * master fetches the result as a single `LicAggregate` structure instead of pulling
+ * every raw sample over the bus.
+ *
+ * ## Window Modes
+ * - `LICD_WINDOW_TUMBLING`: Samples are grouped into consecutive, non-overlapping
+ *   windows. The published aggregate is the last completed window.
+ * - `LICD_WINDOW_SLIDING`: The published aggregate covers the most recent samples,
+ *   up to the window length.
+ *
+ * ## Usage Example
+ * ```
+ * // Slave
+ * device.GetAggregator( ).Setup( LICD_WINDOW_SLIDING, 8 );
+ * device.Push( analogRead( A0 ) );
+ *
+ * // Master
+ * LicAggregate aggregate;
+ * if ( device_manager.ReadAggregate( address, aggregate ) )
+ *     Serial.println( aggregate.mean );
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_AGGREGATOR_H_
+#define LICD_AGGREGATOR_H_
+
+/**
+ * @brief Window modes supported by `LicAggregator`.
+ **/
+enum LicAggregatorMode : uint8_t {
+
+	LICD_WINDOW_TUMBLING = 0,
+	LICD_WINDOW_SLIDING
+
+};
+
+/**
+ * @brief Aggregate result exchanged between slave and master.
+ * 
+ * All fields are 32-bit wide so the layout is identical on every architecture.
+ **/
+struct LicAggregate {
+
+	uint32_t window = 0;
+	uint32_t count = 0;
+	float min = 0.f;
+	float max = 0.f;
+	float mean = 0.f;
+	float rms = 0.f;
+
+};
+
+/**
+ * @brief Monotonic queue of ring slots, the front slot holds the window extremum.
+ **/
+struct LicAggregatorQueue {
+
+	uint8_t first = 0;
+	uint8_t count = 0;
+	uint8_t slots[ LICD_AGGREGATOR_WINDOW ];
+
+};
+
+/**
+ * @class LicAggregator
+ * @brief Incremental min, max, mean, RMS and count over a sample window.
+ * @author : ALVES Quentin
+ * 
+ * Sums are maintained incrementally on every pushed sample. In sliding mode the
+ * last samples are kept in a fixed ring of `LICD_AGGREGATOR_WINDOW` entries: the
+ * evicted sample is subtracted from compensated (Kahan) sums, and two monotonic
+ * queues of ring slots keep the window min and max, so pushes and fetches cost
+ * O(1) amortized whatever the window length.
+ **/
+class LicAggregator final {
+
+private:
+	LicAggregatorMode m_mode;
+	uint8_t m_length;
+	uint8_t m_head;
+	uint32_t m_window;
+	uint32_t m_count;
+	float m_min;
+	float m_max;
+	float m_sum;
+	float m_square;
+	float m_sum_error;
+	float m_square_error;
+	float m_samples[ LICD_AGGREGATOR_WINDOW ];
+	LicAggregatorQueue m_lows;
+	LicAggregatorQueue m_highs;
+	LicAggregate m_result;
+
+public:
+	/**
+	 * @brief Constructor to initialize the aggregator.
+	 * 
+	 * @param mode Window mode (default: LICD_WINDOW_TUMBLING).
+	 * @param length Number of samples per window (default: LICD_AGGREGATOR_WINDOW).
+	 **/
+	LicAggregator(
+		const LicAggregatorMode mode = LICD_WINDOW_TUMBLING,
+		const uint8_t length = LICD_AGGREGATOR_WINDOW
+	);
+
+	/**
+	 * @brief Destructor for the aggregator.
+	 **/
+	~LicAggregator( );
+
+	/**
+	 * @brief Changes the window mode and length, then resets the aggregator.
+	 * 
+	 * @param mode Window mode.
+	 * @param length Number of samples per window, clamped to [1, LICD_AGGREGATOR_WINDOW]
+	 * in sliding mode and to at least 1 in tumbling mode.
+	 **/
+	void Setup( const LicAggregatorMode mode, const uint8_t length );
+
+	/**
+	 * @brief Drops every accumulated sample and the published aggregate.
+	 **/
+	void Reset( );
+
+	/**
+	 * @brief Accumulates a new sample into the current window.
+	 * 
+	 * @param sample Sample value.
+	 **/
+	void Push( const float sample );
+
+private:
+	/**
+	 * @brief Clears the running accumulators of the current window.
+	 **/
+	void ResetWindow( );
+
+	/**
+	 * @brief Accumulates a sample into the running sums, min and max.
+	 * 
+	 * @param sample Sample value.
+	 **/
+	void Accumulate( const float sample );
+
+	/**
+	 * @brief Slides the window by one sample, evicting the oldest one once it is full.
+	 * 
+	 * @param sample Sample value.
+	 **/
+	void Slide( const float sample );
+
+	/**
+	 * @brief Sums the ring again, once per turn of the window.
+	 **/
+	void Rebase( );
+
+	/**
+	 * @brief Appends the newest ring slot to a monotonic queue.
+	 * 
+	 * @param queue Queue to append to.
+	 * @param is_low Whether the queue keeps the min, the max otherwise.
+	 **/
+	void Enqueue( LicAggregatorQueue& queue, const bool is_low );
+
+	/**
+	 * @brief Drops the front of a monotonic queue when it is the slot being evicted.
+	 * 
+	 * @param queue Queue to update.
+	 **/
+	void Dequeue( LicAggregatorQueue& queue );
+
+	/**
+	 * @brief Adds a value to a sum with Kahan compensation.
+	 * 
+	 * @param sum Running sum.
+	 * @param error Running compensation of the sum.
+	 * @param value Value to add, negative to remove a sample.
+	 **/
+	static void Add( float& sum, float& error, const float value );
+
+	/**
+	 * @brief Copies the running accumulators into an aggregate.
+	 * 
+	 * @param aggregate Aggregate to fill.
+	 **/
+	void Publish( LicAggregate& aggregate ) const;
+
+public:
+	/**
+	 * @brief Retrieves the aggregator window mode.
+	 * 
+	 * @return The current window mode.
+	 **/
+	LicAggregatorMode GetMode( ) const;
+
+	/**
+	 * @brief Retrieves the aggregator window length.
+	 * 
+	 * @return The number of samples per window.
+	 **/
+	uint8_t GetLength( ) const;
+
+	/**
+	 * @brief Retrieves the aggregate to send to the master.
+	 * 
+	 * @return The last completed window in tumbling mode, the current window in sliding mode.
+	 **/
+	LicAggregate GetAggregate( ) const;
+
+};
+
+#endif /* !LICD_AGGREGATOR_H_ */
@@ -0,0 +1,388 @@
+/**
+ * @file licd_async.cpp
+ * @brief Implementation of the `LicAsyncMaster` class.
+ *
+ * Only compiled by Linux host builds with C++20 coroutine support, other
+ * builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __linux__ ) && !defined( ARDUINO ) && defined( __cpp_impl_coroutine )
+
+/**
+ * ====================
+ * LicAsyncRequest
+ * ====================
+ */
+
+/**
+ * @brief Queues the request on its master and suspends the awaiting task.
+ *
+ * @param awaiting Coroutine resumed once the request ran.
+ **/
+void LicAsyncRequest::await_suspend( std::coroutine_handle<> awaiting ) noexcept {
+	handle = awaiting;
+
+	master->Enqueue( *this );
+}
+
+/**
+ * ====================
+ * LicAsyncMaster
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs a `LicAsyncMaster` without task.
+ *
+ * @param manager Device manager running the transactions.
+ **/
+LicAsyncMaster::LicAsyncMaster( LicDeviceManager& manager )
+	: m_manager{ manager },
+	m_tasks{ nullptr },
+	m_starting{ nullptr },
+	m_head{ nullptr },
+	m_tail{ nullptr },
+	m_sleepers{ nullptr },
+	m_task_count{ 0 },
+	m_transaction_count{ 0 }
+{ }
+
+/**
+ * @brief Destructor for `LicAsyncMaster`, destroys the tasks still running.
+ *
+ * Destroying a task destroys the tasks it awaits, their queued requests are
+ * dropped.
+ **/
+LicAsyncMaster::~LicAsyncMaster( ) {
+	DestroyTasks( m_tasks );
+	DestroyTasks( m_starting );
+}
+
+/**
+ * @brief Adds a task, started by the next step.
+ *
+ * Tasks start in the order they were spawned.
+ *
+ * @param task Task to run, the master takes its frame.
+ **/
+void LicAsyncMaster::Spawn( LicTask<void>&& task ) {
+	const std::coroutine_handle<LicTaskPromise<void>> handle = task.Release( );
+
+	if ( !handle )
+		return;
+
+	LicTaskPromiseBase& promise = handle.promise( );
+	LicTaskPromiseBase** last = &m_starting;
+
+	promise.handle = handle;
+	promise.next = nullptr;
+
+	while ( *last != nullptr )
+		last = &( *last )->next;
+
+	*last = &promise;
+	m_task_count += 1;
+}
+
+/**
+ * @brief Runs what is ready: started tasks, due sleeps, then one transaction.
+ *
+ * Each resumed task runs until its next `co_await`. The due sleeps are taken
+ * off the timer list before they resume, a task sleeping again waits for the
+ * next step even when its wake-up time is already past.
+ *
+ * @return true while tasks are running; false once they are all done.
+ **/
+bool LicAsyncMaster::Step( ) {
+	while ( m_starting != nullptr ) {
+		LicTaskPromiseBase* task = m_starting;
+
+		m_starting = task->next;
+		task->next = m_tasks;
+		m_tasks = task;
+
+		task->handle.resume( );
+	}
+
+	const uint64_t now = LicClock::now( );
+	LicAsyncRequest* due = nullptr;
+	LicAsyncRequest** last = &due;
+
+	while ( m_sleepers != nullptr && m_sleepers->time <= now ) {
+		*last = m_sleepers;
+		last = &m_sleepers->next;
+		m_sleepers = m_sleepers->next;
+	}
+
+	*last = nullptr;
+
+	while ( due != nullptr ) {
+		LicAsyncRequest* request = due;
+
+		due = request->next;
+		request->result = true;
+
+		request->handle.resume( );
+	}
+
+	if ( m_head != nullptr ) {
+		LicAsyncRequest* request = m_head;
+
+		m_head = request->next;
+
+		if ( m_head == nullptr )
+			m_tail = nullptr;
+
+		request->result = Execute( *request );
+		m_transaction_count += 1;
+
+		request->handle.resume( );
+	}
+
+	Reap( );
+
+	return m_task_count > 0;
+}
+
+/**
+ * @brief Runs the tasks until they are all done.
+ *
+ * The master sleeps on `LicClock` until the first wake-up when only
+ * sleeping tasks are left.
+ **/
+void LicAsyncMaster::Run( ) {
+	while ( Step( ) ) {
+		if ( m_head == nullptr && m_starting == nullptr && m_sleepers != nullptr )
+			LicClock::sleepUntil( m_sleepers->time );
+	}
+}
+
+/**
+ * @brief Requests a poll for new devices.
+ *
+ * @return Awaitable, always true.
+ **/
+LicAsyncRequest LicAsyncMaster::Poll( ) {
+	LicAsyncRequest request;
+
+	request.master = this;
+	request.kind = LICD_ASYNC_POLL;
+
+	return request;
+}
+
+/**
+ * @brief Requests a write of a device register block.
+ *
+ * @param address I2C address of the device.
+ * @param offset Register offset of the first byte.
+ * @param data Pointer to the data to write, kept alive by the task.
+ * @param size Size of the data in bytes.
+ * @return Awaitable, true if the write succeeded.
+ **/
+LicAsyncRequest LicAsyncMaster::WriteRegisters(
+	const LicDeviceAddress address,
+	const uint8_t offset,
+	const uint8_t* data,
+	const uint32_t size
+) {
+	LicAsyncRequest request;
+
+	request.master = this;
+	request.kind = LICD_ASYNC_WRITE;
+	request.address = address;
+	request.command = offset;
+	request.source = data;
+	request.size = size;
+
+	return request;
+}
+
+/**
+ * @brief Requests any manager operation, run as one queued transaction.
+ *
+ * @param call Function running the operation.
+ * @param context User pointer given to the function.
+ * @return Awaitable, the result of the function.
+ **/
+LicAsyncRequest LicAsyncMaster::Call( LicAsyncCall call, void* context ) {
+	LicAsyncRequest request;
+
+	request.master = this;
+	request.kind = LICD_ASYNC_CALL;
+	request.call = call;
+	request.context = context;
+
+	return request;
+}
+
+/**
+ * @brief Suspends the task without holding the bus.
+ *
+ * The wake-up time is taken when the request is made.
+ *
+ * @param duration Sleep duration (in microseconds).
+ * @return Awaitable, always true.
+ **/
+LicAsyncRequest LicAsyncMaster::Sleep( const uint64_t duration ) {
+	LicAsyncRequest request;
+
+	request.master = this;
+	request.kind = LICD_ASYNC_SLEEP;
+	request.time = LicClock::now( ) + duration;
+
+	return request;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Requests a command and the read of its answer.
+ *
+ * @param address I2C address of the device.
+ * @param command Command code sent before the request.
+ * @param data Pointer to the answer buffer.
+ * @param size Size of the answer in bytes.
+ * @return Awaitable, true if the whole answer was read.
+ **/
+LicAsyncRequest LicAsyncMaster::ReadBytes(
+	const LicDeviceAddress address,
+	const uint8_t command,
+	uint8_t* data,
+	const uint32_t size
+) {
+	LicAsyncRequest request;
+
+	request.master = this;
+	request.kind = LICD_ASYNC_READ;
+	request.address = address;
+	request.command = command;
+	request.data = data;
+	request.size = size;
+
+	return request;
+}
+
+/**
+ * @brief Queues a suspended request.
+ *
+ * Transactions run in the order they were requested, sleeps are kept sorted by
+ * wake-up time.
+ *
+ * @param request Request to queue, sleeps join the timer list.
+ **/
+void LicAsyncMaster::Enqueue( LicAsyncRequest& request ) {
+	request.next = nullptr;
+
+	if ( request.kind == LICD_ASYNC_SLEEP ) {
+		LicAsyncRequest** last = &m_sleepers;
+
+		while ( *last != nullptr && ( *last )->time <= request.time )
+			last = &( *last )->next;
+
+		request.next = *last;
+		*last = &request;
+
+		return;
+	}
+
+	if ( m_tail != nullptr )
+		m_tail->next = &request;
+	else
+		m_head = &request;
+
+	m_tail = &request;
+}
+
+/**
+ * @brief Runs one queued transaction.
+ *
+ * @param request Request to run.
+ * @return The result of the transaction.
+ **/
+bool LicAsyncMaster::Execute( LicAsyncRequest& request ) {
+	switch ( request.kind ) {
+		case LICD_ASYNC_POLL :
+			m_manager.PollDevice( );
+
+			return true;
+
+		case LICD_ASYNC_READ : return m_manager.Read( request.address, request.command, request.data, request.size );
+		case LICD_ASYNC_WRITE : return m_manager.WriteRegisters( request.address, request.command, request.source, request.size );
+		case LICD_ASYNC_CALL : return ( request.call != nullptr ) && request.call( m_manager, request.context );
+
+		default : break;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Destroys the tasks that are done.
+ **/
+void LicAsyncMaster::Reap( ) {
+	LicTaskPromiseBase** link = &m_tasks;
+
+	while ( *link != nullptr ) {
+		LicTaskPromiseBase* task = *link;
+
+		if ( !task->handle.done( ) ) {
+			link = &task->next;
+
+			continue;
+		}
+
+		*link = task->next;
+		m_task_count -= 1;
+
+		task->handle.destroy( );
+	}
+}
+
+/**
+ * @brief Destroys every task of a list.
+ *
+ * @param tasks First task of the list.
+ **/
+void LicAsyncMaster::DestroyTasks( LicTaskPromiseBase* tasks ) {
+	while ( tasks != nullptr ) {
+		LicTaskPromiseBase* next = tasks->next;
+
+		tasks->handle.destroy( );
+
+		tasks = next;
+	}
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the device manager.
+ **/
+LicDeviceManager& LicAsyncMaster::GetManager( ) {
+	return m_manager;
+}
+
+/**
+ * @brief Retrieves the number of running tasks.
+ **/
+uint32_t LicAsyncMaster::GetTaskCount( ) const {
+	return m_task_count;
+}
+
+/**
+ * @brief Retrieves the number of transactions run since construction.
+ **/
+uint32_t LicAsyncMaster::GetTransactionCount( ) const {
+	return m_transaction_count;
+}
+
+#endif
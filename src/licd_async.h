@@ -0,0 +1,461 @@
+/**
+ * @file licd_async.h
+ * @brief Coroutine master API for Linux host builds.
+ *
+ * This header defines `LicTask`, the coroutine type of application dialogs,
+ * and `LicAsyncMaster`, a single-threaded executor running many dialogs over
+ * one `LicDeviceManager`. A dialog awaits bus requests instead of blocking on
+ * them: each request joins the transaction queue of the master, which runs
+ * the queued transactions one at a time, in order, and resumes the dialog with
+ * the result. Dialogs waiting on a device (`co_await master.Sleep( ... )`) do
+ * not hold the bus, the transactions of the other dialogs run meanwhile.
+ *
+ * ## Scheduling
+ * - A resumed dialog runs until its next `co_await`, its next request then
+ *   queues behind the requests of the other dialogs, so the bus is shared round
+ *   robin between dialogs.
+ * - Sleeps are timed on `LicClock`, the virtual clock included, the master
+ *   sleeps until the first wake-up when nothing else is ready.
+ * - Dialogs can await other dialogs, `co_await Configure( master, address )`
+ *   runs the nested dialog to completion and gives its result.
+ * - Requests not covered by the awaitables go through `Call`, which runs any
+ *   manager operation as one queued transaction.
+ *
+ * Exceptions are not supported, an exception leaving a dialog terminates the
+ * program.
+ *
+ * Only compiled with C++20 coroutine support (`-std=c++20`), other builds skip
+ * this header.
+ *
+ * ## Usage Example
+ * ```
+ * LicTask<> Monitor( LicAsyncMaster& master, const LicDeviceAddress address ) {
+ *     uint16_t value = 0;
+ *
+ *     for ( ; ; ) {
+ *         if ( co_await master.Read( address, 0x10, &value, 1 ) )
+ *             printf( "%u\n", value );
+ *
+ *         co_await master.Sleep( 100000 );
+ *     }
+ * }
+ *
+ * LicDeviceManager manager;
+ * LicAsyncMaster master( manager );
+ *
+ * master.Spawn( Monitor( master, 0x02 ) );
+ * master.Spawn( Monitor( master, 0x03 ) );
+ * master.Run( );
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_ASYNC_H_
+#define LICD_ASYNC_H_
+
+#if defined( __linux__ ) && !defined( ARDUINO ) && defined( __cpp_impl_coroutine )
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+
+class LicAsyncMaster;
+
+/**
+ * LicAsyncCall typedef
+ * @note : Runs one manager operation as a queued transaction, the context is
+ *         the pointer given to `LicAsyncMaster::Call`.
+ **/
+typedef bool (*LicAsyncCall)( LicDeviceManager& manager, void* context );
+
+/**
+ * @brief Bus requests of `LicAsyncMaster`.
+ **/
+enum LicAsyncKind : uint8_t {
+
+	LICD_ASYNC_POLL = 0,
+	LICD_ASYNC_READ,
+	LICD_ASYNC_WRITE,
+	LICD_ASYNC_CALL,
+	LICD_ASYNC_SLEEP
+
+};
+
+/**
+ * @brief Part of the `LicTask` promise shared by every result type.
+ **/
+struct LicTaskPromiseBase {
+
+	std::coroutine_handle<> continuation = nullptr;
+	LicTaskPromiseBase* next = nullptr;
+	std::coroutine_handle<> handle = nullptr;
+
+	/**
+	 * @brief Awaiter ending a task, resuming the task awaiting it if any.
+	 **/
+	struct FinalAwaiter {
+
+		bool await_ready( ) const noexcept {
+			return false;
+		};
+
+		template<typename Promise>
+		std::coroutine_handle<> await_suspend( std::coroutine_handle<Promise> handle ) noexcept {
+			const std::coroutine_handle<> continuation = handle.promise( ).continuation;
+
+			return ( continuation != nullptr ) ? continuation : std::noop_coroutine( );
+		};
+
+		void await_resume( ) const noexcept { };
+
+	};
+
+	std::suspend_always initial_suspend( ) const noexcept {
+		return { };
+	};
+
+	FinalAwaiter final_suspend( ) const noexcept {
+		return { };
+	};
+
+	void unhandled_exception( ) const noexcept {
+		std::terminate( );
+	};
+
+};
+
+template<typename T>
+class LicTask;
+
+/**
+ * @brief Promise of a `LicTask` returning a value.
+ **/
+template<typename T>
+struct LicTaskPromise : LicTaskPromiseBase {
+
+	T value = T( );
+
+	LicTask<T> get_return_object( ) noexcept;
+
+	void return_value( const T& result ) noexcept {
+		value = result;
+	};
+
+};
+
+/**
+ * @brief Promise of a `LicTask` returning nothing.
+ **/
+template<>
+struct LicTaskPromise<void> : LicTaskPromiseBase {
+
+	LicTask<void> get_return_object( ) noexcept;
+
+	void return_void( ) const noexcept { };
+
+};
+
+/**
+ * @class LicTask
+ * @brief Coroutine of an application dialog, run by `LicAsyncMaster`.
+ * @author : ALVES Quentin
+ *
+ * A task starts suspended, it runs once spawned on a master or awaited by
+ * another task. The task object owns the coroutine frame.
+ **/
+template<typename T = void>
+class LicTask final {
+
+public:
+	using promise_type = LicTaskPromise<T>;
+
+private:
+	std::coroutine_handle<promise_type> m_handle;
+
+public:
+	/**
+	 * @brief Constructor to take a coroutine frame.
+	 *
+	 * @param handle Handle of the coroutine.
+	 **/
+	explicit LicTask( std::coroutine_handle<promise_type> handle )
+		: m_handle{ handle }
+	{ };
+
+	/**
+	 * @brief Move constructor, the frame changes owner.
+	 **/
+	LicTask( LicTask&& other ) noexcept
+		: m_handle{ other.m_handle }
+	{
+		other.m_handle = nullptr;
+	};
+
+	LicTask( const LicTask& ) = delete;
+
+	LicTask& operator=( const LicTask& ) = delete;
+
+	/**
+	 * @brief Destructor for the task, destroys the frame it still owns.
+	 **/
+	~LicTask( ) {
+		if ( m_handle )
+			m_handle.destroy( );
+	};
+
+	/**
+	 * @brief Gives the frame away, to a master spawning the task.
+	 *
+	 * @return The handle of the coroutine.
+	 **/
+	std::coroutine_handle<promise_type> Release( ) {
+		const std::coroutine_handle<promise_type> handle = m_handle;
+
+		m_handle = nullptr;
+
+		return handle;
+	};
+
+public:
+	bool await_ready( ) const noexcept {
+		return !m_handle || m_handle.done( );
+	};
+
+	std::coroutine_handle<> await_suspend( std::coroutine_handle<> continuation ) noexcept {
+		m_handle.promise( ).continuation = continuation;
+
+		return m_handle;
+	};
+
+	T await_resume( ) const noexcept {
+		if constexpr ( !std::is_void<T>::value )
+			return m_handle.promise( ).value;
+	};
+
+};
+
+template<typename T>
+LicTask<T> LicTaskPromise<T>::get_return_object( ) noexcept {
+	return LicTask<T>( std::coroutine_handle<LicTaskPromise<T>>::from_promise( *this ) );
+}
+
+inline LicTask<void> LicTaskPromise<void>::get_return_object( ) noexcept {
+	return LicTask<void>( std::coroutine_handle<LicTaskPromise<void>>::from_promise( *this ) );
+}
+
+/**
+ * @brief Request of a task, awaited until `LicAsyncMaster` runs it.
+ *
+ * The request lives in the frame of the awaiting task while it is queued, the
+ * queues of the master link requests in place.
+ **/
+struct LicAsyncRequest {
+
+	LicAsyncMaster* master = nullptr;
+	LicAsyncKind kind = LICD_ASYNC_POLL;
+	LicDeviceAddress address = 0;
+	uint8_t command = 0;
+	uint8_t* data = nullptr;
+	const uint8_t* source = nullptr;
+	uint32_t size = 0;
+	LicAsyncCall call = nullptr;
+	void* context = nullptr;
+	uint64_t time = 0;
+	bool result = false;
+	std::coroutine_handle<> handle = nullptr;
+	LicAsyncRequest* next = nullptr;
+
+	bool await_ready( ) const noexcept {
+		return false;
+	};
+
+	void await_suspend( std::coroutine_handle<> awaiting ) noexcept;
+
+	bool await_resume( ) const noexcept {
+		return result;
+	};
+
+};
+
+/**
+ * @class LicAsyncMaster
+ * @brief Single-threaded executor of `LicTask` dialogs over a device manager.
+ * @author : ALVES Quentin
+ **/
+class LicAsyncMaster final {
+
+	friend struct LicAsyncRequest;
+
+private:
+	LicDeviceManager& m_manager;
+	LicTaskPromiseBase* m_tasks;
+	LicTaskPromiseBase* m_starting;
+	LicAsyncRequest* m_head;
+	LicAsyncRequest* m_tail;
+	LicAsyncRequest* m_sleepers;
+	uint32_t m_task_count;
+	uint32_t m_transaction_count;
+
+public:
+	/**
+	 * @brief Constructor to initialize a master without task.
+	 *
+	 * @param manager Device manager running the transactions.
+	 **/
+	LicAsyncMaster( LicDeviceManager& manager );
+
+	/**
+	 * @brief Destructor for the master, destroys the tasks still running.
+	 **/
+	~LicAsyncMaster( );
+
+	/**
+	 * @brief Adds a task, started by the next step.
+	 *
+	 * @param task Task to run, the master takes its frame.
+	 **/
+	void Spawn( LicTask<void>&& task );
+
+	/**
+	 * @brief Runs what is ready: started tasks, due sleeps, then one transaction.
+	 *
+	 * @return true while tasks are running; false once they are all done.
+	 **/
+	bool Step( );
+
+	/**
+	 * @brief Runs the tasks until they are all done.
+	 *
+	 * The master sleeps on `LicClock` until the first wake-up when only
+	 * sleeping tasks are left.
+	 **/
+	void Run( );
+
+	/**
+	 * @brief Requests a poll for new devices.
+	 *
+	 * @return Awaitable, always true.
+	 **/
+	LicAsyncRequest Poll( );
+
+	/**
+	 * @brief Requests a command and the read of its answer.
+	 *
+	 * @tparam T The type of data to be read.
+	 * @param address I2C address of the device.
+	 * @param command Command code sent before the request.
+	 * @param data Pointer to the memory where the read data will be stored, kept alive by the task.
+	 * @param count Number of elements of type T to read (must be >= 1).
+	 * @return Awaitable, true if the whole answer was read.
+	 **/
+	template<typename T>
+	LicAsyncRequest Read(
+		const LicDeviceAddress address,
+		const uint8_t command,
+		T* data,
+		const uint32_t count
+	) {
+		return ReadBytes( address, command, reinterpret_cast<uint8_t*>( data ), sizeof( T ) * count );
+	};
+
+	/**
+	 * @brief Requests a write of a device register block.
+	 *
+	 * @param address I2C address of the device.
+	 * @param offset Register offset of the first byte.
+	 * @param data Pointer to the data to write, kept alive by the task.
+	 * @param size Size of the data in bytes.
+	 * @return Awaitable, true if the write succeeded.
+	 **/
+	LicAsyncRequest WriteRegisters(
+		const LicDeviceAddress address,
+		const uint8_t offset,
+		const uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Requests any manager operation, run as one queued transaction.
+	 *
+	 * @param call Function running the operation.
+	 * @param context User pointer given to the function.
+	 * @return Awaitable, the result of the function.
+	 **/
+	LicAsyncRequest Call( LicAsyncCall call, void* context );
+
+	/**
+	 * @brief Suspends the task without holding the bus.
+	 *
+	 * @param duration Sleep duration (in microseconds).
+	 * @return Awaitable, always true.
+	 **/
+	LicAsyncRequest Sleep( const uint64_t duration );
+
+private:
+	/**
+	 * @brief Requests a command and the read of its answer.
+	 *
+	 * @param address I2C address of the device.
+	 * @param command Command code sent before the request.
+	 * @param data Pointer to the answer buffer.
+	 * @param size Size of the answer in bytes.
+	 * @return Awaitable, true if the whole answer was read.
+	 **/
+	LicAsyncRequest ReadBytes(
+		const LicDeviceAddress address,
+		const uint8_t command,
+		uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Queues a suspended request.
+	 *
+	 * @param request Request to queue, sleeps join the timer list.
+	 **/
+	void Enqueue( LicAsyncRequest& request );
+
+	/**
+	 * @brief Runs one queued transaction.
+	 *
+	 * @param request Request to run.
+	 * @return The result of the transaction.
+	 **/
+	bool Execute( LicAsyncRequest& request );
+
+	/**
+	 * @brief Destroys the tasks that are done.
+	 **/
+	void Reap( );
+
+	/**
+	 * @brief Destroys every task of a list.
+	 *
+	 * @param tasks First task of the list.
+	 **/
+	void DestroyTasks( LicTaskPromiseBase* tasks );
+
+public:
+	/**
+	 * @brief Retrieves the device manager.
+	 **/
+	LicDeviceManager& GetManager( );
+
+	/**
+	 * @brief Retrieves the number of running tasks.
+	 **/
+	uint32_t GetTaskCount( ) const;
+
+	/**
+	 * @brief Retrieves the number of transactions run since construction.
+	 **/
+	uint32_t GetTransactionCount( ) const;
+
+};
+
+#endif
+
+#endif /* !LICD_ASYNC_H_ */
@@ -0,0 +1,163 @@
+/**
+ * @file licd_bulk_transfer.cpp
+ * @brief Implementation of the master-side bulk transfer state.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicBulkTransfer
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an empty `LicBulkTransfer`, already done.
+ **/
+LicBulkTransfer::LicBulkTransfer( )
+	: m_address{ 0 },
+	m_object{ 0 },
+	m_direction{ LICD_BULK_PUSH },
+	m_is_synced{ false },
+	m_is_done{ true },
+	m_data{ nullptr },
+	m_size{ 0 },
+	m_offset{ 0 }
+{ }
+
+/**
+ * @brief Constructs a `LicBulkTransfer`.
+ *
+ * @param address I2C address of the device.
+ * @param object Object identifier understood by the device.
+ * @param direction Direction of the transfer.
+ * @param data Pointer to the object to push, or to the buffer receiving the pulled object.
+ * @param size Size of the object, or of the receiving buffer, in bytes.
+ **/
+LicBulkTransfer::LicBulkTransfer(
+	const uint8_t address,
+	const uint8_t object,
+	const LicBulkDirection direction,
+	uint8_t* data,
+	const uint32_t size
+)
+	: m_address{ address },
+	m_object{ object },
+	m_direction{ direction },
+	m_is_synced{ false },
+	m_is_done{ size == 0 },
+	m_data{ data },
+	m_size{ size },
+	m_offset{ 0 }
+{ }
+
+/**
+ * @brief Destructor for `LicBulkTransfer`.
+ **/
+LicBulkTransfer::~LicBulkTransfer( ) { }
+
+/**
+ * @brief Computes the CRC-16 protecting a bulk chunk.
+ *
+ * @param object Object identifier.
+ * @param offset Chunk offset.
+ * @param data Pointer to the chunk bytes.
+ * @param size Size of the chunk in bytes.
+ * @return The CRC-16 over the object, the little-endian offset and the chunk bytes.
+ **/
+uint16_t LicBulkTransfer::ComputeCRC( 
+	const uint8_t object,
+	const uint32_t offset,
+	const uint8_t* data,
+	const uint32_t size
+) {
+	const uint8_t header[ 5 ] = { 
+		object, 
+		(uint8_t)offset, 
+		(uint8_t)( offset >> 8 ), 
+		(uint8_t)( offset >> 16 ), 
+		(uint8_t)( offset >> 24 ) 
+	};
+
+	return LicCRC::crc16( data, size, LicCRC::crc16( header, 5 ) );
+}
+
+/**
+ * @brief Forces the next step to read the checkpoint from the device again.
+ **/
+void LicBulkTransfer::Desync( ) {
+	m_is_synced = false;
+}
+
+/**
+ * @brief Moves the transfer to a checkpoint.
+ *
+ * @param offset Highest contiguous offset stored by the receiver.
+ **/
+void LicBulkTransfer::Checkpoint( const uint32_t offset ) {
+	m_offset = ( offset < m_size ) ? offset : m_size;
+	m_is_synced = true;
+	m_is_done = ( m_offset == m_size );
+}
+
+/**
+ * @brief Marks the transfer as complete.
+ **/
+void LicBulkTransfer::Complete( ) {
+	m_is_done = true;
+}
+
+// PUBLIC GETTERS
+
+uint8_t LicBulkTransfer::GetAddress( ) const {
+	return m_address;
+}
+
+uint8_t LicBulkTransfer::GetObject( ) const {
+	return m_object;
+}
+
+LicBulkDirection LicBulkTransfer::GetDirection( ) const {
+	return m_direction;
+}
+
+/**
+ * @brief Checks if the checkpoint was read from the device since the last error.
+ *
+ * @return true if the transfer offset matches the device checkpoint; false otherwise.
+ **/
+bool LicBulkTransfer::GetIsSynced( ) const {
+	return m_is_synced;
+}
+
+/**
+ * @brief Checks if the whole object was transferred.
+ *
+ * @return true if the transfer is complete; false otherwise.
+ **/
+bool LicBulkTransfer::GetIsDone( ) const {
+	return m_is_done;
+}
+
+uint8_t* LicBulkTransfer::GetData( ) const {
+	return m_data;
+}
+
+uint32_t LicBulkTransfer::GetSize( ) const {
+	return m_size;
+}
+
+/**
+ * @brief Retrieves the current checkpoint.
+ *
+ * @return The number of contiguous bytes acknowledged by the receiver.
+ **/
+uint32_t LicBulkTransfer::GetOffset( ) const {
+	return m_offset;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file licd_bulk_transfer.h
+ * @brief Provides resumable bulk object transfers for the LICD framework.
+ *
+ * This header defines the `LicBulkTransfer` class, the master-side state of a
+ * large object transfer (calibration table, log, ...) with a slave. Each chunk is
+ * addressed by its offset in the object and the slave acknowledges the highest
+ * contiguous offset it stored. A transfer interrupted by a bus error, a master
+ * reset or a slave reset resumes from that checkpoint instead of restarting.
+ *
+ * ## Directions
+ * - `LICD_BULK_PUSH`: Master to slave, chunks are sent with `LICD_COMMAND_BULK_WRITE`
+ *   and checkpoints are read with `LICD_COMMAND_BULK_STATUS`.
+ * - `LICD_BULK_PULL`: Slave to master, chunks are requested by offset with
+ *   `LICD_COMMAND_BULK_READ`, the checkpoint is the master offset itself.
+ *
+ * Every chunk carries a CRC-16 over its object identifier, offset and bytes, a
+ * corrupted chunk is dropped by its receiver and sent again from the checkpoint.
+ *
+ * ## Usage Example
+ * ```
+ * LicBulkTransfer transfer( address, 1, LICD_BULK_PUSH, table, sizeof( table ) );
+ *
+ * void loop( ) {
+ *     if ( !transfer.GetIsDone( ) )
+ *         device_manager.Transfer( transfer, 4 );
+ * }
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_BULK_TRANSFER_H_
+#define LICD_BULK_TRANSFER_H_
+
+/**
+ * @brief Bytes of a bulk chunk header : command, object, 32-bit offset and CRC-16.
+ **/
+#define LICD_BULK_HEADER_SIZE 8
+
+/**
+ * @brief Largest payload carried by a single bulk chunk.
+ **/
+#define LICD_BULK_CHUNK_SIZE ( LICD_FRAME_SIZE - LICD_BULK_HEADER_SIZE )
+
+/**
+ * @brief Directions of a bulk transfer.
+ **/
+enum LicBulkDirection : uint8_t {
+
+	LICD_BULK_PUSH = 0,
+	LICD_BULK_PULL
+
+};
+
+/**
+ * @class LicBulkTransfer
+ * @brief Master-side state of a resumable bulk object transfer.
+ * @author : ALVES Quentin
+ **/
+class LicBulkTransfer final {
+
+private:
+	uint8_t m_address;
+	uint8_t m_object;
+	LicBulkDirection m_direction;
+	bool m_is_synced;
+	bool m_is_done;
+	uint8_t* m_data;
+	uint32_t m_size;
+	uint32_t m_offset;
+
+public:
+	/**
+	 * @brief Constructor to initialize an empty transfer.
+	 **/
+	LicBulkTransfer( );
+
+	/**
+	 * @brief Constructor to initialize a transfer.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param object Object identifier understood by the device.
+	 * @param direction Direction of the transfer.
+	 * @param data Pointer to the object to push, or to the buffer receiving the pulled object.
+	 * @param size Size of the object, or of the receiving buffer, in bytes.
+	 **/
+	LicBulkTransfer(
+		const uint8_t address,
+		const uint8_t object,
+		const LicBulkDirection direction,
+		uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Destructor for the transfer.
+	 **/
+	~LicBulkTransfer( );
+
+	/**
+	 * @brief Computes the CRC-16 protecting a bulk chunk.
+	 * 
+	 * @param object Object identifier.
+	 * @param offset Chunk offset.
+	 * @param data Pointer to the chunk bytes.
+	 * @param size Size of the chunk in bytes.
+	 * @return The CRC-16 over the object, the little-endian offset and the chunk bytes.
+	 **/
+	static uint16_t ComputeCRC( 
+		const uint8_t object,
+		const uint32_t offset,
+		const uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Forces the next step to read the checkpoint from the device again.
+	 **/
+	void Desync( );
+
+	/**
+	 * @brief Moves the transfer to a checkpoint.
+	 * 
+	 * @param offset Highest contiguous offset stored by the receiver.
+	 **/
+	void Checkpoint( const uint32_t offset );
+
+	/**
+	 * @brief Marks the transfer as complete.
+	 **/
+	void Complete( );
+
+public:
+	uint8_t GetAddress( ) const;
+
+	uint8_t GetObject( ) const;
+
+	LicBulkDirection GetDirection( ) const;
+
+	/**
+	 * @brief Checks if the checkpoint was read from the device since the last error.
+	 * 
+	 * @return true if the transfer offset matches the device checkpoint; false otherwise.
+	 **/
+	bool GetIsSynced( ) const;
+
+	/**
+	 * @brief Checks if the whole object was transferred.
+	 * 
+	 * @return true if the transfer is complete; false otherwise.
+	 **/
+	bool GetIsDone( ) const;
+
+	uint8_t* GetData( ) const;
+
+	uint32_t GetSize( ) const;
+
+	/**
+	 * @brief Retrieves the current checkpoint.
+	 * 
+	 * @return The number of contiguous bytes acknowledged by the receiver.
+	 **/
+	uint32_t GetOffset( ) const;
+
+};
+
+#endif /* !LICD_BULK_TRANSFER_H_ */
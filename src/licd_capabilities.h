@@ -0,0 +1,128 @@
+/**
+ * @file licd_capabilities.h
+ * @brief Defines the capability flags advertised by LICD slave devices.
+ *
+ * A slave advertises its capabilities in the `flags` field of the `LicDeviceHeader`
+ * it answers during registration. The master uses them to talk to every device at
+ * the fastest bus clock and with the largest payload it supports, instead of
+ * pinning the whole bus to its slowest member.
+ *
+ * ## Flags Layout
+ * | Bits  | Content                                                   |
+ * |-------|-----------------------------------------------------------|
+ * | 0-3   | Maximum SCL frequency code (`LICD_CAPABILITY_CLOCK_*`)    |
+ * | 8-15  | Maximum payload in bytes, 0 meaning `LICD_FRAME_SIZE`     |
+ * | 16    | Supports repeated start between a command and its request |
+ * | 17    | Supports CRC protected register writes                    |
+ *
+ * The master never exceeds the advertised payload. Operations whose header
+ * leaves no room for data in it fail instead, a register write needs more than
+ * 2 bytes (4 with CRC), a bulk write more than `LICD_BULK_HEADER_SIZE`.
+ *
+ * With `LICD_CAPABILITY_CRC`, every register write ends with a CRC-16 over its
+ * offset and data, the device drops writes failing it.
+ *
+ * ## Usage Example
+ * ```
+ * LicDevice device( &receive, &request, 0x1234, LicCapabilities::make( LICD_CAPABILITY_CLOCK_400K, 32, LICD_CAPABILITY_REPEATED_START ) );
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_CAPABILITIES_H_
+#define LICD_CAPABILITIES_H_
+
+/**
+ * @brief SCL frequency codes stored in the flags bits 0-3.
+ **/
+#define LICD_CAPABILITY_CLOCK_100K 0x00
+#define LICD_CAPABILITY_CLOCK_400K 0x01
+#define LICD_CAPABILITY_CLOCK_1M 0x02
+#define LICD_CAPABILITY_CLOCK_3M4 0x03
+#define LICD_CAPABILITY_CLOCK_MASK 0x0000000F
+
+/**
+ * @brief Maximum payload stored in the flags bits 8-15.
+ **/
+#define LICD_CAPABILITY_PAYLOAD_SHIFT 8
+#define LICD_CAPABILITY_PAYLOAD_MASK 0x0000FF00
+
+/**
+ * @brief The device accepts a repeated start between a command and its request.
+ **/
+#define LICD_CAPABILITY_REPEATED_START 0x00010000
+
+/**
+ * @brief The device checks a CRC-16 at the end of register writes.
+ **/
+#define LICD_CAPABILITY_CRC 0x00020000
+
+/**
+ * @class LicCapabilities
+ * @brief Provides static helpers to build and read capability flags.
+ * @author : ALVES Quentin
+ **/
+class LicCapabilities final {
+
+public:
+	/**
+	 * @brief Builds capability flags.
+	 * 
+	 * @param clock SCL frequency code (`LICD_CAPABILITY_CLOCK_*`).
+	 * @param payload Maximum payload in bytes, 0 for `LICD_FRAME_SIZE`.
+	 * @param features Feature bits (`LICD_CAPABILITY_REPEATED_START`, `LICD_CAPABILITY_CRC`).
+	 * @return The capability flags.
+	 **/
+	static uint32_t make( const uint8_t clock, const uint8_t payload, const uint32_t features ) {
+		return ( clock & LICD_CAPABILITY_CLOCK_MASK ) | 
+			( (uint32_t)payload << LICD_CAPABILITY_PAYLOAD_SHIFT ) | 
+			( features & ~( LICD_CAPABILITY_CLOCK_MASK | LICD_CAPABILITY_PAYLOAD_MASK ) );
+	};
+
+	/**
+	 * @brief Retrieves the maximum SCL frequency of a device.
+	 * 
+	 * @param flags Capability flags of the device.
+	 * @return The maximum SCL frequency in Hz.
+	 **/
+	static uint32_t clock( const uint32_t flags ) {
+		switch ( flags & LICD_CAPABILITY_CLOCK_MASK ) {
+			case LICD_CAPABILITY_CLOCK_400K : return 400000;
+			case LICD_CAPABILITY_CLOCK_1M : return 1000000;
+			case LICD_CAPABILITY_CLOCK_3M4 : return 3400000;
+
+			default : break;
+		}
+
+		return LICD_DEFAULT_CLOCK;
+	};
+
+	/**
+	 * @brief Retrieves the maximum payload of a device.
+	 * 
+	 * @param flags Capability flags of the device.
+	 * @return The maximum number of bytes per transaction, never above `LICD_FRAME_SIZE`.
+	 **/
+	static uint8_t payload( const uint32_t flags ) {
+		const uint8_t payload = (uint8_t)( ( flags & LICD_CAPABILITY_PAYLOAD_MASK ) >> LICD_CAPABILITY_PAYLOAD_SHIFT );
+
+		return ( payload == 0 || payload > LICD_FRAME_SIZE ) ? LICD_FRAME_SIZE : payload;
+	};
+
+	/**
+	 * @brief Checks if a device advertises a feature.
+	 * 
+	 * @param flags Capability flags of the device.
+	 * @param feature Feature bit.
+	 * @return true if the feature is supported; false otherwise.
+	 **/
+	static bool has( const uint32_t flags, const uint32_t feature ) {
+		return ( flags & feature ) == feature;
+	};
+
+};
+
+#endif /* !LICD_CAPABILITIES_H_ */
@@ -0,0 +1,673 @@
+/**
+ * @file licd_capture.cpp
+ * @brief Implementation of the capture file writer and reader.
+ *
+ * Only compiled by POSIX host builds, Arduino builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __unix__ ) && !defined( ARDUINO )
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * ====================
+ * LicCaptureWriter
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs a closed `LicCaptureWriter`.
+ **/
+LicCaptureWriter::LicCaptureWriter( )
+	: m_file{ -1 },
+	m_segment_size{ 0 },
+	m_segment_offset{ 0 },
+	m_segment{ },
+	m_buffer_size{ 0 },
+	m_last{ 0 }
+{ }
+
+/**
+ * @brief Destructor for `LicCaptureWriter`, closes the capture.
+ **/
+LicCaptureWriter::~LicCaptureWriter( ) {
+	Close( );
+}
+
+/**
+ * @brief Creates a capture file, or appends to an existing one.
+ *
+ * An existing capture keeps its segment size, new records start a segment
+ * after its last one, sealed or not.
+ *
+ * @param path Path of the capture file.
+ * @param segment_size Size of new segments, ignored when appending.
+ * @return true if the capture is open; false otherwise.
+ **/
+bool LicCaptureWriter::Open( const char* path, const uint32_t segment_size ) {
+	Close( );
+
+	const int file = open( path, O_RDWR | O_CREAT, 0644 );
+	LicCaptureHeader header;
+	struct stat status;
+
+	memset( &header, 0, sizeof( header ) );
+
+	if ( file < 0 )
+		return false;
+
+	if ( fstat( file, &status ) != 0 ) {
+		close( file );
+
+		return false;
+	}
+
+	uint32_t segment_id = 0;
+
+	if ( status.st_size == 0 ) {
+		header.magic = LICD_CAPTURE_MAGIC;
+		header.version = LICD_CAPTURE_VERSION;
+		header.header_size = LICD_CAPTURE_HEADER_SIZE;
+		header.segment_size = segment_size;
+
+		const bool is_valid = segment_size >= sizeof( LicCaptureSegment ) + licd_capture_size( 0 )
+			&& ftruncate( file, LICD_CAPTURE_HEADER_SIZE ) == 0
+			&& pwrite( file, &header, sizeof( header ), 0 ) == (ssize_t)sizeof( header );
+
+		if ( !is_valid ) {
+			close( file );
+
+			return false;
+		}
+	} else {
+		const bool is_valid = pread( file, &header, sizeof( header ), 0 ) == (ssize_t)sizeof( header )
+			&& header.magic == LICD_CAPTURE_MAGIC
+			&& header.version == LICD_CAPTURE_VERSION
+			&& header.header_size == LICD_CAPTURE_HEADER_SIZE
+			&& header.segment_size >= sizeof( LicCaptureSegment ) + licd_capture_size( 0 )
+			&& status.st_size >= LICD_CAPTURE_HEADER_SIZE;
+
+		if ( !is_valid ) {
+			close( file );
+
+			return false;
+		}
+
+		const uint64_t data_size = (uint64_t)status.st_size - LICD_CAPTURE_HEADER_SIZE;
+
+		segment_id = (uint32_t)( ( data_size + header.segment_size - 1 ) / header.segment_size );
+	}
+
+	m_file = file;
+	m_segment_size = header.segment_size;
+	m_last = 0;
+
+	if ( !StartSegment( segment_id ) ) {
+		close( m_file );
+
+		m_file = -1;
+
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Appends a record.
+ *
+ * Records are buffered and written by blocks. A record that does not fit in the
+ * current segment seals it and starts the next one, a timestamp older than the
+ * last record is raised to it.
+ *
+ * @param record Record header, its size is the payload size.
+ * @param payload Pointer to the payload.
+ * @return true if the record was appended; false otherwise.
+ **/
+bool LicCaptureWriter::Append( const LicCaptureRecord& record, const uint8_t* payload ) {
+	const uint32_t size = licd_capture_size( record.size );
+	const uint32_t capacity = m_segment_size - (uint32_t)sizeof( LicCaptureSegment );
+
+	if ( m_file < 0 || size > capacity || size > LICD_CAPTURE_BUFFER_SIZE )
+		return false;
+
+	if ( m_segment.used + size > capacity ) {
+		WriteSegment( true );
+
+		if ( !StartSegment( m_segment.index + 1 ) )
+			return false;
+	}
+
+	if ( m_buffer_size + size > LICD_CAPTURE_BUFFER_SIZE && !WriteBuffer( ) )
+		return false;
+
+	LicCaptureRecord* header = reinterpret_cast<LicCaptureRecord*>( m_buffer + m_buffer_size );
+
+	*header = record;
+
+	if ( header->timestamp < m_last )
+		header->timestamp = m_last;
+
+	memcpy( header + 1, payload, record.size );
+	memset( (uint8_t*)( header + 1 ) + record.size, 0, size - sizeof( LicCaptureRecord ) - record.size );
+
+	const uint64_t timestamp = header->timestamp;
+	LicCaptureRange& range = m_segment.ranges[ record.address % LICD_CAPTURE_ADDRESS_COUNT ];
+
+	if ( m_segment.record_count++ == 0 )
+		m_segment.first = timestamp;
+
+	if ( range.count++ == 0 )
+		range.first = timestamp;
+
+	m_segment.last = timestamp;
+	m_segment.used += size;
+	range.last = timestamp;
+	m_buffer_size += size;
+	m_last = timestamp;
+
+	return true;
+}
+
+/**
+ * @brief Appends a decoded device sample.
+ *
+ * @param address Address of the device.
+ * @param command Command code of the sample.
+ * @param timestamp Time of the sample (in microseconds).
+ * @param data Pointer to the sample bytes.
+ * @param size Number of bytes.
+ * @return true if the record was appended; false otherwise.
+ **/
+bool LicCaptureWriter::AppendSample(
+	const uint8_t address,
+	const uint8_t command,
+	const uint64_t timestamp,
+	const uint8_t* data,
+	const uint16_t size
+) {
+	LicCaptureRecord record;
+
+	memset( &record, 0, sizeof( record ) );
+
+	record.timestamp = timestamp;
+	record.size = size;
+	record.kind = LICD_CAPTURE_SAMPLE;
+	record.address = address;
+	record.command = command;
+
+	return Append( record, data );
+}
+
+#if defined( __linux__ )
+/**
+ * @brief Appends the messages of an i2c-dev transaction.
+ *
+ * Every message is a record stamped with the start of the transaction and its
+ * whole duration, the first byte written to a device is kept as command.
+ *
+ * @param transaction Executed transaction.
+ * @param status `Wire` like status of the transaction.
+ * @param start Start time of the transaction (in microseconds).
+ * @param duration Duration of the transaction (in microseconds).
+ **/
+void LicCaptureWriter::AppendTransaction(
+	const struct i2c_rdwr_ioctl_data* transaction,
+	const uint8_t status,
+	const uint64_t start,
+	const uint64_t duration
+) {
+	LicCaptureRecord record;
+
+	memset( &record, 0, sizeof( record ) );
+
+	record.timestamp = start;
+	record.duration = ( duration < UINT32_MAX ) ? (uint32_t)duration : UINT32_MAX;
+	record.status = status;
+
+	for ( uint32_t message_id = 0; message_id < transaction->nmsgs; message_id++ ) {
+		const struct i2c_msg& message = transaction->msgs[ message_id ];
+		const bool is_read = ( message.flags & I2C_M_RD ) != 0;
+
+		record.kind = is_read ? LICD_CAPTURE_READ : LICD_CAPTURE_WRITE;
+		record.address = (uint8_t)message.addr;
+		record.flags = ( message_id > 0 ) ? LICD_CAPTURE_REPEATED : 0;
+		record.size = ( is_read && status != 0 ) ? 0 : message.len;
+
+		if ( !is_read && message.len > 0 )
+			record.command = message.buf[ 0 ];
+
+		Append( record, message.buf );
+	}
+}
+#endif
+
+/**
+ * @brief Writes the buffered records and the segment index.
+ *
+ * The segment stays open, readers scan its records past the index.
+ **/
+void LicCaptureWriter::Flush( ) {
+	if ( m_file >= 0 )
+		WriteSegment( false );
+}
+
+/**
+ * @brief Seals the last segment and closes the capture.
+ *
+ * The file is cut after the last record, the next writer appends a new segment.
+ **/
+void LicCaptureWriter::Close( ) {
+	if ( m_file < 0 )
+		return;
+
+	WriteSegment( true );
+
+	const int result = ftruncate( m_file, (off_t)( m_segment_offset + sizeof( LicCaptureSegment ) + m_segment.used ) );
+
+	(void)result;
+
+	close( m_file );
+
+	m_file = -1;
+	m_buffer_size = 0;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Starts the segment following the current one.
+ *
+ * The whole segment is allocated at once, zeroed by the file system, so the
+ * reader of an unsealed segment stops on the first empty record.
+ *
+ * @param index Index of the new segment.
+ * @return true if the segment was allocated; false otherwise.
+ **/
+bool LicCaptureWriter::StartSegment( const uint32_t index ) {
+	memset( &m_segment, 0, sizeof( m_segment ) );
+
+	m_segment.magic = LICD_CAPTURE_SEGMENT_MAGIC;
+	m_segment.index = index;
+	m_segment_offset = LICD_CAPTURE_HEADER_SIZE + (uint64_t)index * m_segment_size;
+	m_buffer_size = 0;
+
+	if ( ftruncate( m_file, (off_t)( m_segment_offset + m_segment_size ) ) != 0 )
+		return false;
+
+	WriteSegment( false );
+
+	return true;
+}
+
+/**
+ * @brief Writes the buffered records.
+ *
+ * @return true if the records were written; false otherwise.
+ **/
+bool LicCaptureWriter::WriteBuffer( ) {
+	const uint64_t offset = m_segment_offset + sizeof( LicCaptureSegment ) + m_segment.used - m_buffer_size;
+	uint32_t written = 0;
+
+	while ( written < m_buffer_size ) {
+		const ssize_t result = pwrite( m_file, m_buffer + written, m_buffer_size - written, (off_t)( offset + written ) );
+
+		if ( result <= 0 )
+			return false;
+
+		written += (uint32_t)result;
+	}
+
+	m_buffer_size = 0;
+
+	return true;
+}
+
+/**
+ * @brief Writes the segment header.
+ *
+ * The records are written first, an index never covers records missing from
+ * the file.
+ *
+ * @param is_sealed Whether the segment is complete.
+ **/
+void LicCaptureWriter::WriteSegment( const bool is_sealed ) {
+	if ( !WriteBuffer( ) )
+		return;
+
+	m_segment.is_sealed = is_sealed ? 1 : 0;
+
+	const ssize_t result = pwrite( m_file, &m_segment, sizeof( m_segment ), (off_t)m_segment_offset );
+
+	(void)result;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves whether the capture is open.
+ **/
+bool LicCaptureWriter::GetIsOpen( ) const {
+	return m_file >= 0;
+}
+
+/**
+ * ====================
+ * LicCaptureReader
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs a closed `LicCaptureReader`.
+ **/
+LicCaptureReader::LicCaptureReader( )
+	: m_data{ nullptr },
+	m_size{ 0 },
+	m_segment_size{ 0 },
+	m_segment_count{ 0 }
+{ }
+
+/**
+ * @brief Destructor for `LicCaptureReader`, unmaps the capture.
+ **/
+LicCaptureReader::~LicCaptureReader( ) {
+	Close( );
+}
+
+/**
+ * @brief Maps a capture file.
+ *
+ * @param path Path of the capture file.
+ * @return true if the capture is mapped; false otherwise.
+ **/
+bool LicCaptureReader::Open( const char* path ) {
+	Close( );
+
+	const int file = open( path, O_RDONLY );
+	struct stat status;
+
+	if ( file < 0 )
+		return false;
+
+	if ( fstat( file, &status ) != 0 || status.st_size < LICD_CAPTURE_HEADER_SIZE ) {
+		close( file );
+
+		return false;
+	}
+
+	void* memory = mmap( nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, file, 0 );
+
+	close( file );
+
+	if ( memory == MAP_FAILED )
+		return false;
+
+	const LicCaptureHeader* header = static_cast<const LicCaptureHeader*>( memory );
+	const bool is_valid = header->magic == LICD_CAPTURE_MAGIC
+		&& header->version == LICD_CAPTURE_VERSION
+		&& header->header_size == LICD_CAPTURE_HEADER_SIZE
+		&& header->segment_size >= sizeof( LicCaptureSegment ) + licd_capture_size( 0 );
+
+	m_data = static_cast<const uint8_t*>( memory );
+	m_size = (size_t)status.st_size;
+
+	if ( !is_valid ) {
+		Close( );
+
+		return false;
+	}
+
+	const uint64_t data_size = m_size - LICD_CAPTURE_HEADER_SIZE;
+
+	m_segment_size = header->segment_size;
+	m_segment_count = (uint32_t)( ( data_size + m_segment_size - 1 ) / m_segment_size );
+
+	return true;
+}
+
+/**
+ * @brief Unmaps the capture.
+ **/
+void LicCaptureReader::Close( ) {
+	if ( m_data != nullptr )
+		munmap( const_cast<uint8_t*>( m_data ), m_size );
+
+	m_data = nullptr;
+	m_size = 0;
+	m_segment_size = 0;
+	m_segment_count = 0;
+}
+
+/**
+ * @brief Starts a query on the records of a device within a time range.
+ *
+ * @param address Address of the device, `LICD_CAPTURE_ANY` for all records.
+ * @param from First time of the range (in microseconds).
+ * @param to Last time of the range (in microseconds).
+ * @return The cursor of the query.
+ **/
+LicCaptureCursor LicCaptureReader::Find(
+	const uint8_t address,
+	const uint64_t from,
+	const uint64_t to
+) const {
+	LicCaptureCursor cursor;
+
+	cursor.address = address;
+	cursor.from = from;
+	cursor.to = to;
+
+	SkipSegments( cursor );
+
+	return cursor;
+}
+
+/**
+ * @brief Moves a query to its next record.
+ *
+ * The records are not copied, the pointers stay valid until `Close`. The query
+ * ends on the first record past its time range.
+ *
+ * @param cursor Query cursor.
+ * @param record Set to the record header, inside the mapping.
+ * @param payload Set to the record payload, inside the mapping.
+ * @return true if a record was found; false at the end of the query.
+ **/
+bool LicCaptureReader::Next( LicCaptureCursor& cursor, const LicCaptureRecord*& record, const uint8_t*& payload ) const {
+	while ( cursor.segment < m_segment_count ) {
+		const LicCaptureSegment* segment = GetSegment( cursor.segment );
+		const uint32_t limit = GetLimit( cursor.segment );
+
+		while ( segment != nullptr && cursor.offset + sizeof( LicCaptureRecord ) <= limit ) {
+			const uint8_t* records = reinterpret_cast<const uint8_t*>( segment + 1 );
+			const LicCaptureRecord* current = reinterpret_cast<const LicCaptureRecord*>( records + cursor.offset );
+			const uint32_t size = licd_capture_size( current->size );
+
+			if ( current->kind == 0 || cursor.offset + size > limit )
+				break;
+
+			cursor.offset += size;
+
+			if ( current->timestamp > cursor.to ) {
+				cursor.segment = m_segment_count;
+
+				return false;
+			}
+
+			if ( current->timestamp < cursor.from )
+				continue;
+
+			if ( cursor.address != LICD_CAPTURE_ANY && current->address != cursor.address )
+				continue;
+
+			record = current;
+			payload = reinterpret_cast<const uint8_t*>( current + 1 );
+
+			return true;
+		}
+
+		cursor.segment += 1;
+		cursor.offset = 0;
+
+		SkipSegments( cursor );
+	}
+
+	return false;
+}
+
+/**
+ * @brief Computes the time range of the records of a device.
+ *
+ * Sealed segments answer from their index, unsealed ones are scanned.
+ *
+ * @param address Address of the device, `LICD_CAPTURE_ANY` for all records.
+ * @param range Set to the time range and record count.
+ * @return true if the device has records; false otherwise.
+ **/
+bool LicCaptureReader::GetRange( const uint8_t address, LicCaptureRange& range ) const {
+	memset( &range, 0, sizeof( range ) );
+
+	for ( uint32_t segment_id = 0; segment_id < m_segment_count; segment_id++ ) {
+		const LicCaptureSegment* segment = GetSegment( segment_id );
+		LicCaptureRange part;
+
+		if ( segment == nullptr )
+			continue;
+
+		if ( segment->is_sealed ) {
+			if ( address == LICD_CAPTURE_ANY ) {
+				part.first = segment->first;
+				part.last = segment->last;
+				part.count = segment->record_count;
+			} else
+				part = segment->ranges[ address % LICD_CAPTURE_ADDRESS_COUNT ];
+		} else {
+			LicCaptureCursor cursor;
+			const LicCaptureRecord* record = nullptr;
+			const uint8_t* payload = nullptr;
+
+			cursor.segment = segment_id;
+			cursor.address = address;
+			part.count = 0;
+
+			while ( Next( cursor, record, payload ) && cursor.segment == segment_id ) {
+				if ( part.count++ == 0 )
+					part.first = record->timestamp;
+
+				part.last = record->timestamp;
+			}
+		}
+
+		if ( part.count == 0 )
+			continue;
+
+		if ( range.count == 0 )
+			range.first = part.first;
+
+		range.last = part.last;
+		range.count += part.count;
+	}
+
+	return range.count > 0;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Skips the sealed segments without records for a query.
+ *
+ * Unsealed segments have no reliable index and are always scanned.
+ *
+ * @param cursor Query cursor, moved to the next segment to scan.
+ **/
+void LicCaptureReader::SkipSegments( LicCaptureCursor& cursor ) const {
+	while ( cursor.segment < m_segment_count ) {
+		const LicCaptureSegment* segment = GetSegment( cursor.segment );
+
+		if ( segment != nullptr && !segment->is_sealed )
+			return;
+
+		if ( segment != nullptr ) {
+			const bool is_any = cursor.address == LICD_CAPTURE_ANY;
+			const LicCaptureRange& range = segment->ranges[ cursor.address % LICD_CAPTURE_ADDRESS_COUNT ];
+			const uint32_t count = is_any ? segment->record_count : range.count;
+			const uint64_t first = is_any ? segment->first : range.first;
+			const uint64_t last = is_any ? segment->last : range.last;
+
+			if ( count > 0 && first > cursor.to ) {
+				cursor.segment = m_segment_count;
+
+				return;
+			}
+
+			if ( count > 0 && last >= cursor.from )
+				return;
+		}
+
+		cursor.segment += 1;
+		cursor.offset = 0;
+	}
+}
+
+/**
+ * @brief Gets the number of record bytes a segment can hold in the mapping.
+ *
+ * @param segment_id Index of the segment.
+ * @return The limit, counted from the end of the segment header.
+ **/
+uint32_t LicCaptureReader::GetLimit( const uint32_t segment_id ) const {
+	const LicCaptureSegment* segment = GetSegment( segment_id );
+
+	if ( segment == nullptr )
+		return 0;
+
+	const uint64_t offset = LICD_CAPTURE_HEADER_SIZE + (uint64_t)segment_id * m_segment_size + sizeof( LicCaptureSegment );
+	const uint64_t end = offset - sizeof( LicCaptureSegment ) + m_segment_size;
+	const uint64_t limit = ( ( end < m_size ) ? end : m_size ) - offset;
+
+	if ( segment->is_sealed && segment->used < limit )
+		return segment->used;
+
+	return (uint32_t)limit;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the number of segments.
+ **/
+uint32_t LicCaptureReader::GetSegmentCount( ) const {
+	return m_segment_count;
+}
+
+/**
+ * @brief Retrieves a segment header.
+ *
+ * @param segment_id Index of the segment.
+ * @return Pointer to the header inside the mapping, nullptr when invalid.
+ **/
+const LicCaptureSegment* LicCaptureReader::GetSegment( const uint32_t segment_id ) const {
+	const uint64_t offset = LICD_CAPTURE_HEADER_SIZE + (uint64_t)segment_id * m_segment_size;
+
+	if ( m_data == nullptr || segment_id >= m_segment_count || offset + sizeof( LicCaptureSegment ) > m_size )
+		return nullptr;
+
+	const LicCaptureSegment* segment = reinterpret_cast<const LicCaptureSegment*>( m_data + offset );
+
+	return ( segment->magic == LICD_CAPTURE_SEGMENT_MAGIC ) ? segment : nullptr;
+}
+
+#endif
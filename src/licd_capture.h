@@ -0,0 +1,422 @@
+/**
+ * @file licd_capture.h
+ * @brief Capture file format recording LICD bus sessions on host builds.
+ *
+ * This header defines `LicCaptureWriter`, which appends bus traffic and decoded
+ * device samples to a capture file, and `LicCaptureReader`, which maps a capture
+ * file and walks its records without loading it, so multi-gigabyte captures are
+ * scanned and seeked in place.
+ *
+ * ## Layout
+ * `[file header][segment 0][segment 1]...`
+ *
+ * - The file header fills the first `LICD_CAPTURE_HEADER_SIZE` bytes, every
+ *   segment is `segment_size` bytes long but the last one.
+ * - A segment starts with a `LicCaptureSegment` header, followed by records
+ *   aligned on 8 bytes. A record never crosses a segment.
+ * - The segment header is the index of the segment: the time range of all its
+ *   records and, for every address, the time range and count of the records of
+ *   that device. Readers skip whole segments with it.
+ *
+ * ## Records
+ * `[LicCaptureRecord][payload]`, timestamps count microseconds and never go
+ * back in time within a file.
+ *
+ * | Kind     | Payload                                      |
+ * |----------|----------------------------------------------|
+ * | `WRITE`  | Bytes written by the master.                 |
+ * | `READ`   | Bytes read by the master.                    |
+ * | `SAMPLE` | Answer of a device, `command` holds its code. |
+ *
+ * `WRITE` and `READ` records carry the transport status of their transaction,
+ * a record joined to the previous one by a repeated start has the
+ * `LICD_CAPTURE_REPEATED` flag.
+ *
+ * ## Append Only
+ * Records are only appended. A segment header is rewritten on `Flush` and
+ * sealed once the segment is full, a capture cut by a crash keeps its sealed
+ * segments and the reader scans the unsealed one. Opening an existing capture
+ * appends new segments after the last one.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_CAPTURE_H_
+#define LICD_CAPTURE_H_
+
+#if defined( __unix__ ) && !defined( ARDUINO )
+
+/**
+ * @brief Magic number of capture files, "LCAP".
+ **/
+#define LICD_CAPTURE_MAGIC 0x5041434C
+
+/**
+ * @brief Magic number of capture segments, "LSEG".
+ **/
+#define LICD_CAPTURE_SEGMENT_MAGIC 0x4745534C
+
+/**
+ * @brief Version of the capture file layout.
+ **/
+#define LICD_CAPTURE_VERSION 1
+
+/**
+ * @brief Size of the file header area.
+ **/
+#define LICD_CAPTURE_HEADER_SIZE 4096
+
+/**
+ * @brief Number of addresses indexed by a segment, the 7-bit address space.
+ **/
+#define LICD_CAPTURE_ADDRESS_COUNT 128
+
+/**
+ * @brief Address matching every device in reader queries.
+ **/
+#define LICD_CAPTURE_ANY 0xFF
+
+/**
+ * @brief Record flag, the record follows the previous one after a repeated start.
+ **/
+#define LICD_CAPTURE_REPEATED 0x01
+
+/**
+ * @brief Default segment size.
+ **/
+#ifndef LICD_CAPTURE_SEGMENT_SIZE
+#define LICD_CAPTURE_SEGMENT_SIZE ( 1UL << 20 )
+#endif
+
+/**
+ * @brief Size of the writer buffer, records are written by blocks.
+ **/
+#ifndef LICD_CAPTURE_BUFFER_SIZE
+#define LICD_CAPTURE_BUFFER_SIZE ( 64UL << 10 )
+#endif
+
+/**
+ * @brief Capture record kinds.
+ **/
+enum LicCaptureKind : uint8_t {
+
+	LICD_CAPTURE_WRITE = 1,
+	LICD_CAPTURE_READ,
+	LICD_CAPTURE_SAMPLE
+
+};
+
+/**
+ * @brief Capture file header.
+ **/
+struct LicCaptureHeader {
+
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	uint32_t header_size;
+	uint32_t segment_size;
+
+};
+
+/**
+ * @brief Time range and count of the records of a device in a segment.
+ **/
+struct LicCaptureRange {
+
+	uint64_t first;
+	uint64_t last;
+	uint32_t count;
+	uint32_t reserved;
+
+};
+
+/**
+ * @brief Segment header, the index of the segment.
+ **/
+struct LicCaptureSegment {
+
+	uint32_t magic;
+	uint32_t index;
+	uint32_t used;
+	uint32_t record_count;
+	uint8_t is_sealed;
+	uint8_t reserved[ 7 ];
+	uint64_t first;
+	uint64_t last;
+	LicCaptureRange ranges[ LICD_CAPTURE_ADDRESS_COUNT ];
+
+};
+
+/**
+ * @brief Record header, followed by `size` payload bytes.
+ **/
+struct LicCaptureRecord {
+
+	uint64_t timestamp;
+	uint32_t duration;
+	uint16_t size;
+	uint8_t kind;
+	uint8_t address;
+	uint8_t status;
+	uint8_t command;
+	uint8_t flags;
+	uint8_t reserved[ 5 ];
+
+};
+
+/**
+ * @brief Gets the space a record takes in a segment, header and padding included.
+ *
+ * @param size Payload size of the record.
+ * @return The record size, a multiple of 8.
+ **/
+inline uint32_t licd_capture_size( const uint16_t size ) {
+	return ( (uint32_t)sizeof( LicCaptureRecord ) + size + 7 ) & ~7U;
+}
+
+/**
+ * @brief Position of a reader query.
+ **/
+struct LicCaptureCursor {
+
+	uint32_t segment = 0;
+	uint32_t offset = 0;
+	uint8_t address = LICD_CAPTURE_ANY;
+	uint64_t from = 0;
+	uint64_t to = UINT64_MAX;
+
+};
+
+/**
+ * @class LicCaptureWriter
+ * @brief Appends records to a capture file.
+ * @author : ALVES Quentin
+ **/
+class LicCaptureWriter final {
+
+private:
+	int m_file;
+	uint32_t m_segment_size;
+	uint64_t m_segment_offset;
+	LicCaptureSegment m_segment;
+	uint32_t m_buffer_size;
+	uint64_t m_last;
+	uint8_t m_buffer[ LICD_CAPTURE_BUFFER_SIZE ];
+
+public:
+	/**
+	 * @brief Constructor to initialize a closed writer.
+	 **/
+	LicCaptureWriter( );
+
+	/**
+	 * @brief Destructor for the writer, closes the capture.
+	 **/
+	~LicCaptureWriter( );
+
+	/**
+	 * @brief Creates a capture file, or appends to an existing one.
+	 *
+	 * @param path Path of the capture file.
+	 * @param segment_size Size of new segments, ignored when appending.
+	 * @return true if the capture is open; false otherwise.
+	 **/
+	bool Open( const char* path, const uint32_t segment_size = LICD_CAPTURE_SEGMENT_SIZE );
+
+	/**
+	 * @brief Appends a record.
+	 *
+	 * @param record Record header, its size is the payload size.
+	 * @param payload Pointer to the payload.
+	 * @return true if the record was appended; false otherwise.
+	 **/
+	bool Append( const LicCaptureRecord& record, const uint8_t* payload );
+
+	/**
+	 * @brief Appends a decoded device sample.
+	 *
+	 * @param address Address of the device.
+	 * @param command Command code of the sample.
+	 * @param timestamp Time of the sample (in microseconds).
+	 * @param data Pointer to the sample bytes.
+	 * @param size Number of bytes.
+	 * @return true if the record was appended; false otherwise.
+	 **/
+	bool AppendSample(
+		const uint8_t address,
+		const uint8_t command,
+		const uint64_t timestamp,
+		const uint8_t* data,
+		const uint16_t size
+	);
+
+#if defined( __linux__ )
+	/**
+	 * @brief Appends the messages of an i2c-dev transaction.
+	 *
+	 * Matches `LicI2cDevObserver`, a read that failed is recorded without payload.
+	 *
+	 * @param transaction Executed transaction.
+	 * @param status `Wire` like status of the transaction.
+	 * @param start Start time of the transaction (in microseconds).
+	 * @param duration Duration of the transaction (in microseconds).
+	 **/
+	void AppendTransaction(
+		const struct i2c_rdwr_ioctl_data* transaction,
+		const uint8_t status,
+		const uint64_t start,
+		const uint64_t duration
+	);
+#endif
+
+	/**
+	 * @brief Writes the buffered records and the segment index.
+	 **/
+	void Flush( );
+
+	/**
+	 * @brief Seals the last segment and closes the capture.
+	 **/
+	void Close( );
+
+private:
+	/**
+	 * @brief Starts the segment following the current one.
+	 *
+	 * @param index Index of the new segment.
+	 * @return true if the segment was allocated; false otherwise.
+	 **/
+	bool StartSegment( const uint32_t index );
+
+	/**
+	 * @brief Writes the buffered records.
+	 *
+	 * @return true if the records were written; false otherwise.
+	 **/
+	bool WriteBuffer( );
+
+	/**
+	 * @brief Writes the segment header.
+	 *
+	 * @param is_sealed Whether the segment is complete.
+	 **/
+	void WriteSegment( const bool is_sealed );
+
+public:
+	/**
+	 * @brief Retrieves whether the capture is open.
+	 **/
+	bool GetIsOpen( ) const;
+
+};
+
+/**
+ * @class LicCaptureReader
+ * @brief Memory-mapped reader of capture files.
+ * @author : ALVES Quentin
+ **/
+class LicCaptureReader final {
+
+private:
+	const uint8_t* m_data;
+	size_t m_size;
+	uint32_t m_segment_size;
+	uint32_t m_segment_count;
+
+public:
+	/**
+	 * @brief Constructor to initialize a closed reader.
+	 **/
+	LicCaptureReader( );
+
+	/**
+	 * @brief Destructor for the reader, unmaps the capture.
+	 **/
+	~LicCaptureReader( );
+
+	/**
+	 * @brief Maps a capture file.
+	 *
+	 * @param path Path of the capture file.
+	 * @return true if the capture is mapped; false otherwise.
+	 **/
+	bool Open( const char* path );
+
+	/**
+	 * @brief Unmaps the capture.
+	 **/
+	void Close( );
+
+	/**
+	 * @brief Starts a query on the records of a device within a time range.
+	 *
+	 * Sealed segments without matching records are skipped with their index.
+	 *
+	 * @param address Address of the device, `LICD_CAPTURE_ANY` for all records.
+	 * @param from First time of the range (in microseconds).
+	 * @param to Last time of the range (in microseconds).
+	 * @return The cursor of the query.
+	 **/
+	LicCaptureCursor Find(
+		const uint8_t address = LICD_CAPTURE_ANY,
+		const uint64_t from = 0,
+		const uint64_t to = UINT64_MAX
+	) const;
+
+	/**
+	 * @brief Moves a query to its next record.
+	 *
+	 * @param cursor Query cursor.
+	 * @param record Set to the record header, inside the mapping.
+	 * @param payload Set to the record payload, inside the mapping.
+	 * @return true if a record was found; false at the end of the query.
+	 **/
+	bool Next( LicCaptureCursor& cursor, const LicCaptureRecord*& record, const uint8_t*& payload ) const;
+
+	/**
+	 * @brief Computes the time range of the records of a device.
+	 *
+	 * @param address Address of the device, `LICD_CAPTURE_ANY` for all records.
+	 * @param range Set to the time range and record count.
+	 * @return true if the device has records; false otherwise.
+	 **/
+	bool GetRange( const uint8_t address, LicCaptureRange& range ) const;
+
+private:
+	/**
+	 * @brief Skips the sealed segments without records for a query.
+	 *
+	 * @param cursor Query cursor, moved to the next segment to scan.
+	 **/
+	void SkipSegments( LicCaptureCursor& cursor ) const;
+
+	/**
+	 * @brief Gets the number of record bytes a segment can hold in the mapping.
+	 *
+	 * @param segment_id Index of the segment.
+	 * @return The limit, counted from the end of the segment header.
+	 **/
+	uint32_t GetLimit( const uint32_t segment_id ) const;
+
+public:
+	/**
+	 * @brief Retrieves the number of segments.
+	 **/
+	uint32_t GetSegmentCount( ) const;
+
+	/**
+	 * @brief Retrieves a segment header.
+	 *
+	 * @param segment_id Index of the segment.
+	 * @return Pointer to the header inside the mapping, nullptr when invalid.
+	 **/
+	const LicCaptureSegment* GetSegment( const uint32_t segment_id ) const;
+
+};
+
+#endif
+
+#endif /* !LICD_CAPTURE_H_ */
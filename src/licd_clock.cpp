@@ -0,0 +1,221 @@
+/**
+ * @file licd_clock.cpp
+ * @brief Implementation of the `LicSystemClock`, `LicYield` and `LicVirtualClock` classes.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicSystemClock
+ * ====================
+ */
+
+uint32_t LicSystemClock::s_last = 0;
+uint64_t LicSystemClock::s_high = 0;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Gets the time elapsed since the platform started.
+ *
+ * On Arduino a wrap-around of `micros` since the last call carries into the
+ * high 32 bits.
+ *
+ * @return The elapsed time (in microseconds).
+ **/
+uint64_t LicSystemClock::now( ) {
+#if defined( ARDUINO )
+	const uint32_t time = micros( );
+
+	if ( time < s_last )
+		s_high += 1ULL << 32;
+
+	s_last = time;
+
+	return s_high | time;
+#else
+	return licd_host_micros( );
+#endif
+}
+
+/**
+ * @brief Gets the time elapsed since the platform started.
+ *
+ * @return The elapsed time (in milliseconds), wrapping at 32 bits.
+ **/
+uint32_t LicSystemClock::millis( ) {
+	return (uint32_t)( now( ) / 1000 );
+}
+
+/**
+ * @brief Waits for a duration.
+ *
+ * @param duration Duration (in microseconds).
+ **/
+void LicSystemClock::sleep( const uint64_t duration ) {
+#if defined( ARDUINO )
+	if ( duration >= 1000 )
+		delay( (unsigned long)( duration / 1000 ) );
+
+	delayMicroseconds( (unsigned int)( duration % 1000 ) );
+#else
+	licd_host_sleep( duration );
+#endif
+}
+
+/**
+ * @brief Waits until a time of `now`, returns at once when it is past.
+ *
+ * @param time Time to wait for (in microseconds).
+ **/
+void LicSystemClock::sleepUntil( const uint64_t time ) {
+	const uint64_t current = now( );
+
+	if ( time > current )
+		sleep( time - current );
+}
+
+/**
+ * @brief Lets other work run while busy-waiting.
+ **/
+void LicSystemClock::yield( ) {
+	::yield( );
+}
+
+/**
+ * ====================
+ * LicYield
+ * ====================
+ */
+
+LicYieldHook LicYield::s_hook = nullptr;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Sets the hook run by the busy-waits.
+ *
+ * @param hook Function given the waiting time, nullptr to only yield.
+ **/
+void LicYield::setHook( LicYieldHook hook ) {
+	s_hook = hook;
+}
+
+/**
+ * @brief Runs one turn of a busy-wait.
+ *
+ * The hook runs first, then `LicClock::yield`, so a virtual clock still moves
+ * when the hook does not wait.
+ *
+ * @param deadline Time of `LicClock::now` ending the wait (in microseconds).
+ * @return true after yielding; false once the deadline is past.
+ **/
+bool LicYield::run( const uint64_t deadline ) {
+	const uint64_t now = LicClock::now( );
+
+	if ( now > deadline )
+		return false;
+
+	if ( s_hook != nullptr )
+		s_hook( deadline - now );
+
+	LicClock::yield( );
+
+	return true;
+}
+
+/**
+ * ====================
+ * LicVirtualClock
+ * ====================
+ */
+
+uint64_t LicVirtualClock::s_now = 0;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Gets the virtual time.
+ *
+ * @return The virtual time (in microseconds).
+ **/
+uint64_t LicVirtualClock::now( ) {
+#if defined( ARDUINO )
+	return s_now / 1000;
+#else
+	if ( !licd_host_clock( ).is_virtual )
+		licd_host_set_virtual( true, licd_host_micros( ) );
+
+	return licd_host_micros( );
+#endif
+}
+
+/**
+ * @brief Gets the virtual time.
+ *
+ * @return The virtual time (in milliseconds), wrapping at 32 bits.
+ **/
+uint32_t LicVirtualClock::millis( ) {
+	return (uint32_t)( now( ) / 1000 );
+}
+
+/**
+ * @brief Advances the virtual time by a duration.
+ *
+ * @param duration Duration (in microseconds).
+ **/
+void LicVirtualClock::sleep( const uint64_t duration ) {
+	advance( duration * 1000 );
+}
+
+/**
+ * @brief Advances the virtual time up to a time, does nothing when it is past.
+ *
+ * @param time Time to advance to (in microseconds).
+ **/
+void LicVirtualClock::sleepUntil( const uint64_t time ) {
+	const uint64_t current = now( );
+
+	if ( time > current )
+		sleep( time - current );
+}
+
+/**
+ * @brief Advances the virtual time by `LICD_VIRTUAL_YIELD_TIME`.
+ **/
+void LicVirtualClock::yield( ) {
+	advance( LICD_VIRTUAL_YIELD_TIME );
+}
+
+/**
+ * @brief Sets the virtual time.
+ *
+ * @param time New virtual time (in microseconds).
+ **/
+void LicVirtualClock::set( const uint64_t time ) {
+#if defined( ARDUINO )
+	s_now = time * 1000;
+#else
+	licd_host_set_virtual( true, time );
+#endif
+}
+
+/**
+ * @brief Advances the virtual time by a sub-microsecond duration.
+ *
+ * @param duration Duration (in nanoseconds).
+ **/
+void LicVirtualClock::advance( const uint64_t duration ) {
+#if defined( ARDUINO )
+	s_now += duration;
+#else
+	now( );
+
+	licd_host_advance( duration );
+#endif
+}
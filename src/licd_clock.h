@@ -0,0 +1,219 @@
+/**
+ * @file licd_clock.h
+ * @brief Time sources of the LICD library.
+ *
+ * Timeouts, retry delays and cache timestamps of the library go through
+ * `LicClock`, a class selected at compile time with `LICD_CLOCK`, as the
+ * transport is with `LICD_TRANSPORT`. The system clock is used by default, the
+ * virtual clock makes timing-dependent code deterministic: time only moves
+ * when the library sleeps or yields, so a simulated session runs as fast as
+ * the processor allows and gives the same timings on every run.
+ *
+ * ## Clock Concept
+ * | Method                 | Role                                              |
+ * |------------------------|---------------------------------------------------|
+ * | `now( )`               | Time elapsed since an arbitrary origin (in us)    |
+ * | `millis( )`            | Same time, truncated to 32-bit milliseconds       |
+ * | `sleep( duration )`    | Waits for a duration (in microseconds)            |
+ * | `sleepUntil( time )`   | Waits until a time of `now`                       |
+ * | `yield( )`             | Lets other work run while busy-waiting            |
+ *
+ * ## Clocks
+ * - `LicSystemClock`: `micros`, `delay` and `yield` of the platform. On Arduino
+ *   `now` extends the 32-bit `micros`, it must be read at least once per
+ *   wrap-around (71 minutes). On host builds it follows the host clock, virtual
+ *   or not (see `licd_platform.h`).
+ * - `LicVirtualClock`: a counter moved by `sleep`, `sleepUntil`, `yield` and
+ *   `advance`. On host builds it is the virtual host clock, switched on by its
+ *   first use, so the simulated bus moves it by the wire time it models.
+ *
+ * Bit-level line timings (bus recovery pulses, RS-485 turnaround and gaps) keep
+ * the platform delays, they time the hardware rather than the protocol.
+ *
+ * ## Busy-Waits
+ * Loops waiting on a peer (`WireHelper::wait`, the RS-485 and SPI answers) run
+ * `LicYield::run` on every turn, against a deadline of `now` in microseconds.
+ * It calls the yield hook, with the time left before the deadline, then
+ * `LicClock::yield`. The hook gives the waiting time back to the firmware, a
+ * cooperative scheduler step or an RTOS delay:
+ * ```
+ * void give_back( const uint64_t remaining ) {
+ *     vTaskDelay( ( remaining > 1000 ) ? 1 : 0 );
+ * }
+ *
+ * LicYield::setHook( give_back );
+ * ```
+ *
+ * ## Usage Example
+ * ```
+ * // Build flags, or a define visible to every library translation unit.
+ * #define LICD_CLOCK LicVirtualClock
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_CLOCK_H_
+#define LICD_CLOCK_H_
+
+#if defined( LICD_CLOCK_HEADER )
+#include LICD_CLOCK_HEADER
+#endif
+
+/**
+ * @brief Time advanced by `LicVirtualClock::yield` (in nanoseconds).
+ **/
+#ifndef LICD_VIRTUAL_YIELD_TIME
+#define LICD_VIRTUAL_YIELD_TIME 1000
+#endif
+
+/**
+ * @class LicSystemClock
+ * @brief Clock of the platform.
+ * @author : ALVES Quentin
+ **/
+class LicSystemClock final {
+
+private:
+	static uint32_t s_last;
+	static uint64_t s_high;
+
+public:
+	/**
+	 * @brief Gets the time elapsed since the platform started.
+	 *
+	 * @return The elapsed time (in microseconds).
+	 **/
+	static uint64_t now( );
+
+	/**
+	 * @brief Gets the time elapsed since the platform started.
+	 *
+	 * @return The elapsed time (in milliseconds), wrapping at 32 bits.
+	 **/
+	static uint32_t millis( );
+
+	/**
+	 * @brief Waits for a duration.
+	 *
+	 * @param duration Duration (in microseconds).
+	 **/
+	static void sleep( const uint64_t duration );
+
+	/**
+	 * @brief Waits until a time of `now`, returns at once when it is past.
+	 *
+	 * @param time Time to wait for (in microseconds).
+	 **/
+	static void sleepUntil( const uint64_t time );
+
+	/**
+	 * @brief Lets other work run while busy-waiting.
+	 **/
+	static void yield( );
+
+};
+
+/**
+ * @class LicVirtualClock
+ * @brief Clock only moved by the library.
+ * @author : ALVES Quentin
+ **/
+class LicVirtualClock final {
+
+private:
+	static uint64_t s_now;
+
+public:
+	/**
+	 * @brief Gets the virtual time.
+	 *
+	 * @return The virtual time (in microseconds).
+	 **/
+	static uint64_t now( );
+
+	/**
+	 * @brief Gets the virtual time.
+	 *
+	 * @return The virtual time (in milliseconds), wrapping at 32 bits.
+	 **/
+	static uint32_t millis( );
+
+	/**
+	 * @brief Advances the virtual time by a duration.
+	 *
+	 * @param duration Duration (in microseconds).
+	 **/
+	static void sleep( const uint64_t duration );
+
+	/**
+	 * @brief Advances the virtual time up to a time, does nothing when it is past.
+	 *
+	 * @param time Time to advance to (in microseconds).
+	 **/
+	static void sleepUntil( const uint64_t time );
+
+	/**
+	 * @brief Advances the virtual time by `LICD_VIRTUAL_YIELD_TIME`.
+	 **/
+	static void yield( );
+
+	/**
+	 * @brief Sets the virtual time.
+	 *
+	 * @param time New virtual time (in microseconds).
+	 **/
+	static void set( const uint64_t time );
+
+	/**
+	 * @brief Advances the virtual time by a sub-microsecond duration.
+	 *
+	 * @param duration Duration (in nanoseconds).
+	 **/
+	static void advance( const uint64_t duration );
+
+};
+
+/**
+ * @brief Clock used by the LICD protocol, see `LICD_CLOCK`.
+ **/
+typedef LICD_CLOCK LicClock;
+
+/**
+ * LicYieldHook typedef
+ * @note : Called in busy-waits with the time left before their deadline (in
+ *         microseconds).
+ **/
+typedef void (*LicYieldHook)( const uint64_t remaining );
+
+/**
+ * @class LicYield
+ * @brief Yield hook run by the busy-waits of the library.
+ * @author : ALVES Quentin
+ **/
+class LicYield final {
+
+private:
+	static LicYieldHook s_hook;
+
+public:
+	/**
+	 * @brief Sets the hook run by the busy-waits.
+	 *
+	 * @param hook Function given the waiting time, nullptr to only yield.
+	 **/
+	static void setHook( LicYieldHook hook );
+
+	/**
+	 * @brief Runs one turn of a busy-wait.
+	 *
+	 * @param deadline Time of `LicClock::now` ending the wait (in microseconds).
+	 * @return true after yielding; false once the deadline is past.
+	 **/
+	static bool run( const uint64_t deadline );
+
+};
+
+#endif /* !LICD_CLOCK_H_ */
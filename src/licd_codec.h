@@ -0,0 +1,419 @@
+/**
+ * @file licd_codec.h
+ * @brief Provides compact encodings for sample streams exchanged over LICD.
+ *
+ * This header defines the `LicCodec` class, which packs integer sample streams
+ * into self-contained frames before they are sent over the bus. Each sample is
+ * stored as the difference from the previous one, which turns slowly changing
+ * sensor values into small numbers that fit in one byte or a few bits.
+ *
+ * ## Frame Layout
+ * | Byte | Content                                   |
+ * |------|-------------------------------------------|
+ * | 0    | Codec mode (`LicCodecMode`)               |
+ * | 1    | Sample count                              |
+ * | 2    | Payload length in bytes                   |
+ * | 3..  | Payload                                   |
+ *
+ * ## Codec Modes
+ * - `LICD_CODEC_RAW`: Samples are copied as-is.
+ * - `LICD_CODEC_VARINT`: First sample and deltas are zig-zag encoded varints.
+ * - `LICD_CODEC_BITPACK`: First sample is a zig-zag varint, followed by the bit
+ *   width of the deltas and every delta packed on that many bits.
+ *
+ * Frames never depend on a previous frame, a lost or corrupted frame does not
+ * affect the next one.
+ *
+ * ## Notes
+ * - Sample types must be integers no larger than 32 bits.
+ * - Multi-byte values are stored little-endian in the payload.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_CODEC_H_
+#define LICD_CODEC_H_
+
+/**
+ * @brief Encodings supported by `LicCodec`.
+ **/
+enum LicCodecMode : uint8_t {
+
+	LICD_CODEC_RAW = 0,
+	LICD_CODEC_VARINT,
+	LICD_CODEC_BITPACK
+
+};
+
+/**
+ * @brief Size in bytes of the frame header written before the payload.
+ **/
+#define LICD_CODEC_HEADER_SIZE 3
+
+/**
+ * @class LicCodec
+ * @brief Provides static delta, zig-zag varint and bit-packing encoders.
+ * @author : ALVES Quentin
+ * 
+ * All methods are static and work on caller provided buffers, no memory is allocated.
+ **/
+class LicCodec final {
+
+public:
+	/**
+	 * @brief Encodes samples into a frame.
+	 * 
+	 * When every sample does not fit in `capacity`, the frame holds as many leading
+	 * samples as possible and its sample count reflects it.
+	 * 
+	 * @tparam T The integer sample type.
+	 * @param mode Codec mode of the frame.
+	 * @param samples Pointer to the samples to encode.
+	 * @param count Number of samples to encode (at most 255).
+	 * @param buffer Pointer to the frame buffer.
+	 * @param capacity Size of the frame buffer in bytes.
+	 * @return The frame size in bytes, 0 when not even the header fits.
+	 **/
+	template<typename T>
+	static uint8_t encode( 
+		const LicCodecMode mode,
+		const T* samples,
+		const uint8_t count,
+		uint8_t* buffer,
+		const uint8_t capacity
+	) {
+		if ( capacity < LICD_CODEC_HEADER_SIZE )
+			return 0;
+
+		uint8_t* payload = buffer + LICD_CODEC_HEADER_SIZE;
+		const uint8_t payload_capacity = capacity - LICD_CODEC_HEADER_SIZE;
+		uint8_t sample_count = 0;
+		uint8_t payload_size = 0;
+
+		switch ( mode ) {
+			case LICD_CODEC_VARINT : 
+				payload_size = encode_varint( samples, count, payload, payload_capacity, sample_count );
+				break;
+
+			case LICD_CODEC_BITPACK : 
+				payload_size = encode_bitpack( samples, count, payload, payload_capacity, sample_count );
+				break;
+
+			default :
+				sample_count = min_count( count, payload_capacity / sizeof( T ) );
+				payload_size = sample_count * sizeof( T );
+
+				for ( uint8_t sample_id = 0; sample_id < sample_count; sample_id++ )
+					store( payload + sample_id * sizeof( T ), (uint32_t)samples[ sample_id ], sizeof( T ) );
+
+				break;
+		}
+
+		buffer[ 0 ] = (uint8_t)mode;
+		buffer[ 1 ] = sample_count;
+		buffer[ 2 ] = payload_size;
+
+		return LICD_CODEC_HEADER_SIZE + payload_size;
+	};
+
+	/**
+	 * @brief Decodes a frame into samples.
+	 * 
+	 * @tparam T The integer sample type.
+	 * @param buffer Pointer to the frame.
+	 * @param size Number of valid bytes in the frame buffer.
+	 * @param samples Pointer to the memory where decoded samples will be stored.
+	 * @param capacity Maximum number of samples to decode.
+	 * @return The number of decoded samples, 0 when the frame is malformed.
+	 **/
+	template<typename T>
+	static uint8_t decode( 
+		const uint8_t* buffer,
+		const uint8_t size,
+		T* samples,
+		const uint8_t capacity
+	) {
+		if ( size < LICD_CODEC_HEADER_SIZE )
+			return 0;
+
+		const uint8_t mode = buffer[ 0 ];
+		const uint8_t sample_count = buffer[ 1 ];
+		const uint8_t payload_size = buffer[ 2 ];
+		const uint8_t* payload = buffer + LICD_CODEC_HEADER_SIZE;
+
+		if ( sample_count > capacity || payload_size > size - LICD_CODEC_HEADER_SIZE )
+			return 0;
+
+		switch ( mode ) {
+			case LICD_CODEC_RAW :
+				if ( payload_size != sample_count * sizeof( T ) )
+					return 0;
+
+				for ( uint8_t sample_id = 0; sample_id < sample_count; sample_id++ )
+					samples[ sample_id ] = (T)load( payload + sample_id * sizeof( T ), sizeof( T ) );
+
+				return sample_count;
+
+			case LICD_CODEC_VARINT : return decode_varint( payload, payload_size, samples, sample_count );
+			case LICD_CODEC_BITPACK : return decode_bitpack( payload, payload_size, samples, sample_count );
+
+			default : break;
+		}
+
+		return 0;
+	};
+
+public:
+	/**
+	 * @brief Maps a signed value to an unsigned one, small magnitudes giving small values.
+	 * 
+	 * @param value Signed value.
+	 * @return Zig-zag encoded value.
+	 **/
+	static uint32_t zigzag( const int32_t value ) {
+		return ( (uint32_t)value << 1 ) ^ (uint32_t)( value >> 31 );
+	};
+
+	/**
+	 * @brief Reverts `zigzag`.
+	 * 
+	 * @param value Zig-zag encoded value.
+	 * @return Signed value.
+	 **/
+	static int32_t unzigzag( const uint32_t value ) {
+		return (int32_t)( value >> 1 ) ^ -(int32_t)( value & 1 );
+	};
+
+	/**
+	 * @brief Writes a varint, 7 bits per byte with the high bit as continuation flag.
+	 * 
+	 * @param value Value to write.
+	 * @param buffer Pointer to the destination.
+	 * @param capacity Remaining bytes in the destination.
+	 * @return Number of bytes written, 0 if the varint does not fit.
+	 **/
+	static uint8_t write_varint( uint32_t value, uint8_t* buffer, const uint8_t capacity ) {
+		uint8_t size = 0;
+
+		do {
+			if ( size >= capacity )
+				return 0;
+
+			uint8_t byte = value & 0x7F;
+
+			value >>= 7;
+
+			if ( value > 0 )
+				byte |= 0x80;
+
+			buffer[ size++ ] = byte;
+		} while ( value > 0 );
+
+		return size;
+	};
+
+	/**
+	 * @brief Reads a varint written by `write_varint`.
+	 * 
+	 * @param buffer Pointer to the source.
+	 * @param capacity Remaining bytes in the source.
+	 * @param value Decoded value.
+	 * @return Number of bytes read, 0 if the varint is truncated.
+	 **/
+	static uint8_t read_varint( const uint8_t* buffer, const uint8_t capacity, uint32_t& value ) {
+		value = 0;
+
+		for ( uint8_t size = 0; size < capacity && size < 5; size++ ) {
+			value |= (uint32_t)( buffer[ size ] & 0x7F ) << ( 7 * size );
+
+			if ( ( buffer[ size ] & 0x80 ) == 0 )
+				return size + 1;
+		}
+
+		return 0;
+	};
+
+private:
+	static uint8_t min_count( const uint32_t left, const uint32_t right ) {
+		return (uint8_t)( ( left < right ) ? left : right );
+	};
+
+	static void store( uint8_t* buffer, uint32_t value, const uint8_t size ) {
+		for ( uint8_t byte_id = 0; byte_id < size; byte_id++, value >>= 8 )
+			buffer[ byte_id ] = (uint8_t)value;
+	};
+
+	static uint32_t load( const uint8_t* buffer, const uint8_t size ) {
+		uint32_t value = 0;
+
+		for ( uint8_t byte_id = 0; byte_id < size; byte_id++ )
+			value |= (uint32_t)buffer[ byte_id ] << ( 8 * byte_id );
+
+		return value;
+	};
+
+	/**
+	 * @brief Computes the zig-zag delta between two samples, wrapping on the sample type.
+	 * 
+	 * The difference is sign-extended from the width of `T`, a 16-bit counter
+	 * going from 0xFFFF to 0 is a delta of +1, the decoder wraps it back.
+	 **/
+	template<typename T>
+	static uint32_t delta( const T current, const T previous ) {
+		const uint8_t shift = 32 - 8 * sizeof( T );
+		const uint32_t difference = (uint32_t)current - (uint32_t)previous;
+
+		return zigzag( (int32_t)( difference << shift ) >> shift );
+	};
+
+	template<typename T>
+	static uint8_t encode_varint( 
+		const T* samples,
+		const uint8_t count,
+		uint8_t* payload,
+		const uint8_t capacity,
+		uint8_t& sample_count
+	) {
+		uint8_t payload_size = 0;
+		T previous = 0;
+
+		for ( sample_count = 0; sample_count < count; sample_count++ ) {
+			const uint32_t value = delta( samples[ sample_count ], previous );
+			const uint8_t size = write_varint( value, payload + payload_size, capacity - payload_size );
+
+			if ( size == 0 )
+				break;
+
+			previous = samples[ sample_count ];
+			payload_size += size;
+		}
+
+		return payload_size;
+	};
+
+	template<typename T>
+	static uint8_t decode_varint( 
+		const uint8_t* payload,
+		const uint8_t payload_size,
+		T* samples,
+		const uint8_t sample_count
+	) {
+		uint8_t offset = 0;
+		T previous = 0;
+
+		for ( uint8_t sample_id = 0; sample_id < sample_count; sample_id++ ) {
+			uint32_t value = 0;
+			const uint8_t size = read_varint( payload + offset, payload_size - offset, value );
+
+			if ( size == 0 )
+				return 0;
+
+			previous = (T)( (uint32_t)previous + (uint32_t)unzigzag( value ) );
+			samples[ sample_id ] = previous;
+			offset += size;
+		}
+
+		return sample_count;
+	};
+
+	template<typename T>
+	static uint8_t encode_bitpack( 
+		const T* samples,
+		uint8_t count,
+		uint8_t* payload,
+		const uint8_t capacity,
+		uint8_t& sample_count
+	) {
+		sample_count = 0;
+
+		if ( count == 0 )
+			return 0;
+
+		uint8_t payload_size = write_varint( delta( samples[ 0 ], (T)0 ), payload, capacity );
+
+		if ( payload_size == 0 || payload_size >= capacity )
+			return 0;
+
+		uint8_t width = 0;
+
+		for ( uint8_t sample_id = 1; sample_id < count; sample_id++ ) {
+			const uint32_t value = delta( samples[ sample_id ], samples[ sample_id - 1 ] );
+
+			while ( width < 32 && ( value >> width ) > 0 )
+				width += 1;
+		}
+
+		const uint32_t bit_capacity = 8 * (uint32_t)( capacity - payload_size - 1 );
+
+		if ( width > 0 && ( count - 1 ) * (uint32_t)width > bit_capacity )
+			count = (uint8_t)( bit_capacity / width + 1 );
+
+		payload[ payload_size++ ] = width;
+
+		uint32_t bit_offset = 0;
+
+		for ( uint8_t sample_id = 1; sample_id < count; sample_id++ ) {
+			const uint32_t value = delta( samples[ sample_id ], samples[ sample_id - 1 ] );
+
+			for ( uint8_t bit_id = 0; bit_id < width; bit_id++, bit_offset++ ) {
+				uint8_t& byte = payload[ payload_size + bit_offset / 8 ];
+
+				if ( bit_offset % 8 == 0 )
+					byte = 0;
+
+				if ( ( value >> bit_id ) & 1 )
+					byte |= (uint8_t)( 1 << ( bit_offset % 8 ) );
+			}
+		}
+
+		sample_count = count;
+
+		return payload_size + (uint8_t)( ( bit_offset + 7 ) / 8 );
+	};
+
+	template<typename T>
+	static uint8_t decode_bitpack( 
+		const uint8_t* payload,
+		const uint8_t payload_size,
+		T* samples,
+		const uint8_t sample_count
+	) {
+		if ( sample_count == 0 )
+			return 0;
+
+		uint32_t value = 0;
+		uint8_t offset = read_varint( payload, payload_size, value );
+
+		if ( offset == 0 || offset >= payload_size )
+			return 0;
+
+		const uint8_t width = payload[ offset++ ];
+
+		if ( width > 32 || ( sample_count - 1 ) * (uint32_t)width > 8 * (uint32_t)( payload_size - offset ) )
+			return 0;
+
+		T previous = (T)unzigzag( value );
+		uint32_t bit_offset = 0;
+
+		samples[ 0 ] = previous;
+
+		for ( uint8_t sample_id = 1; sample_id < sample_count; sample_id++ ) {
+			value = 0;
+
+			for ( uint8_t bit_id = 0; bit_id < width; bit_id++, bit_offset++ ) {
+				if ( ( payload[ offset + bit_offset / 8 ] >> ( bit_offset % 8 ) ) & 1 )
+					value |= (uint32_t)1 << bit_id;
+			}
+
+			previous = (T)( (uint32_t)previous + (uint32_t)unzigzag( value ) );
+			samples[ sample_id ] = previous;
+		}
+
+		return sample_count;
+	};
+
+};
+
+#endif /* !LICD_CODEC_H_ */
@@ -10,6 +10,15 @@
  * - `LICD_COMMAND_UUID`: Command to request the UUID of a slave device.
  * - `LICD_COMMAND_ASSIGN`: Command to assign a dynamic address to a slave device.
  * - `LICD_COMMAND_RETRY`: Command to instruct a slave device to retry an operation.
+ * - `LICD_COMMAND_AGGREGATE`: Command to fetch the aggregate computed by a slave device.
+ * - `LICD_COMMAND_REGISTER`: Command to write a range of the slave register block.
+ * - `LICD_COMMAND_STREAM`: Command to append data to the slave stream buffer.
+ * - `LICD_COMMAND_CREDIT`: Command to query the free space of the slave stream buffer.
+ * - `LICD_COMMAND_BULK_WRITE`: Command to write a chunk of a bulk object at an offset.
+ * - `LICD_COMMAND_BULK_STATUS`: Command to query the checkpoint of a bulk object.
+ * - `LICD_COMMAND_BULK_READ`: Command to read a chunk of a bulk object at an offset.
+ * - `LICD_COMMAND_FIRMWARE`: Command to drive the firmware update of a slave device.
+ * - `LICD_COMMAND_USER`: First command code available to applications.
  *
  * ## Usage Notes
  * - These command codes are intended for use with the LICD protocol and should be consistent 
@@ -48,4 +57,82 @@
  **/
 #define LICD_COMMAND_RETRY 0x03
 
+/**
+ * @brief Command to fetch the aggregate computed by a slave device.
+ * 
+ * The slave answers the following request with a `LicAggregate` structure
+ * holding the statistics of its aggregation window.
+ **/
+#define LICD_COMMAND_AGGREGATE 0x04
+
+/**
+ * @brief Command to write a range of the slave register block.
+ * 
+ * The command is followed by the register offset and the bytes to write, it is
+ * issued by the master when flushing its shadow registers.
+ **/
+#define LICD_COMMAND_REGISTER 0x05
+
+/**
+ * @brief Command to append data to the slave stream buffer.
+ * 
+ * The command is followed by the stream bytes. The master never sends more bytes
+ * than the credits last advertised by the slave.
+ **/
+#define LICD_COMMAND_STREAM 0x06
+
+/**
+ * @brief Command to query the free space of the slave stream buffer.
+ * 
+ * The slave answers the following request with a `uint16_t` holding the number
+ * of bytes its stream buffer can still accept.
+ **/
+#define LICD_COMMAND_CREDIT 0x07
+
+/**
+ * @brief Command to write a chunk of a bulk object at an offset.
+ * 
+ * The command is followed by the object identifier, the little-endian 32-bit
+ * offset of the chunk, the little-endian CRC-16 of the chunk and the chunk bytes.
+ * Offset 0 restarts the object, any other offset is only accepted when it matches
+ * the slave checkpoint.
+ **/
+#define LICD_COMMAND_BULK_WRITE 0x08
+
+/**
+ * @brief Command to query the checkpoint of a bulk object.
+ * 
+ * The command is followed by the object identifier. The slave answers the
+ * following request with a `uint32_t` holding the highest contiguous offset it
+ * stored for that object.
+ **/
+#define LICD_COMMAND_BULK_STATUS 0x09
+
+/**
+ * @brief Command to read a chunk of a bulk object at an offset.
+ * 
+ * The command is followed by the object identifier, the little-endian 32-bit
+ * offset and the requested size. The slave answers the following request with
+ * the chunk size, the little-endian CRC-16 of the chunk and the chunk bytes, a short
+ * chunk marks the end of the object.
+ **/
+#define LICD_COMMAND_BULK_READ 0x0A
+
+/**
+ * @brief Command to drive the firmware update of a slave device.
+ * 
+ * The command is followed by a `LicFirmwareOperation` and its parameters. The
+ * slave answers the following request with its `LicFirmwareState`.
+ **/
+#define LICD_COMMAND_FIRMWARE 0x0B
+
+/**
+ * @brief First command code available to applications.
+ * 
+ * Codes below this value are reserved to LICD and are handled by `LicDevice`
+ * before the application handlers. Application payloads sent to an assigned
+ * slave must start with a byte greater or equal to this value.
+ **/
+#define LICD_COMMAND_USER 0x10
+
 #endif /* !LICD_COMMANDS_H_ */
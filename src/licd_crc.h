@@ -0,0 +1,84 @@
+/**
+ * @file licd_crc.h
+ * @brief Provides CRC helpers for the LICD framework.
+ *
+ * This header defines the `LicCRC` class, which computes the CRC-16/CCITT-FALSE
+ * used to protect bulk chunks and the CRC-32 (IEEE 802.3) used to verify whole
+ * firmware images. Both are computed bitwise to avoid lookup tables on small MCUs,
+ * and both can be computed incrementally by feeding the previous result back.
+ *
+ * ## Usage Example
+ * ```
+ * uint32_t crc = LicCRC::crc32( first_half, 128 );
+ * crc = LicCRC::crc32( second_half, 128, crc );
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_CRC_H_
+#define LICD_CRC_H_
+
+/**
+ * @brief Initial value of an incremental CRC-16.
+ **/
+#define LICD_CRC16_INIT 0xFFFF
+
+/**
+ * @brief Initial value of an incremental CRC-32.
+ **/
+#define LICD_CRC32_INIT 0x00000000
+
+/**
+ * @class LicCRC
+ * @brief Provides static CRC-16 and CRC-32 functions.
+ * @author : ALVES Quentin
+ **/
+class LicCRC final {
+
+public:
+	/**
+	 * @brief Computes a CRC-16/CCITT-FALSE (polynomial 0x1021).
+	 * 
+	 * @param data Pointer to the data.
+	 * @param size Size of the data in bytes.
+	 * @param crc Result of the previous call, to continue a CRC over several buffers.
+	 * @return The CRC of the data.
+	 **/
+	static uint16_t crc16( const uint8_t* data, const uint32_t size, uint16_t crc = LICD_CRC16_INIT ) {
+		for ( uint32_t data_offset = 0; data_offset < size; data_offset++ ) {
+			crc ^= (uint16_t)data[ data_offset ] << 8;
+
+			for ( uint8_t bit_id = 0; bit_id < 8; bit_id++ )
+				crc = ( crc & 0x8000 ) ? (uint16_t)( ( crc << 1 ) ^ 0x1021 ) : (uint16_t)( crc << 1 );
+		}
+
+		return crc;
+	};
+
+	/**
+	 * @brief Computes a CRC-32 (reflected polynomial 0xEDB88320).
+	 * 
+	 * @param data Pointer to the data.
+	 * @param size Size of the data in bytes.
+	 * @param crc Result of the previous call, to continue a CRC over several buffers.
+	 * @return The CRC of the data.
+	 **/
+	static uint32_t crc32( const uint8_t* data, const uint32_t size, uint32_t crc = LICD_CRC32_INIT ) {
+		crc = ~crc;
+
+		for ( uint32_t data_offset = 0; data_offset < size; data_offset++ ) {
+			crc ^= data[ data_offset ];
+
+			for ( uint8_t bit_id = 0; bit_id < 8; bit_id++ )
+				crc = ( crc & 1 ) ? ( ( crc >> 1 ) ^ 0xEDB88320 ) : ( crc >> 1 );
+		}
+
+		return ~crc;
+	};
+
+};
+
+#endif /* !LICD_CRC_H_ */
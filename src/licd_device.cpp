@@ -1,32 +1,235 @@
+#include "licd.h"
+
 /**
  * ====================
  * LicDevice
  * ====================
  */
 
+LicDevice* LicDevice::s_instance = nullptr;
+
 // PUBLIC METHODS
 
+/**
+ * @brief Constructs an idle `LicDevice`, meant to be assigned later in `setup( )`.
+ **/
+LicDevice::LicDevice( )
+	: m_address{ LICD_LISTENER_ADDRESS },
+	m_header{ },
+	m_receive{ nullptr },
+	m_request{ nullptr },
+	m_command{ 0 },
+	m_registers{ nullptr },
+	m_register_size{ 0 },
+	m_aggregator{ },
+	m_stream{ },
+	m_bulk_write{ nullptr },
+	m_bulk_read{ nullptr },
+	m_bulk_object{ 0 },
+	m_bulk_offset{ 0 },
+	m_bulk_query_object{ 0 },
+	m_bulk_query_offset{ 0 },
+	m_bulk_query_size{ 0 },
+	m_firmware{ nullptr },
+	m_firmware_state{ LICD_FIRMWARE_IDLE },
+	m_firmware_size{ 0 },
+	m_firmware_crc{ 0 },
+	m_firmware_check{ 0 },
+	m_firmware_operation{ LICD_FIRMWARE_STATUS },
+	m_firmware_offset{ 0 },
+	m_firmware_chunk_size{ 0 },
+	m_firmware_chunk{ }
+{ }
+
 /**
  * @brief Constructs a `LicDevice` with receive and request handlers.
  *
  * @param receive_handler Function pointer for handling received data.
  * @param request_handler Function pointer for handling requests from the master.
+ * @param uuid Identifier answered during registration, must not be 0 (default: LICD_DEFAULT_UUID).
+ * @param flags Capability flags answered during registration (default: 0, 100 kHz).
  **/
 LicDevice::LicDevice( 
 	LicDeviceReceive receive_handler, 
-	LicDeviceRequest request_handler 
+	LicDeviceRequest request_handler,
+	const uint32_t uuid,
+	const uint32_t flags
 )
 	: m_address{ LICD_LISTENER_ADDRESS },
+	m_header{ },
 	m_receive{ receive_handler },
-	m_request{ request_handler }
+	m_request{ request_handler },
+	m_command{ 0 },
+	m_registers{ nullptr },
+	m_register_size{ 0 },
+	m_aggregator{ },
+	m_stream{ },
+	m_bulk_write{ nullptr },
+	m_bulk_read{ nullptr },
+	m_bulk_object{ 0 },
+	m_bulk_offset{ 0 },
+	m_bulk_query_object{ 0 },
+	m_bulk_query_offset{ 0 },
+	m_bulk_query_size{ 0 },
+	m_firmware{ nullptr },
+	m_firmware_state{ LICD_FIRMWARE_IDLE },
+	m_firmware_size{ 0 },
+	m_firmware_crc{ 0 },
+	m_firmware_check{ 0 },
+	m_firmware_operation{ LICD_FIRMWARE_STATUS },
+	m_firmware_offset{ 0 },
+	m_firmware_chunk_size{ 0 },
+	m_firmware_chunk{ }
 {
-	Create( ReceiveAddress, nullptr );
+	m_header.uuid = ( uuid > 0 ) ? uuid : 1;
+	m_header.flags = flags;
+	s_instance = this;
+
+	Create( ReceiveAddress, RequestCommand );
 }
 
 /**
  * @brief Destructor for `LicDevice`.
  **/
-LicDevice::~LicDevice( ) { }
+LicDevice::~LicDevice( ) {
+	if ( s_instance == this )
+		s_instance = nullptr;
+}
+
+/**
+ * @brief Drops the assigned address and waits for a new one on the listener address.
+ **/
+void LicDevice::Reset( ) {
+	m_address = LICD_LISTENER_ADDRESS;
+	m_command = 0;
+
+	Create( ReceiveAddress, RequestCommand );
+}
+
+/**
+ * @brief Accumulates a sample into the device aggregator.
+ *
+ * Interrupts are masked while the window is updated so a concurrent master
+ * request never reads a half updated aggregate.
+ *
+ * @param sample Sample value.
+ **/
+void LicDevice::Push( const float sample ) {
+	noInterrupts( );
+	m_aggregator.Push( sample );
+	interrupts( );
+}
+
+/**
+ * @brief Exposes a register block the master can write with shadow registers.
+ *
+ * The block is written from the Wire receive interrupt, the application should
+ * read it with interrupts masked when it needs a consistent multi-byte value.
+ *
+ * @param registers Pointer to the register block, nullptr to disable register writes.
+ * @param size Size of the register block in bytes.
+ **/
+void LicDevice::SetRegisters( uint8_t* registers, const uint8_t size ) {
+	noInterrupts( );
+	m_registers = registers;
+	m_register_size = ( registers != nullptr ) ? size : 0;
+	interrupts( );
+}
+
+/**
+ * @brief Reads bytes streamed by the master.
+ *
+ * Every byte read frees a stream credit the master can use on its next `Stream` call.
+ *
+ * @param data Pointer to the memory where the bytes will be stored.
+ * @param size Maximum number of bytes to read.
+ * @return The number of bytes read.
+ **/
+uint32_t LicDevice::ReadStream( uint8_t* data, const uint32_t size ) {
+	return m_stream.Read( data, size );
+}
+
+/**
+ * @brief Sets the handlers storing and providing bulk object chunks.
+ *
+ * Handlers run from the Wire interrupt handlers and must return quickly.
+ *
+ * @param write_handler Function pointer storing pushed chunks, nullptr refuses pushes.
+ * @param read_handler Function pointer providing pulled chunks, nullptr answers empty chunks.
+ **/
+void LicDevice::SetBulkHandlers( LicDeviceBulkWrite write_handler, LicDeviceBulkRead read_handler ) {
+	noInterrupts( );
+	m_bulk_write = write_handler;
+	m_bulk_read = read_handler;
+	interrupts( );
+}
+
+/**
+ * @brief Restores the checkpoint of a bulk object, typically after a slave reset.
+ *
+ * The master resumes pushing the object from this offset.
+ *
+ * @param object Object identifier.
+ * @param offset Number of contiguous bytes already stored.
+ **/
+void LicDevice::ResumeBulk( const uint8_t object, const uint32_t offset ) {
+	noInterrupts( );
+	m_bulk_object = object;
+	m_bulk_offset = offset;
+	interrupts( );
+}
+
+/**
+ * @brief Sets the staging area receiving firmware images.
+ *
+ * @param target Pointer to the staging area, nullptr refuses firmware updates.
+ **/
+void LicDevice::SetFirmwareTarget( const LicFirmwareTarget* target ) {
+	noInterrupts( );
+	m_firmware = target;
+	m_firmware_state = LICD_FIRMWARE_IDLE;
+	m_firmware_operation = LICD_FIRMWARE_STATUS;
+	m_firmware_chunk_size = 0;
+	interrupts( );
+}
+
+/**
+ * @brief Runs the firmware work queued by the transport handlers, call it from `loop( )`.
+ *
+ * The staged chunk is written first, then the queued operation runs, so a commit
+ * always sees the whole image. Target callbacks may take as long as they need,
+ * the master polls `LICD_FIRMWARE_BUSY` meanwhile.
+ **/
+void LicDevice::Update( ) {
+	if ( m_firmware == nullptr )
+		return;
+
+	noInterrupts( );
+	const uint8_t operation = m_firmware_operation;
+	const uint32_t offset = m_firmware_offset;
+	const uint8_t chunk_size = m_firmware_chunk_size;
+	m_firmware_operation = LICD_FIRMWARE_STATUS;
+	interrupts( );
+
+	if ( chunk_size > 0 ) {
+		const bool is_written = m_firmware->write != nullptr && m_firmware->write( offset, m_firmware_chunk, chunk_size );
+
+		if ( is_written && offset == 0 )
+			m_firmware_check = LICD_CRC32_INIT;
+
+		if ( is_written )
+			m_firmware_check = LicCRC::crc32( m_firmware_chunk, chunk_size, m_firmware_check );
+		else
+			SetFirmwareState( LICD_FIRMWARE_FAILED );
+
+		noInterrupts( );
+		m_firmware_chunk_size = 0;
+		interrupts( );
+	}
+
+	if ( operation != LICD_FIRMWARE_STATUS )
+		RunFirmware( operation );
+}
 
 // PRIVATE METHODS
 
@@ -40,33 +243,470 @@ void LicDevice::Create(
 	LicDeviceReceive receive_handler,
 	LicDeviceRequest request_handler 
 ) {
-	Wire.begin( m_address );
-	Wire.onReceive( receive_handler );
-	Wire.onRequest( request_handler );
+	LicTransport::begin( m_address );
+	LicTransport::onReceive( receive_handler );
+	LicTransport::onRequest( request_handler );
+}
+
+/**
+ * @brief Handles a reserved LICD command received on the assigned address.
+ *
+ * @param command Command code peeked from the receive buffer.
+ * @return true if the command was consumed by LICD; false to forward it to the application.
+ **/
+bool LicDevice::DoReceiveCommand( const uint8_t command ) {
+	switch ( command ) {
+		case LICD_COMMAND_AGGREGATE : 
+			LicTransport::read( );
+
+			m_command = command;
+
+			break;
+
+		case LICD_COMMAND_REGISTER : 
+			LicTransport::read( );
+
+			ReceiveRegisters( );
+
+			break;
+
+		case LICD_COMMAND_STREAM : 
+			LicTransport::read( );
+
+			ReceiveStream( );
+
+			break;
+
+		case LICD_COMMAND_CREDIT : 
+			LicTransport::read( );
+
+			m_command = command;
+
+			break;
+
+		case LICD_COMMAND_BULK_WRITE : 
+			LicTransport::read( );
+
+			ReceiveBulkWrite( );
+
+			break;
+
+		case LICD_COMMAND_BULK_STATUS : 
+		case LICD_COMMAND_BULK_READ : 
+			LicTransport::read( );
+
+			ReceiveBulkQuery( command );
+
+			break;
+
+		case LICD_COMMAND_FIRMWARE : 
+			LicTransport::read( );
+
+			ReceiveFirmware( );
+
+			m_command = command;
+
+			break;
+
+		default : return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Answers a request following a reserved LICD command.
+ *
+ * @return true if the request was answered by LICD; false to forward it to the application.
+ **/
+bool LicDevice::DoRequestCommand( ) {
+	const uint8_t command = m_command;
+
+	m_command = 0;
+
+	switch ( command ) {
+		case LICD_COMMAND_UUID : WireHelper::write( &m_header, 1 ); break;
+
+		case LICD_COMMAND_AGGREGATE : {
+			const LicAggregate aggregate = m_aggregator.GetAggregate( );
+
+			WireHelper::write( &aggregate, 1 );
+
+			break;
+		}
+
+		case LICD_COMMAND_CREDIT : {
+			const uint16_t credits = m_stream.GetFree( );
+
+			WireHelper::write( &credits, 1 );
+
+			break;
+		}
+
+		case LICD_COMMAND_BULK_STATUS : {
+			const uint32_t offset = GetBulkOffset( m_bulk_query_object );
+
+			WireHelper::write( &offset, 1 );
+
+			break;
+		}
+
+		case LICD_COMMAND_BULK_READ : RequestBulkRead( ); break;
+
+		case LICD_COMMAND_FIRMWARE : {
+			const uint8_t state = m_firmware_state;
+
+			WireHelper::write( &state, 1 );
+
+			break;
+		}
+
+		default : return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Copies a register write into the register block.
+ *
+ * Bytes falling outside the register block are discarded. A device advertising
+ * `LICD_CAPABILITY_CRC` drops the whole write when its trailing CRC-16 does not
+ * match the offset and data.
+ **/
+void LicDevice::ReceiveRegisters( ) {
+	uint8_t offset = (uint8_t)LicTransport::read( );
+
+	if ( LicCapabilities::has( m_header.flags, LICD_CAPABILITY_CRC ) ) {
+		uint8_t chunk[ LICD_FRAME_SIZE ];
+		uint8_t size = 0;
+
+		while ( LicTransport::available( ) && size < LICD_FRAME_SIZE )
+			chunk[ size++ ] = (uint8_t)LicTransport::read( );
+
+		if ( size < 2 )
+			return;
+
+		size -= 2;
+
+		if ( ( chunk[ size ] | ( chunk[ size + 1 ] << 8 ) ) != LicCRC::crc16( chunk, size, LicCRC::crc16( &offset, 1 ) ) )
+			return;
+
+		for ( uint8_t byte_id = 0; byte_id < size && offset < m_register_size; byte_id++ )
+			m_registers[ offset++ ] = chunk[ byte_id ];
+
+		return;
+	}
+
+	while ( LicTransport::available( ) ) {
+		const uint8_t value = (uint8_t)LicTransport::read( );
+
+		if ( offset < m_register_size )
+			m_registers[ offset++ ] = value;
+	}
+}
+
+/**
+ * @brief Appends streamed bytes to the stream buffer.
+ *
+ * The master never sends more than the advertised credits, bytes that still do
+ * not fit are discarded.
+ **/
+void LicDevice::ReceiveStream( ) {
+	while ( LicTransport::available( ) )
+		m_stream.Push( (uint8_t)LicTransport::read( ) );
+}
+
+/**
+ * @brief Stores a pushed bulk chunk when it extends the checkpoint.
+ *
+ * Chunks at offset 0 restart the object. Chunks at any other offset than the
+ * checkpoint are dropped, the master resends them after reading the checkpoint.
+ **/
+void LicDevice::ReceiveBulkWrite( ) {
+	uint8_t chunk[ LICD_FRAME_SIZE ];
+	uint8_t chunk_size = 0;
+	const uint8_t object = (uint8_t)LicTransport::read( );
+	const uint32_t offset = ReadOffset( );
+	const uint16_t crc = ReadCRC( );
+
+	while ( LicTransport::available( ) && chunk_size < LICD_FRAME_SIZE )
+		chunk[ chunk_size++ ] = (uint8_t)LicTransport::read( );
+
+	if ( crc != LicBulkTransfer::ComputeCRC( object, offset, chunk, chunk_size ) )
+		return;
+
+	if ( offset == 0 ) {
+		m_bulk_object = object;
+		m_bulk_offset = 0;
+	}
+
+	if ( object != m_bulk_object || offset != m_bulk_offset )
+		return;
+
+	bool is_stored = false;
+
+	if ( object == LICD_BULK_OBJECT_FIRMWARE && m_firmware != nullptr )
+		is_stored = WriteFirmware( offset, chunk, chunk_size );
+	else if ( m_bulk_write != nullptr )
+		is_stored = m_bulk_write( object, offset, chunk, chunk_size );
+
+	if ( is_stored )
+		m_bulk_offset += chunk_size;
+}
+
+/**
+ * @brief Stores the parameters of a bulk status or read query for the next request.
+ *
+ * @param command Command code of the query.
+ **/
+void LicDevice::ReceiveBulkQuery( const uint8_t command ) {
+	m_command = command;
+	m_bulk_query_object = (uint8_t)LicTransport::read( );
+
+	if ( command == LICD_COMMAND_BULK_READ ) {
+		m_bulk_query_offset = ReadOffset( );
+		m_bulk_query_size = (uint8_t)LicTransport::read( );
+
+		if ( m_bulk_query_size > LICD_FRAME_SIZE - 3 )
+			m_bulk_query_size = LICD_FRAME_SIZE - 3;
+	}
+}
+
+/**
+ * @brief Answers a bulk read query with the chunk size, its CRC-16 and the chunk.
+ **/
+void LicDevice::RequestBulkRead( ) {
+	uint8_t chunk[ LICD_FRAME_SIZE ];
+	uint8_t chunk_size = 0;
+
+	if ( m_bulk_read != nullptr )
+		chunk_size = m_bulk_read( m_bulk_query_object, m_bulk_query_offset, chunk + 3, m_bulk_query_size );
+
+	if ( chunk_size > m_bulk_query_size )
+		chunk_size = m_bulk_query_size;
+
+	const uint16_t crc = LicBulkTransfer::ComputeCRC( m_bulk_query_object, m_bulk_query_offset, chunk + 3, chunk_size );
+
+	chunk[ 0 ] = chunk_size;
+	chunk[ 1 ] = (uint8_t)crc;
+	chunk[ 2 ] = (uint8_t)( crc >> 8 );
+
+	WireHelper::write( chunk, chunk_size + 3 );
+}
+
+/**
+ * @brief Queues a firmware operation for `Update`.
+ *
+ * Target callbacks never run here, in the transport receive handler. The device
+ * answers `LICD_FIRMWARE_BUSY` to the next requests until `Update` ran the
+ * operation.
+ **/
+void LicDevice::ReceiveFirmware( ) {
+	const uint8_t operation = (uint8_t)LicTransport::read( );
+
+	if ( m_firmware == nullptr ) {
+		m_firmware_state = LICD_FIRMWARE_FAILED;
+
+		return;
+	}
+
+	switch ( operation ) {
+		case LICD_FIRMWARE_BEGIN : 
+			m_firmware_size = ReadOffset( );
+			m_firmware_crc = ReadOffset( );
+			m_bulk_object = LICD_BULK_OBJECT_FIRMWARE;
+			m_bulk_offset = 0;
+			m_firmware_chunk_size = 0;
+
+			break;
+
+		case LICD_FIRMWARE_COMMIT : 
+			if ( m_firmware_state != LICD_FIRMWARE_RECEIVING )
+				return;
+
+			break;
+
+		case LICD_FIRMWARE_REBOOT : 
+			if ( m_firmware_state != LICD_FIRMWARE_VERIFIED )
+				return;
+
+			break;
+
+		default : return;
+	}
+
+	m_firmware_operation = operation;
+	m_firmware_state = LICD_FIRMWARE_BUSY;
+}
+
+/**
+ * @brief Stages a firmware chunk for `Update`.
+ *
+ * Chunks arrive in offset order, the bulk checkpoint guarantees it. A single
+ * chunk is staged at a time, the next one is refused until `Update` wrote it
+ * and the master sends it again after reading the checkpoint.
+ *
+ * @param offset Chunk offset in the image.
+ * @param data Pointer to the chunk bytes.
+ * @param size Size of the chunk in bytes.
+ * @return true if the chunk was staged; false otherwise.
+ **/
+bool LicDevice::WriteFirmware( const uint32_t offset, const uint8_t* data, const uint8_t size ) {
+	if ( m_firmware_state != LICD_FIRMWARE_RECEIVING || m_firmware_chunk_size > 0 || offset + size > m_firmware_size )
+		return false;
+
+	memcpy( m_firmware_chunk, data, size );
+
+	m_firmware_offset = offset;
+	m_firmware_chunk_size = size;
+
+	return true;
+}
+
+/**
+ * @brief Runs a queued firmware operation through the target callbacks.
+ *
+ * @param operation Firmware operation.
+ **/
+void LicDevice::RunFirmware( const uint8_t operation ) {
+	switch ( operation ) {
+		case LICD_FIRMWARE_BEGIN : 
+			m_firmware_check = LICD_CRC32_INIT;
+
+			if ( m_firmware->begin != nullptr && m_firmware->begin( m_firmware_size ) )
+				SetFirmwareState( LICD_FIRMWARE_RECEIVING );
+			else
+				SetFirmwareState( LICD_FIRMWARE_FAILED );
+
+			break;
+
+		case LICD_FIRMWARE_COMMIT : 
+			if ( 
+				GetBulkOffset( LICD_BULK_OBJECT_FIRMWARE ) == m_firmware_size &&
+				m_firmware_check == m_firmware_crc &&
+				( m_firmware->commit == nullptr || m_firmware->commit( m_firmware_size, m_firmware_crc ) )
+			)
+				SetFirmwareState( LICD_FIRMWARE_VERIFIED );
+			else
+				SetFirmwareState( LICD_FIRMWARE_FAILED );
+
+			break;
+
+		case LICD_FIRMWARE_REBOOT : 
+			if ( m_firmware->reboot != nullptr )
+				m_firmware->reboot( );
+
+			SetFirmwareState( LICD_FIRMWARE_VERIFIED );
+
+			break;
+
+		default : break;
+	}
+}
+
+/**
+ * @brief Sets the firmware state, unless another operation was queued meanwhile.
+ *
+ * @param state Firmware state answered to the master.
+ **/
+void LicDevice::SetFirmwareState( const LicFirmwareState state ) {
+	noInterrupts( );
+
+	if ( m_firmware_operation == LICD_FIRMWARE_STATUS )
+		m_firmware_state = state;
+
+	interrupts( );
 }
 
 // PRIVATE STATIC METHODS
 
+/**
+ * @brief Reads a little-endian 32-bit offset from the receive buffer.
+ *
+ * @return The offset, missing bytes read as 0.
+ **/
+uint32_t LicDevice::ReadOffset( ) {
+	uint32_t offset = 0;
+
+	for ( uint8_t byte_id = 0; byte_id < 4 && LicTransport::available( ); byte_id++ )
+		offset |= (uint32_t)( (uint8_t)LicTransport::read( ) ) << ( 8 * byte_id );
+
+	return offset;
+}
+
+/**
+ * @brief Reads a little-endian CRC-16 from the receive buffer.
+ *
+ * @return The CRC, missing bytes read as 0.
+ **/
+uint16_t LicDevice::ReadCRC( ) {
+	uint16_t crc = 0;
+
+	for ( uint8_t byte_id = 0; byte_id < 2 && LicTransport::available( ); byte_id++ )
+		crc |= (uint16_t)( (uint8_t)LicTransport::read( ) ) << ( 8 * byte_id );
+
+	return crc;
+}
+
 /**
  * @brief Handles address assignment and communication commands.
  *
  * @param byte_count Number of bytes received in the communication.
  **/
 void LicDevice::ReceiveAddress( int byte_count ) {
-	if ( Wire.available( ) ) {
-		uint8_t command = Wire.read( );
+	if ( s_instance == nullptr )
+		return;
+
+	if ( LicTransport::available( ) ) {
+		uint8_t command = LicTransport::read( );
 
 		if ( command == LICD_COMMAND_UUID ) {
-			Wire.write( 0x00 );
+			s_instance->m_command = command;
 		} else if ( command == LICD_COMMAND_ASSIGN ) {
-			m_address = Wire.read( );
+			s_instance->m_address = LicTransport::read( );
 				
-			Create( m_receive, m_request );
+			s_instance->Create( ReceiveCommand, RequestCommand );
 		} else if ( command == LICD_COMMAND_RETRY ) {
 		}
 	}
 
-	delay( 30 );
+	LicClock::sleep( 30000 );
+}
+
+/**
+ * @brief Dispatches data received on the assigned address.
+ *
+ * Reserved LICD commands are handled internally, everything else is forwarded
+ * untouched to the application receive handler.
+ *
+ * @param byte_count Number of bytes received in the communication.
+ **/
+void LicDevice::ReceiveCommand( int byte_count ) {
+	if ( s_instance == nullptr )
+		return;
+
+	if ( LicTransport::available( ) && s_instance->DoReceiveCommand( (uint8_t)LicTransport::peek( ) ) )
+		return;
+
+	s_instance->m_command = 0;
+
+	if ( s_instance->m_receive != nullptr )
+		s_instance->m_receive( byte_count );
+}
+
+/**
+ * @brief Dispatches requests received on the listener or the assigned address.
+ *
+ * Requests following a reserved LICD command are answered internally, everything
+ * else is forwarded to the application request handler once an address is assigned.
+ **/
+void LicDevice::RequestCommand( ) {
+	if ( s_instance == nullptr || s_instance->DoRequestCommand( ) )
+		return;
+
+	if ( s_instance->GetIsValid( ) && s_instance->m_request != nullptr )
+		s_instance->m_request( );
 }
 
 // PUBLIC GETTERS
@@ -89,6 +729,15 @@ LicDeviceAddress LicDevice::GetAddress( ) const {
 	return m_address;
 }
 
+/**
+ * @brief Retrieves the header answered during registration.
+ *
+ * @return The device identifier and capability flags.
+ **/
+const LicDeviceHeader& LicDevice::GetHeader( ) const {
+	return m_header;
+}
+
 LicDeviceReceive LicDevice::GetReceive( ) const {
 	return m_receive;
 }
@@ -97,8 +746,86 @@ LicDeviceRequest LicDevice::GetRequest( ) const {
 	return m_request;
 }
 
+/**
+ * @brief Retrieves the device aggregator, to change its window mode or length.
+ *
+ * @return Reference to the device aggregator.
+ **/
+LicAggregator& LicDevice::GetAggregator( ) {
+	return m_aggregator;
+}
+
+/**
+ * @brief Retrieves the number of streamed bytes waiting to be read.
+ *
+ * @return The stream buffer size.
+ **/
+uint8_t LicDevice::GetStreamSize( ) const {
+	return m_stream.GetSize( );
+}
+
+/**
+ * @brief Retrieves the checkpoint of a bulk object.
+ *
+ * @param object Object identifier.
+ * @return The number of contiguous bytes stored, 0 for any other object than the current one.
+ **/
+uint32_t LicDevice::GetBulkOffset( const uint8_t object ) const {
+	return ( object == m_bulk_object ) ? m_bulk_offset : 0;
+}
+
+/**
+ * @brief Retrieves the state of the firmware update.
+ *
+ * @return The current firmware state.
+ **/
+LicFirmwareState LicDevice::GetFirmwareState( ) const {
+	return m_firmware_state;
+}
+
 // OPERATORS
 
+/**
+ * @brief Copies a device, taking over the Wire handlers when `other` owned them.
+ *
+ * This keeps the `device = LicDevice( ... )` pattern used in `setup( )` working.
+ *
+ * @param other Device to copy.
+ * @return Reference to this device.
+ **/
+LicDevice& LicDevice::operator=( const LicDevice& other ) {
+	m_address = other.m_address;
+	m_header = other.m_header;
+	m_receive = other.m_receive;
+	m_request = other.m_request;
+	m_command = other.m_command;
+	m_registers = other.m_registers;
+	m_register_size = other.m_register_size;
+	m_stream = other.m_stream;
+	m_bulk_write = other.m_bulk_write;
+	m_bulk_read = other.m_bulk_read;
+	m_bulk_object = other.m_bulk_object;
+	m_bulk_offset = other.m_bulk_offset;
+	m_bulk_query_object = other.m_bulk_query_object;
+	m_bulk_query_offset = other.m_bulk_query_offset;
+	m_bulk_query_size = other.m_bulk_query_size;
+	m_firmware = other.m_firmware;
+	m_firmware_state = other.m_firmware_state;
+	m_firmware_size = other.m_firmware_size;
+	m_firmware_crc = other.m_firmware_crc;
+	m_firmware_check = other.m_firmware_check;
+	m_firmware_operation = other.m_firmware_operation;
+	m_firmware_offset = other.m_firmware_offset;
+	m_firmware_chunk_size = other.m_firmware_chunk_size;
+	memcpy( m_firmware_chunk, other.m_firmware_chunk, sizeof( m_firmware_chunk ) );
+	m_aggregator = other.m_aggregator;
+
+	if ( s_instance == &other )
+		s_instance = this;
+
+	return *this;
+}
+
 /**
  * @brief Checks the validity of the device.
  *
@@ -7,52 +7,158 @@
  **/
 typedef uint8_t LicDeviceAddress;
 
+/**
+ * LicDeviceHeader struct
+ * @note : Answered by a slave to LICD_COMMAND_UUID during registration, `flags`
+ *         holds the capabilities defined in licd_capabilities.h.
+ **/
+struct LicDeviceHeader {
+
+	uint32_t uuid = 0;
+	uint32_t flags = 0;
+
+};
+
 /**
  * 
  **/
 typedef void (*LicDeviceReceive)( int byte_count );
 typedef void (*LicDeviceRequest)( void );
 
+/**
+ * LicDeviceBulkWrite typedef
+ * @note : Stores a bulk chunk, returns false to refuse it. Called from the Wire receive handler.
+ **/
+typedef bool (*LicDeviceBulkWrite)( uint8_t object, uint32_t offset, const uint8_t* data, uint8_t size );
+
+/**
+ * LicDeviceBulkRead typedef
+ * @note : Fills a bulk chunk, returns its size. Called from the Wire request handler.
+ **/
+typedef uint8_t (*LicDeviceBulkRead)( uint8_t object, uint32_t offset, uint8_t* data, uint8_t size );
+
 class LicDevice {
 
 protected:
 	LicDeviceAddress m_address;
+	LicDeviceHeader m_header;
 	LicDeviceReceive m_receive;
 	LicDeviceRequest m_request;
+	uint8_t m_command;
+	uint8_t* m_registers;
+	uint8_t m_register_size;
+	LicAggregator m_aggregator;
+	LicStreamBuffer m_stream;
+	LicDeviceBulkWrite m_bulk_write;
+	LicDeviceBulkRead m_bulk_read;
+	uint8_t m_bulk_object;
+	uint32_t m_bulk_offset;
+	uint8_t m_bulk_query_object;
+	uint32_t m_bulk_query_offset;
+	uint8_t m_bulk_query_size;
+	const LicFirmwareTarget* m_firmware;
+	LicFirmwareState m_firmware_state;
+	uint32_t m_firmware_size;
+	uint32_t m_firmware_crc;
+	uint32_t m_firmware_check;
+	uint8_t m_firmware_operation;
+	uint32_t m_firmware_offset;
+	uint8_t m_firmware_chunk_size;
+	uint8_t m_firmware_chunk[ LICD_FRAME_SIZE ];
+
+private:
+	static LicDevice* s_instance;
 
 public:
+	LicDevice( );
+
 	LicDevice( 
 		LicDeviceReceive receive_handler, 
-		LicDeviceRequest request_handler 
+		LicDeviceRequest request_handler,
+		const uint32_t uuid = LICD_DEFAULT_UUID,
+		const uint32_t flags = 0
 	);
 
 	~LicDevice( );
 
 	void Reset( );
 
+	void Push( const float sample );
+
+	void SetRegisters( uint8_t* registers, const uint8_t size );
+
+	uint32_t ReadStream( uint8_t* data, const uint32_t size );
+
+	void SetBulkHandlers( LicDeviceBulkWrite write_handler, LicDeviceBulkRead read_handler );
+
+	void ResumeBulk( const uint8_t object, const uint32_t offset );
+
+	void SetFirmwareTarget( const LicFirmwareTarget* target );
+
+	void Update( );
+
 private:
 	void Create(
 		LicDeviceReceive receive_handler,
 		LicDeviceRequest request_handler 
-	) {
-		Wire.begin( m_address );
-		Wire.onReceive( receive_handler );
-		Wire.onRequest( request_handler );
-	};
+	);
+
+	bool DoReceiveCommand( const uint8_t command );
+
+	bool DoRequestCommand( );
+
+	void ReceiveRegisters( );
+
+	void ReceiveStream( );
+
+	void ReceiveBulkWrite( );
+
+	void ReceiveBulkQuery( const uint8_t command );
+
+	void RequestBulkRead( );
+
+	void ReceiveFirmware( );
+
+	bool WriteFirmware( const uint32_t offset, const uint8_t* data, const uint8_t size );
+
+	void RunFirmware( const uint8_t operation );
+
+	void SetFirmwareState( const LicFirmwareState state );
+
+private:
+	static uint32_t ReadOffset( );
+
+	static uint16_t ReadCRC( );
 
 private:
 	static void ReceiveAddress( int byte_count );
 
+	static void ReceiveCommand( int byte_count );
+
+	static void RequestCommand( );
+
 public:
 	bool GetIsValid( ) const;
 
 	LicDeviceAddress GetAddress( ) const;
 
+	const LicDeviceHeader& GetHeader( ) const;
+
 	LicDeviceReceive GetReceive( ) const;
 
 	LicDeviceRequest GetRequest( ) const;
 
+	LicAggregator& GetAggregator( );
+
+	uint8_t GetStreamSize( ) const;
+
+	uint32_t GetBulkOffset( const uint8_t object ) const;
+
+	LicFirmwareState GetFirmwareState( ) const;
+
 public:
+	LicDevice& operator=( const LicDevice& other );
+
 	operator bool ( ) const;
 
 	operator LicDeviceAddress ( ) const;
@@ -11,7 +11,7 @@
  * - `LicDevice`: Represents an individual I2C slave device and handles its operations.
  *
  * ## Dependencies
- * - Requires `licd.h` for shared constants, `LICD_Globals.h`, and `Wire.h`.
+ * - Requires `licd.h` for shared constants, `LICD_Globals.h`, and `licd_transport.h`.
  *
  * @author ALVES Quentin
  * @date 18/01/2025
@@ -36,16 +36,25 @@
  * @param wait_delay Delay (in milliseconds) for transmission wait time (default: 15).
  **/
 LicDeviceManager::LicDeviceManager( 
-	const uint32_t retry_count = 5,
-	const uint32_t retry_delay = 30,
-	const uint32_t wait_delay = 15
+	const uint32_t retry_count,
+	const uint32_t retry_delay,
+	const uint32_t wait_delay
 ) 
 	: m_retry_count{ retry_count },
 	m_retry_delay{ retry_delay },
 	m_wait_delay{ wait_delay },
-	m_devices{ }
+	m_devices{ },
+	m_states{ },
+	m_misses{ },
+	m_cache{ },
+	m_shadows{ },
+	m_clock{ LICD_DEFAULT_CLOCK },
+	m_is_adaptive{ true },
+	m_is_stuck{ false },
+	m_recoveries{ 0 },
+	m_poll_errors{ 0 }
 {
-	Wire.begin( );
+	BeginBus( );
 }
 
 /**
@@ -57,51 +66,381 @@ LicDeviceManager::~LicDeviceManager( ) { }
  * @brief Polls for new devices and registers them.
  *
  * This method checks if any devices are waiting for registration and assigns them a
- * dynamic I2C address.
+ * dynamic I2C address. A stuck bus is recovered first.
  **/
 void LicDeviceManager::PollDevice( ) {
-	if ( !DoPollDevice( ) )
+	Poll( m_retry_count, false );
+}
+
+/**
+ * @brief Polls once for a new device, without delays nor error messages.
+ *
+ * Meant for loops that must stay responsive or share the `Serial` port, like
+ * `LicGateway`. An empty bus costs a single listener query, errors are only
+ * counted (see `GetPollErrors`).
+ *
+ * @return true if a device was registered; false otherwise.
+ **/
+bool LicDeviceManager::PollDeviceOnce( ) {
+	return Poll( 1, true );
+}
+
+/**
+ * @brief Frees a stuck bus, restarts the transport and drops devices that stopped answering.
+ *
+ * The transport frees the bus with `LicTransport::recover`, it is then started
+ * again and every registered device is pinged with retries. A device silent for
+ * `LICD_RECOVERY_MISSES` recoveries in a row is removed from the device list so
+ * it can register again, a slave only briefly silent keeps its address.
+ *
+ * @return true if the bus is released after the recovery; false otherwise.
+ **/
+bool LicDeviceManager::RecoverBus( ) {
+	m_recoveries += 1;
+
+	LicTransport::end( );
+
+	const bool is_released = LicTransport::recover( );
+
+	BeginBus( );
+
+	m_is_stuck = false;
+
+	for ( uint8_t device_id = 0; device_id < LICD_DEVICE_COUNT; device_id++ ) {
+		if ( m_devices[ device_id ].uuid == 0 )
+			continue;
+
+		const LicDeviceAddress address = LICD_ADDRESS_SPACE + device_id;
+
+		if ( PingDevice( address ) ) {
+			SetMisses( device_id, 0 );
+
+			continue;
+		}
+
+		const uint8_t misses = GetMisses( device_id ) + 1;
+
+		if ( misses >= LICD_RECOVERY_MISSES )
+			ForgetDevice( address );
+		else
+			SetMisses( device_id, misses );
+	}
+
+	return is_released;
+}
+
+/**
+ * @brief Sets how long the answers of a device stay in the read cache.
+ *
+ * @param address I2C address of the device.
+ * @param ttl Time-to-live (in milliseconds), 0 disables caching for the device.
+ **/
+void LicDeviceManager::SetCacheTTL( const LicDeviceAddress address, const uint16_t ttl ) {
+	LicDeviceState* state = FindState( address, false );
+
+	if ( state == nullptr )
+		return;
+
+	state->cache_ttl = ttl;
+
+	if ( ttl == 0 )
+		m_cache.Invalidate( address );
+}
+
+/**
+ * @brief Drops every cached answer of a device.
+ *
+ * @param address I2C address of the device.
+ **/
+void LicDeviceManager::Invalidate( const LicDeviceAddress address ) {
+	m_cache.Invalidate( address );
+}
+
+/**
+ * @brief Drops the cached answer of a device for a command.
+ *
+ * @param address I2C address of the device.
+ * @param command Command code of the answer.
+ **/
+void LicDeviceManager::Invalidate( const LicDeviceAddress address, const uint8_t command ) {
+	m_cache.Invalidate( address, command );
+}
+
+/**
+ * @brief Sends the dirty runs of every shadow, one write per contiguous run.
+ *
+ * Meant to be called once per loop iteration, after the application staged its writes.
+ *
+ * @return true if every write succeeded; false otherwise.
+ **/
+bool LicDeviceManager::Flush( ) {
+	bool result = true;
+
+	for ( uint8_t shadow_id = 0; shadow_id < LICD_SHADOW_COUNT; shadow_id++ )
+		result = FlushShadow( m_shadows[ shadow_id ] ) && result;
+
+	return result;
+}
+
+/**
+ * @brief Sends the dirty runs of a device shadow.
+ *
+ * @param address I2C address of the device.
+ * @return true if the write succeeded or nothing was staged; false otherwise.
+ **/
+bool LicDeviceManager::Flush( const LicDeviceAddress address ) {
+	LicShadowRegister* shadow = FindShadow( address, false );
+
+	return ( shadow == nullptr ) || FlushShadow( *shadow );
+}
+
+/**
+ * @brief Writes a range of a device register block, bypassing its shadow.
+ *
+ * Staged bytes of the range are dropped, a later flush does not overwrite the
+ * written value.
+ *
+ * @param address I2C address of the device.
+ * @param offset Register offset of the first byte.
+ * @param data Pointer to the data to write.
+ * @param size Size of the data in bytes.
+ * @return true if the write succeeded; false otherwise, or when the device
+ * payload leaves no room for data.
+ **/
+bool LicDeviceManager::WriteRegisters( 
+	const LicDeviceAddress address,
+	const uint8_t offset,
+	const uint8_t* data,
+	const uint32_t size
+) {
+	LicShadowRegister* shadow = FindShadow( address, false );
+
+	if ( shadow != nullptr )
+		shadow->Clean( offset, size );
+
+	return SendRegisters( address, offset, data, size );
+}
+
+/**
+ * @brief Streams data to a device without overrunning its stream buffer.
+ *
+ * The master keeps the last credit count advertised by the device and decrements
+ * it for every byte sent. Credits are only queried again once exhausted, so a
+ * device draining its buffer fast enough is fed without extra transactions.
+ *
+ * @param address I2C address of the device.
+ * @param data Pointer to the data to stream.
+ * @param size Size of the data in bytes.
+ * @return The number of bytes accepted by the device.
+ **/
+uint32_t LicDeviceManager::Stream( const LicDeviceAddress address, const uint8_t* data, const uint32_t size ) {
+	if ( !GetIsRegistered( address ) || GetPayloadSize( address ) <= 1 )
+		return 0;
+
+	LicDeviceState* state = FindState( address, false );
+	uint16_t credits = ( state != nullptr ) ? state->credits : 0;
+	uint32_t data_offset = 0;
+
+	while ( data_offset < size ) {
+		if ( credits == 0 ) {
+			credits = QueryCredits( address );
+
+			if ( credits == 0 )
+				break;
+		}
+
+		uint32_t chunk_size = size - data_offset;
+
+		if ( chunk_size > credits )
+			chunk_size = credits;
+
+		if ( chunk_size > GetPayloadSize( address ) - 1u )
+			chunk_size = GetPayloadSize( address ) - 1u;
+
+		BeginTransmission( address );
+		LicTransport::write( LICD_COMMAND_STREAM );
+		WireHelper::write( data + data_offset, chunk_size );
+
+		if ( EndTransmission( address, false ) != 0 ) {
+			credits = 0;
+
+			break;
+		}
+
+		credits -= chunk_size;
+		data_offset += chunk_size;
+	}
+
+	if ( state != nullptr )
+		state->credits = credits;
+
+	return data_offset;
+}
+
+/**
+ * @brief Advances a bulk object transfer by a few chunks.
+ *
+ * @param transfer Transfer to advance.
+ * @param chunk_count Maximum number of chunks exchanged by this call.
+ * @return true if the transfer progressed or is done; false on bus error, when
+ * a push stalled on chunks the device rejects, or when the device payload
+ * cannot hold a chunk header and data.
+ **/
+bool LicDeviceManager::Transfer( LicBulkTransfer& transfer, const uint8_t chunk_count ) {
+	if ( transfer.GetIsDone( ) )
+		return true;
+
+	if ( transfer.GetDirection( ) == LICD_BULK_PUSH )
+		return TransferPush( transfer, chunk_count );
+
+	return TransferPull( transfer, chunk_count );
+}
+
+/**
+ * @brief Advances several firmware updates, interleaving their devices on the bus.
+ *
+ * @param sessions Pointer to the sessions.
+ * @param session_count Number of sessions.
+ * @param chunk_count Maximum number of chunks sent per session and per call.
+ * @return The number of sessions still running.
+ **/
+uint8_t LicDeviceManager::UpdateFirmware( 
+	LicFirmwareSession* sessions,
+	const uint8_t session_count,
+	const uint8_t chunk_count
+) {
+	uint8_t running_count = 0;
+
+	for ( uint8_t session_id = 0; session_id < session_count; session_id++ ) {
+		LicFirmwareSession& session = sessions[ session_id ];
+
+		if ( session.GetIsDone( ) )
+			continue;
+
+		StepFirmware( session, chunk_count );
+
+		if ( !session.GetIsDone( ) )
+			running_count += 1;
+	}
+
+	return running_count;
+}
+
+/**
+ * @brief Enables or disables adaptive clock scaling.
+ *
+ * Disabling it keeps every device at its current clock.
+ *
+ * @param is_adaptive Whether device clocks follow the observed error rate.
+ **/
+void LicDeviceManager::SetAdaptiveClock( const bool is_adaptive ) {
+	m_is_adaptive = is_adaptive;
+}
+
+/**
+ * @brief Resets the statistics of a device, keeping its current clock.
+ *
+ * @param address I2C address of the device.
+ **/
+void LicDeviceManager::ResetStats( const LicDeviceAddress address ) {
+	LicDeviceState* state = FindState( address, false );
+
+	if ( state == nullptr )
 		return;
 
-	uint8_t new_address = RegisterDevice( );
+	state->stats = LicDeviceStats( );
+	state->stats.clock = state->clock;
+}
+
+/**
+ * @brief Fetches the aggregate computed by a device.
+ *
+ * @param address I2C address of the device.
+ * @param aggregate Aggregate to fill.
+ * @return true if the aggregate was read; false otherwise.
+ **/
+bool LicDeviceManager::ReadAggregate( const LicDeviceAddress address, LicAggregate& aggregate ) {
+	return Read( address, LICD_COMMAND_AGGREGATE, &aggregate, 1 );
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Polls for a new device and registers it.
+ *
+ * A stuck bus is recovered first.
+ *
+ * @param retry_count Number of listener queries before giving up.
+ * @param is_quiet Whether errors are only counted, without delays nor messages.
+ * @return true if a device was registered; false otherwise.
+ **/
+bool LicDeviceManager::Poll( const uint32_t retry_count, const bool is_quiet ) {
+	if ( DetectStuckBus( ) )
+		RecoverBus( );
+
+	if ( !DoPollDevice( retry_count, is_quiet ) )
+		return false;
+
+	uint8_t new_address = RegisterDevice( is_quiet );
 
-    Wire.beginTransmission( LICD_LISTENER_ADDRESS );
+    BeginTransmission( LICD_LISTENER_ADDRESS );
     	
     if ( new_address > LICD_LISTENER_ADDRESS ) {
-    	Wire.write( LICD_COMMAND_ASSIGN );
-    	Wire.write( new_address );
+    	m_cache.Invalidate( new_address );
+
+    	LicShadowRegister* shadow = FindShadow( new_address, false );
+
+    	if ( shadow != nullptr )
+    		shadow->Bind( 0 );
+
+    	LicTransport::write( LICD_COMMAND_ASSIGN );
+    	LicTransport::write( new_address );
     } else 
-    	Wire.write( LICD_COMMAND_RETRY );
+    	LicTransport::write( LICD_COMMAND_RETRY );
 
-    Wire.endTransmission( );
-}
+    LicTransport::endTransmission( true );
 
-// PRIVATE METHODS
+    return ( new_address > LICD_LISTENER_ADDRESS );
+}
 
 /**
  * @brief Checks for devices waiting to be registered.
  *
- * Sends a UUID query command to detect devices ready for registration.
+ * Sends a UUID query command to detect devices ready for registration. An
+ * address NACK means no device is waiting, it is not counted as an error.
  *
+ * @param retry_count Number of listener queries before giving up.
+ * @param is_quiet Whether errors are only counted, without delays nor messages.
  * @return true if a device is waiting for registration, false otherwise.
  **/
-bool LicDeviceManager::DoPollDevice( ) {
+bool LicDeviceManager::DoPollDevice( const uint32_t retry_count, const bool is_quiet ) {
 	uint32_t error = 5;
 
-	for ( uint32_t retry_count = 0; error > 0 && retry_count < m_retry_count; retry_count++ ) {
-		Wire.beginTransmission( LICD_LISTENER_ADDRESS );
-		Wire.write( LICD_COMMAND_UUID );
+	for ( uint32_t retry_id = 0; error > 0 && retry_id < retry_count; retry_id++ ) {
+		BeginTransmission( LICD_LISTENER_ADDRESS );
+		LicTransport::write( LICD_COMMAND_UUID );
 
-		error = Wire.endTransmission( );
+		error = LicTransport::endTransmission( true );
 
-		delay( m_retry_delay );
+		if ( !is_quiet )
+			LicClock::sleep( (uint64_t)m_retry_delay * 1000 );
 	}
 
+	if ( error == LICD_WIRE_TIMEOUT_ERROR )
+		m_is_stuck = true;
+
+	if ( error != 0 && error != 2 )
+		m_poll_errors += 1;
+
+	if ( is_quiet )
+		return ( error == 0 );
+
 	switch ( error ) {
 		case 1 : Serial.print( "[ERR] Wire : Data too long to fit in transmit buffer." ); break;
 		case 2 : Serial.print( "[ERR] Wire : Received NACK on transmit of address." ); break;
 		case 3 : Serial.print( "[ERR] Wire : Received NACK on transmit of data." ); break;
 		case 4 : Serial.print( "[ERR] Wire : Undefined error behavior." ); break;
+		case LICD_WIRE_TIMEOUT_ERROR : Serial.print( "[ERR] Wire : Transmission timeout, bus may be stuck." ); break;
 
 		default : break;
 	}
@@ -113,32 +452,1004 @@ bool LicDeviceManager::DoPollDevice( ) {
  * @brief Registers a new device and assigns it an I2C address.
  *
  * Reads the device header and assigns a unique address from the available address space.
+ * A slave that reset answers a UUID already in the list: its previous address
+ * is forgotten then assigned again, so the stale entry does not stay registered.
+ * The default UUID is never matched, many devices share it.
  *
+ * @param is_quiet Whether errors are only counted, without messages.
  * @return The assigned I2C address for the new device.
  **/
-uint8_t LicDeviceManager::RegisterDevice( ) {
+uint8_t LicDeviceManager::RegisterDevice( const bool is_quiet ) {
 	LicDeviceHeader header = LicDeviceHeader( );
 	uint8_t new_address = LICD_LISTENER_ADDRESS;
 
-	delay( m_wait_delay );
+	LicClock::sleep( (uint64_t)m_wait_delay * 1000 );
+
+	LicTransport::requestFrom( (uint8_t)LICD_LISTENER_ADDRESS, (uint8_t)sizeof( LicDeviceHeader ) );
 
-	Wire.requestFrom( LICD_LISTENER_ADDRESS, sizeof( LicDeviceHeader ) );
+	LicClock::sleep( (uint64_t)m_wait_delay * 1000 );
 
-	delay( m_wait_delay );
+	if ( WireHelper::read( &header, 1, 150 ) ) {
+		uint8_t address_offset = FindDevice( header.uuid );
 
-	if ( WireHelper.read( &header, 1, 150 ) ) {
-		uint8_t address_offset = 0;
+		if ( address_offset < LICD_DEVICE_COUNT )
+			ForgetDevice( LICD_ADDRESS_SPACE + address_offset );
+		else
+			address_offset = 0;
 
 		while ( ( new_address == LICD_LISTENER_ADDRESS ) && ( address_offset < LICD_DEVICE_COUNT ) ) {
-			if ( m_devices[ address_offset ].uuid > 0 )
+			if ( m_devices[ address_offset ].uuid > 0 ) {
+				address_offset += 1;
+
 				continue;
+			}
 
 			new_address = ( LICD_ADDRESS_SPACE + address_offset );
 
 			memcpy( &m_devices[ address_offset ], &header, sizeof( LicDeviceHeader ) );
+
+			LicDeviceState* state = FindState( new_address, true );
+
+			if ( state != nullptr ) {
+				*state = LicDeviceState( );
+				state->address = new_address;
+				state->clock = GetClockCeiling( new_address );
+				state->stats.clock = state->clock;
+			}
 		}
-	} else
-		Serial.print( "[ERR] Wire : Data too short or too long to fit the transmit buffer.");
+	} else {
+		m_poll_errors += 1;
+
+		if ( !is_quiet )
+			Serial.print( "[ERR] Wire : Data too short or too long to fit the transmit buffer." );
+	}
 
 	return new_address;
 }
+
+/**
+ * @brief Sends a command to a device and reads its answer through the read cache.
+ *
+ * @param address I2C address of the device.
+ * @param command Command code sent before the request.
+ * @param data Pointer to the memory where the answer will be stored.
+ * @param size Size of the answer in bytes.
+ * @return true if the whole answer was read; false otherwise.
+ **/
+bool LicDeviceManager::ReadBytes( 
+	const LicDeviceAddress address,
+	const uint8_t command,
+	uint8_t* data,
+	const uint32_t size
+) {
+	if ( size == 0 || size > LICD_FRAME_SIZE )
+		return false;
+
+	const LicDeviceState* state = FindState( address );
+	const uint16_t ttl = ( state != nullptr ) ? state->cache_ttl : 0;
+	const uint32_t now = LicClock::millis( );
+
+	if ( ttl > 0 && m_cache.Fetch( address, command, data, size, now ) )
+		return true;
+
+	BeginTransmission( address );
+	LicTransport::write( command );
+
+	if ( EndTransmission( address, true ) != 0 )
+		return false;
+
+	LicTransport::requestFrom( (uint8_t)address, (uint8_t)size );
+
+	if ( !ReadReply( address, data, size ) )
+		return false;
+
+	m_cache.Store( address, command, data, size, now, ttl );
+
+	return true;
+}
+
+/**
+ * @brief Stages a register write in the device shadow.
+ *
+ * @param address I2C address of the device.
+ * @param offset Register offset of the first byte.
+ * @param data Pointer to the data to write.
+ * @param size Size of the data in bytes.
+ * @return true if the write was staged or sent; false otherwise.
+ **/
+bool LicDeviceManager::StageBytes( 
+	const LicDeviceAddress address,
+	const uint8_t offset,
+	const uint8_t* data,
+	const uint32_t size
+) {
+	LicShadowRegister* shadow = FindShadow( address, true );
+
+	if ( shadow != nullptr && size <= LICD_SHADOW_SIZE && shadow->Stage( offset, data, (uint8_t)size ) )
+		return true;
+
+	return WriteRegisters( address, offset, data, size );
+}
+
+/**
+ * @brief Sends the dirty runs of a shadow, marking each run clean once sent.
+ *
+ * Each contiguous run is its own write, bytes between two runs are never sent.
+ *
+ * @param shadow Shadow to flush.
+ * @return true if every write succeeded or nothing was staged; false otherwise.
+ **/
+bool LicDeviceManager::FlushShadow( LicShadowRegister& shadow ) {
+	uint8_t offset = 0;
+	uint8_t size = 0;
+
+	while ( shadow.GetDirtyRun( offset, size ) ) {
+		if ( !SendRegisters( shadow.GetAddress( ), offset, shadow.GetData( offset ), size ) )
+			return false;
+
+		shadow.Clean( offset, size );
+	}
+
+	return true;
+}
+
+/**
+ * @brief Sends a range of a device register block, in as many writes as needed.
+ *
+ * Ranges larger than the device payload are split in several writes, each one
+ * ends with a CRC-16 of its offset and data when the device supports it.
+ *
+ * @param address I2C address of the device.
+ * @param offset Register offset of the first byte.
+ * @param data Pointer to the data to write.
+ * @param size Size of the data in bytes.
+ * @return true if every write succeeded; false otherwise, or when the device
+ * payload leaves no room for data.
+ **/
+bool LicDeviceManager::SendRegisters( 
+	const LicDeviceAddress address,
+	const uint8_t offset,
+	const uint8_t* data,
+	const uint32_t size
+) {
+	const bool is_checked = LicCapabilities::has( GetCapabilities( address ), LICD_CAPABILITY_CRC );
+	const uint32_t header_size = is_checked ? 4 : 2;
+
+	if ( GetPayloadSize( address ) <= header_size )
+		return false;
+
+	const uint32_t chunk_capacity = GetPayloadSize( address ) - header_size;
+
+	m_cache.Invalidate( address );
+
+	for ( uint32_t data_offset = 0; data_offset < size; data_offset += chunk_capacity ) {
+		const uint32_t chunk_size = ( size - data_offset < chunk_capacity ) ? size - data_offset : chunk_capacity;
+		const uint8_t chunk_offset = (uint8_t)( offset + data_offset );
+
+		BeginTransmission( address );
+		LicTransport::write( LICD_COMMAND_REGISTER );
+		LicTransport::write( chunk_offset );
+		WireHelper::write( data + data_offset, chunk_size );
+
+		if ( is_checked ) {
+			const uint16_t crc = LicCRC::crc16( data + data_offset, chunk_size, LicCRC::crc16( &chunk_offset, 1 ) );
+
+			WireHelper::write( &crc, 1 );
+		}
+
+		if ( EndTransmission( address, false ) != 0 )
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Finds the shadow bound to a device, binding a free one if requested.
+ *
+ * @param address I2C address of the device.
+ * @param bind Whether a free shadow is bound when none matches.
+ * @return Pointer to the shadow, nullptr if none is available.
+ **/
+LicShadowRegister* LicDeviceManager::FindShadow( const LicDeviceAddress address, const bool bind ) {
+	LicShadowRegister* free_shadow = nullptr;
+
+	for ( uint8_t shadow_id = 0; shadow_id < LICD_SHADOW_COUNT; shadow_id++ ) {
+		LicShadowRegister& shadow = m_shadows[ shadow_id ];
+
+		if ( shadow.GetAddress( ) == address )
+			return &shadow;
+
+		if ( free_shadow == nullptr && shadow.GetAddress( ) == 0 )
+			free_shadow = &shadow;
+	}
+
+	if ( bind && free_shadow != nullptr )
+		free_shadow->Bind( address );
+
+	return bind ? free_shadow : nullptr;
+}
+
+/**
+ * @brief Queries the free space of a device stream buffer.
+ *
+ * Credits are never cached by the read cache, a stale value would overrun the device.
+ *
+ * @param address I2C address of the device.
+ * @return The number of bytes the device can accept, 0 on failure.
+ **/
+uint16_t LicDeviceManager::QueryCredits( const LicDeviceAddress address ) {
+	uint16_t credits = 0;
+
+	BeginTransmission( address );
+	LicTransport::write( LICD_COMMAND_CREDIT );
+
+	if ( EndTransmission( address, true ) != 0 )
+		return 0;
+
+	LicTransport::requestFrom( (uint8_t)address, (uint8_t)sizeof( uint16_t ) );
+
+	if ( !ReadReply( address, &credits, 1 ) )
+		return 0;
+
+	return credits;
+}
+
+/**
+ * @brief Advances a bulk push transfer.
+ *
+ * Chunks are sent back to back from the checkpoint, the device drops any chunk
+ * that does not extend its checkpoint so a lost chunk only costs the chunks sent
+ * after it in the same call. A device rejecting every chunk, on a CRC mismatch
+ * or an object too large for it, leaves the checkpoint in place: the call then
+ * reports a stall instead of a progress.
+ *
+ * @param transfer Transfer to advance.
+ * @param chunk_count Maximum number of chunks sent.
+ * @return true if the checkpoint moved or the transfer is done; false on bus
+ * error, when the device acknowledged no chunk, or when the device payload
+ * cannot hold a chunk header and data.
+ **/
+bool LicDeviceManager::TransferPush( LicBulkTransfer& transfer, const uint8_t chunk_count ) {
+	const uint8_t address = transfer.GetAddress( );
+
+	if ( GetPayloadSize( address ) <= LICD_BULK_HEADER_SIZE )
+		return false;
+
+	if ( !transfer.GetIsSynced( ) && !SyncBulk( transfer ) )
+		return false;
+
+	const uint8_t* data = transfer.GetData( );
+	const uint32_t chunk_capacity = GetPayloadSize( address ) - LICD_BULK_HEADER_SIZE;
+	const uint32_t start = transfer.GetOffset( );
+	uint32_t offset = start;
+
+	for ( uint8_t chunk_id = 0; chunk_id < chunk_count && offset < transfer.GetSize( ); chunk_id++ ) {
+		uint32_t chunk_size = transfer.GetSize( ) - offset;
+
+		if ( chunk_size > chunk_capacity )
+			chunk_size = chunk_capacity;
+
+		const uint16_t crc = LicBulkTransfer::ComputeCRC( transfer.GetObject( ), offset, data + offset, chunk_size );
+
+		BeginTransmission( address );
+		WriteBulkHeader( LICD_COMMAND_BULK_WRITE, transfer.GetObject( ), offset );
+		WireHelper::write( &crc, 1 );
+		WireHelper::write( data + offset, chunk_size );
+
+		if ( EndTransmission( address, false ) != 0 ) {
+			transfer.Desync( );
+
+			return false;
+		}
+
+		offset += chunk_size;
+	}
+
+	m_cache.Invalidate( address );
+
+	if ( !SyncBulk( transfer ) )
+		return false;
+
+	return transfer.GetIsDone( ) || transfer.GetOffset( ) > start;
+}
+
+/**
+ * @brief Advances a bulk pull transfer.
+ *
+ * A chunk shorter than requested marks the end of the object. A chunk failing
+ * its CRC-16 is requested again on the next call.
+ *
+ * @param transfer Transfer to advance.
+ * @param chunk_count Maximum number of chunks requested.
+ * @return true if the transfer progressed or is done; false on bus error, or
+ * when the device payload cannot hold a chunk header and data.
+ **/
+bool LicDeviceManager::TransferPull( LicBulkTransfer& transfer, const uint8_t chunk_count ) {
+	const uint8_t address = transfer.GetAddress( );
+	uint8_t* data = transfer.GetData( );
+
+	if ( GetPayloadSize( address ) <= 3 )
+		return false;
+
+	for ( uint8_t chunk_id = 0; chunk_id < chunk_count && !transfer.GetIsDone( ); chunk_id++ ) {
+		const uint32_t offset = transfer.GetOffset( );
+		uint32_t request_size = transfer.GetSize( ) - offset;
+		uint8_t chunk_size = 0;
+		uint16_t crc = 0;
+
+		if ( request_size > GetPayloadSize( address ) - 3u )
+			request_size = GetPayloadSize( address ) - 3u;
+
+		BeginTransmission( address );
+		WriteBulkHeader( LICD_COMMAND_BULK_READ, transfer.GetObject( ), offset );
+		LicTransport::write( (uint8_t)request_size );
+
+		if ( EndTransmission( address, true ) != 0 )
+			return false;
+
+		LicTransport::requestFrom( (uint8_t)address, (uint8_t)( request_size + 3 ) );
+
+		if ( !ReadReply( address, &chunk_size, 1 ) || chunk_size > request_size )
+			return false;
+
+		if ( !ReadReply( address, &crc, 1 ) )
+			return false;
+
+		if ( chunk_size > 0 && !ReadReply( address, data + offset, chunk_size ) )
+			return false;
+
+		if ( crc != LicBulkTransfer::ComputeCRC( transfer.GetObject( ), offset, data + offset, chunk_size ) ) {
+			RecordError( address, LICD_ERROR_CRC );
+
+			return false;
+		}
+
+		transfer.Checkpoint( offset + chunk_size );
+
+		if ( chunk_size < request_size )
+			transfer.Complete( );
+	}
+
+	return true;
+}
+
+/**
+ * @brief Reads the checkpoint of a bulk transfer from its device.
+ *
+ * @param transfer Transfer to synchronize.
+ * @return true if the checkpoint was read; false otherwise.
+ **/
+bool LicDeviceManager::SyncBulk( LicBulkTransfer& transfer ) {
+	const uint8_t address = transfer.GetAddress( );
+	uint32_t offset = 0;
+
+	BeginTransmission( address );
+	LicTransport::write( LICD_COMMAND_BULK_STATUS );
+	LicTransport::write( transfer.GetObject( ) );
+
+	if ( EndTransmission( address, true ) != 0 ) {
+		transfer.Desync( );
+
+		return false;
+	}
+
+	LicTransport::requestFrom( (uint8_t)address, (uint8_t)sizeof( uint32_t ) );
+
+	if ( !ReadReply( address, &offset, 1 ) ) {
+		transfer.Desync( );
+
+		return false;
+	}
+
+	transfer.Checkpoint( offset );
+
+	return true;
+}
+
+/**
+ * @brief Writes a bulk chunk header : command, object and little-endian offset.
+ *
+ * @param command Bulk command code.
+ * @param object Object identifier.
+ * @param offset Chunk offset.
+ **/
+void LicDeviceManager::WriteBulkHeader( const uint8_t command, const uint8_t object, const uint32_t offset ) {
+	LicTransport::write( command );
+	LicTransport::write( object );
+
+	for ( uint8_t byte_id = 0; byte_id < 4; byte_id++ )
+		LicTransport::write( (uint8_t)( offset >> ( 8 * byte_id ) ) );
+}
+
+/**
+ * @brief Advances the firmware update of a single device by one step.
+ *
+ * A transfer that stops progressing because the device lost its staging state,
+ * after a reset for instance, starts over from the begin step.
+ *
+ * A device answering `LICD_FIRMWARE_BUSY` is polled with status queries until
+ * its `LicDevice::Update` ran the operation.
+ *
+ * @param session Session to advance.
+ * @param chunk_count Maximum number of chunks sent.
+ **/
+void LicDeviceManager::StepFirmware( LicFirmwareSession& session, const uint8_t chunk_count ) {
+	LicBulkTransfer& transfer = session.GetTransfer( );
+	LicFirmwareState state = LICD_FIRMWARE_IDLE;
+
+	switch ( session.GetStep( ) ) {
+		case LICD_FIRMWARE_STEP_BEGIN : 
+			if ( !SendFirmware( session, LICD_FIRMWARE_BEGIN, state ) )
+				session.Fail( );
+			else if ( state == LICD_FIRMWARE_RECEIVING )
+				session.SetStep( LICD_FIRMWARE_STEP_TRANSFER );
+			else if ( state == LICD_FIRMWARE_BUSY )
+				session.SetStep( LICD_FIRMWARE_STEP_BEGIN_WAIT );
+			else
+				session.Fail( );
+
+			break;
+
+		case LICD_FIRMWARE_STEP_BEGIN_WAIT : 
+			if ( !SendFirmware( session, LICD_FIRMWARE_STATUS, state ) )
+				session.Fail( );
+			else if ( state == LICD_FIRMWARE_RECEIVING )
+				session.SetStep( LICD_FIRMWARE_STEP_TRANSFER );
+			else if ( state != LICD_FIRMWARE_BUSY )
+				session.Retry( LICD_FIRMWARE_STEP_BEGIN );
+
+			break;
+
+		case LICD_FIRMWARE_STEP_TRANSFER : {
+			const uint32_t offset = transfer.GetOffset( );
+
+			if ( !Transfer( transfer, chunk_count ) )
+				session.Fail( );
+			else if ( transfer.GetIsDone( ) )
+				session.SetStep( LICD_FIRMWARE_STEP_COMMIT );
+			else if ( transfer.GetOffset( ) > offset )
+				session.SetStep( LICD_FIRMWARE_STEP_TRANSFER );
+			else if ( SendFirmware( session, LICD_FIRMWARE_STATUS, state ) && state != LICD_FIRMWARE_RECEIVING )
+				session.Retry( LICD_FIRMWARE_STEP_BEGIN );
+			else
+				session.Fail( );
+
+			break;
+		}
+
+		case LICD_FIRMWARE_STEP_COMMIT : 
+		case LICD_FIRMWARE_STEP_COMMIT_WAIT : {
+			const bool is_waiting = session.GetStep( ) == LICD_FIRMWARE_STEP_COMMIT_WAIT;
+
+			if ( !SendFirmware( session, is_waiting ? LICD_FIRMWARE_STATUS : LICD_FIRMWARE_COMMIT, state ) )
+				session.Fail( );
+			else if ( state == LICD_FIRMWARE_VERIFIED )
+				session.SetStep( LICD_FIRMWARE_STEP_REBOOT );
+			else if ( state == LICD_FIRMWARE_BUSY )
+				session.SetStep( LICD_FIRMWARE_STEP_COMMIT_WAIT );
+			else
+				session.SetStep( LICD_FIRMWARE_STEP_FAILED );
+
+			break;
+		}
+
+		case LICD_FIRMWARE_STEP_REBOOT : {
+			const uint8_t address = transfer.GetAddress( );
+
+			BeginTransmission( address );
+			LicTransport::write( LICD_COMMAND_FIRMWARE );
+			LicTransport::write( LICD_FIRMWARE_REBOOT );
+
+			if ( EndTransmission( address, false ) != 0 ) {
+				session.Fail( );
+
+				break;
+			}
+
+			ForgetDevice( address );
+			session.SetStep( LICD_FIRMWARE_STEP_DONE );
+
+			break;
+		}
+
+		default : break;
+	}
+}
+
+/**
+ * @brief Sends a firmware operation and reads the resulting device state.
+ *
+ * The begin operation carries the image size and CRC-32.
+ *
+ * @param session Session of the device.
+ * @param operation Firmware operation.
+ * @param state Firmware state answered by the device.
+ * @return true if the state was read; false otherwise.
+ **/
+bool LicDeviceManager::SendFirmware( 
+	LicFirmwareSession& session,
+	const LicFirmwareOperation operation,
+	LicFirmwareState& state
+) {
+	const uint8_t address = session.GetTransfer( ).GetAddress( );
+	uint8_t answer = LICD_FIRMWARE_IDLE;
+
+	BeginTransmission( address );
+	LicTransport::write( LICD_COMMAND_FIRMWARE );
+	LicTransport::write( operation );
+
+	if ( operation == LICD_FIRMWARE_BEGIN ) {
+		const uint32_t header[ 2 ] = { session.GetTransfer( ).GetSize( ), session.GetCRC( ) };
+
+		WireHelper::write( header, 2 );
+	}
+
+	if ( EndTransmission( address, true ) != 0 )
+		return false;
+
+	LicTransport::requestFrom( (uint8_t)address, (uint8_t)1 );
+
+	if ( !ReadReply( address, &answer, 1 ) )
+		return false;
+
+	state = (LicFirmwareState)answer;
+
+	return true;
+}
+
+/**
+ * @brief Starts the transport as master at the current clock, with transaction timeouts when available.
+ **/
+void LicDeviceManager::BeginBus( ) {
+	LicTransport::begin( );
+	LicTransport::setClock( m_clock );
+	LicTransport::setTimeout( LICD_WIRE_TIMEOUT );
+}
+
+/**
+ * @brief Checks if the bus looks stuck.
+ *
+ * The bus is stuck when a transaction timed out since the last check, or when
+ * a peer holds the bus while the master is idle.
+ *
+ * @return true if the bus needs a recovery; false otherwise.
+ **/
+bool LicDeviceManager::DetectStuckBus( ) {
+	if ( LicTransport::getTimeoutFlag( ) || !LicTransport::isIdle( ) )
+		m_is_stuck = true;
+
+	return m_is_stuck;
+}
+
+/**
+ * @brief Removes a device from the device list and drops its master-side state.
+ *
+ * @param address I2C address of the device.
+ **/
+void LicDeviceManager::ForgetDevice( const LicDeviceAddress address ) {
+	const uint8_t device_id = GetDeviceIndex( address );
+
+	if ( device_id == LICD_DEVICE_COUNT )
+		return;
+
+	LicShadowRegister* shadow = FindShadow( address, false );
+	LicDeviceState* state = FindState( address, false );
+
+	if ( shadow != nullptr )
+		shadow->Bind( 0 );
+
+	if ( state != nullptr )
+		*state = LicDeviceState( );
+
+	m_devices[ device_id ] = LicDeviceHeader( );
+	m_cache.Invalidate( address );
+
+	SetMisses( device_id, 0 );
+}
+
+/**
+ * @brief Pings a device, retrying up to the retry count.
+ *
+ * A slave busy right after a recovery gets the retry delay between two pings.
+ *
+ * @param address I2C address of the device.
+ * @return true if the device acknowledged its address; false otherwise.
+ **/
+bool LicDeviceManager::PingDevice( const LicDeviceAddress address ) {
+	for ( uint32_t retry_id = 0; retry_id == 0 || retry_id < m_retry_count; retry_id++ ) {
+		if ( retry_id > 0 )
+			LicClock::sleep( (uint64_t)m_retry_delay * 1000 );
+
+		BeginTransmission( address );
+
+		if ( EndTransmission( address, false ) == 0 )
+			return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Stores the number of recoveries in a row a device stayed silent.
+ *
+ * @param device_id Index of the device.
+ * @param misses Number of silent recoveries, at most 3.
+ **/
+void LicDeviceManager::SetMisses( const uint8_t device_id, const uint8_t misses ) {
+	const uint8_t shift = 2 * ( device_id % 4 );
+
+	m_misses[ device_id / 4 ] = ( m_misses[ device_id / 4 ] & ~( 0x03 << shift ) ) | ( ( misses & 0x03 ) << shift );
+}
+
+/**
+ * @brief Starts a transmission to a device at the bus clock it supports.
+ *
+ * `LicTransport::setClock` is only called when the clock differs from the previous
+ * transaction, consecutive transactions with a device cost nothing extra.
+ *
+ * @param address I2C address of the device.
+ **/
+void LicDeviceManager::BeginTransmission( const LicDeviceAddress address ) {
+	const uint32_t clock = GetClock( address );
+
+	if ( clock != m_clock ) {
+		m_clock = clock;
+
+		LicTransport::setClock( clock );
+	}
+
+	LicTransport::beginTransmission( address );
+}
+
+/**
+ * @brief Ends a transmission to a device.
+ *
+ * A transmission followed by a request keeps the bus with a repeated start when
+ * the device advertises `LICD_CAPABILITY_REPEATED_START`.
+ *
+ * @param address I2C address of the device.
+ * @param is_query Whether a request to the same device follows.
+ * @return The `LicTransport::endTransmission` status, 0 on success.
+ **/
+uint8_t LicDeviceManager::EndTransmission( const LicDeviceAddress address, const bool is_query ) {
+	const bool keep_bus = is_query && LicCapabilities::has( GetCapabilities( address ), LICD_CAPABILITY_REPEATED_START );
+	const uint8_t error = LicTransport::endTransmission( !keep_bus );
+
+	if ( error == LICD_WIRE_TIMEOUT_ERROR )
+		m_is_stuck = true;
+
+	RecordTransaction( address );
+
+	if ( error != 0 )
+		RecordError( address, LICD_ERROR_NACK );
+
+	return error;
+}
+
+/**
+ * @brief Counts a transaction in the device statistics and clock window.
+ *
+ * @param address I2C address of the device.
+ **/
+void LicDeviceManager::RecordTransaction( const LicDeviceAddress address ) {
+	LicDeviceState* state = FindState( address, false );
+
+	if ( state == nullptr )
+		return;
+
+	state->stats.transactions += 1;
+	state->window_transactions += 1;
+
+	if ( state->window_transactions < LICD_CLOCK_WINDOW )
+		return;
+
+	if ( state->window_errors == 0 ) {
+		state->clean_windows += 1;
+
+		if ( state->clean_windows >= LICD_CLOCK_CLEAN_WINDOWS ) {
+			state->clean_windows = 0;
+
+			StepClock( address, *state, true );
+		}
+	} else
+		state->clean_windows = 0;
+
+	state->window_transactions = 0;
+	state->window_errors = 0;
+}
+
+/**
+ * @brief Counts an error in the device statistics and clock window.
+ *
+ * Once `LICD_CLOCK_ERROR_THRESHOLD` errors are counted in the current window,
+ * the device clock steps down immediately and a new window starts.
+ *
+ * @param address I2C address of the device.
+ * @param error Kind of error.
+ **/
+void LicDeviceManager::RecordError( const LicDeviceAddress address, const LicDeviceError error ) {
+	LicDeviceState* state = FindState( address, false );
+
+	if ( state == nullptr )
+		return;
+
+	switch ( error ) {
+		case LICD_ERROR_NACK : state->stats.nack_errors += 1; break;
+		case LICD_ERROR_READ : state->stats.read_errors += 1; break;
+		case LICD_ERROR_CRC : state->stats.crc_errors += 1; break;
+
+		default : return;
+	}
+
+	state->clean_windows = 0;
+	state->window_errors += 1;
+
+	if ( state->window_errors < LICD_CLOCK_ERROR_THRESHOLD )
+		return;
+
+	StepClock( address, *state, false );
+
+	state->window_transactions = 0;
+	state->window_errors = 0;
+}
+
+/**
+ * @brief Moves a device clock one step up or down the clock ladder.
+ *
+ * The clock never goes above the device capability clamped to `LICD_MASTER_CLOCK`,
+ * nor below the lowest ladder step.
+ *
+ * @param address I2C address of the device.
+ * @param state Runtime state of the device.
+ * @param is_up Whether the clock steps up.
+ **/
+void LicDeviceManager::StepClock( const LicDeviceAddress address, LicDeviceState& state, const bool is_up ) {
+	static const uint32_t clocks[] = { 10000, 50000, 100000, 400000, 1000000, 3400000 };
+	static const uint8_t clock_count = sizeof( clocks ) / sizeof( clocks[ 0 ] );
+
+	if ( !m_is_adaptive )
+		return;
+
+	const uint32_t ceiling = GetClockCeiling( address );
+	uint8_t clock_id = 0;
+
+	while ( clock_id + 1 < clock_count && clocks[ clock_id + 1 ] <= state.clock )
+		clock_id += 1;
+
+	if ( is_up ) {
+		if ( clock_id + 1 >= clock_count || clocks[ clock_id + 1 ] > ceiling )
+			return;
+
+		state.clock = clocks[ clock_id + 1 ];
+		state.stats.clock_ups += 1;
+	} else {
+		if ( clocks[ clock_id ] < state.clock )
+			state.clock = clocks[ clock_id ];
+		else if ( clock_id > 0 )
+			state.clock = clocks[ clock_id - 1 ];
+		else
+			return;
+
+		state.stats.clock_downs += 1;
+	}
+
+	state.stats.clock = state.clock;
+}
+
+/**
+ * @brief Finds the state bound to a device, binding a free one if requested.
+ *
+ * @param address I2C address of the device.
+ * @param bind Whether a free state is bound when none matches.
+ * @return Pointer to the state, nullptr if none is available.
+ **/
+LicDeviceState* LicDeviceManager::FindState( const LicDeviceAddress address, const bool bind ) {
+	LicDeviceState* free_state = nullptr;
+
+	if ( address < LICD_ADDRESS_SPACE )
+		return nullptr;
+
+	for ( uint8_t state_id = 0; state_id < LICD_MANAGED_DEVICE_COUNT; state_id++ ) {
+		LicDeviceState& state = m_states[ state_id ];
+
+		if ( state.address == address )
+			return &state;
+
+		if ( free_state == nullptr && state.address == 0 )
+			free_state = &state;
+	}
+
+	if ( bind && free_state != nullptr )
+		free_state->address = address;
+
+	return bind ? free_state : nullptr;
+}
+
+/**
+ * @brief Finds the state bound to a device.
+ *
+ * @param address I2C address of the device.
+ * @return Pointer to the state, nullptr if the device has none.
+ **/
+const LicDeviceState* LicDeviceManager::FindState( const LicDeviceAddress address ) const {
+	if ( address < LICD_ADDRESS_SPACE )
+		return nullptr;
+
+	for ( uint8_t state_id = 0; state_id < LICD_MANAGED_DEVICE_COUNT; state_id++ ) {
+		if ( m_states[ state_id ].address == address )
+			return &m_states[ state_id ];
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief Retrieves the fastest clock usable with a device.
+ *
+ * @param address I2C address of the device.
+ * @return The device capability clock, clamped to `LICD_MASTER_CLOCK`.
+ **/
+uint32_t LicDeviceManager::GetClockCeiling( const LicDeviceAddress address ) const {
+	const uint32_t clock = LicCapabilities::clock( GetCapabilities( address ) );
+
+	return ( clock > LICD_MASTER_CLOCK ) ? LICD_MASTER_CLOCK : clock;
+}
+
+/**
+ * @brief Converts an address to an index in the device list.
+ *
+ * @param address I2C address of the device.
+ * @return The device index, LICD_DEVICE_COUNT if the address is outside the address space.
+ **/
+uint8_t LicDeviceManager::GetDeviceIndex( const LicDeviceAddress address ) const {
+	if ( address < LICD_ADDRESS_SPACE || address >= LICD_ADDRESS_SPACE + LICD_DEVICE_COUNT )
+		return LICD_DEVICE_COUNT;
+
+	return ( address - LICD_ADDRESS_SPACE );
+}
+
+/**
+ * @brief Finds the device registered with a UUID.
+ *
+ * @param uuid UUID of the device.
+ * @return The device index, LICD_DEVICE_COUNT if the UUID is unknown, the
+ * default one or shared by several devices.
+ **/
+uint8_t LicDeviceManager::FindDevice( const uint32_t uuid ) const {
+	uint8_t found_id = LICD_DEVICE_COUNT;
+
+	if ( uuid == 0 || uuid == LICD_DEFAULT_UUID )
+		return LICD_DEVICE_COUNT;
+
+	for ( uint8_t device_id = 0; device_id < LICD_DEVICE_COUNT; device_id++ ) {
+		if ( m_devices[ device_id ].uuid != uuid )
+			continue;
+
+		if ( found_id < LICD_DEVICE_COUNT )
+			return LICD_DEVICE_COUNT;
+
+		found_id = device_id;
+	}
+
+	return found_id;
+}
+
+/**
+ * @brief Retrieves the number of recoveries in a row a device stayed silent.
+ *
+ * @param device_id Index of the device.
+ * @return The number of silent recoveries.
+ **/
+uint8_t LicDeviceManager::GetMisses( const uint8_t device_id ) const {
+	return ( m_misses[ device_id / 4 ] >> ( 2 * ( device_id % 4 ) ) ) & 0x03;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Checks if a device is registered at an address.
+ *
+ * @param address I2C address of the device.
+ * @return true if a device owns the address; false otherwise.
+ **/
+bool LicDeviceManager::GetIsRegistered( const LicDeviceAddress address ) const {
+	const uint8_t device_id = GetDeviceIndex( address );
+
+	return ( device_id < LICD_DEVICE_COUNT ) && ( m_devices[ device_id ].uuid > 0 );
+}
+
+/**
+ * @brief Retrieves the UUID of a device.
+ *
+ * @param address I2C address of the device.
+ * @return The UUID, 0 for unregistered devices.
+ **/
+uint32_t LicDeviceManager::GetUUID( const LicDeviceAddress address ) const {
+	const uint8_t device_id = GetDeviceIndex( address );
+
+	return ( device_id < LICD_DEVICE_COUNT ) ? m_devices[ device_id ].uuid : 0;
+}
+
+/**
+ * @brief Retrieves the capability flags advertised by a device.
+ *
+ * @param address I2C address of the device.
+ * @return The capability flags, 0 for unregistered devices.
+ **/
+uint32_t LicDeviceManager::GetCapabilities( const LicDeviceAddress address ) const {
+	const uint8_t device_id = GetDeviceIndex( address );
+
+	return ( device_id < LICD_DEVICE_COUNT ) ? m_devices[ device_id ].flags : 0;
+}
+
+/**
+ * @brief Retrieves the bus clock used with a device.
+ *
+ * @param address I2C address of the device.
+ * @return The SCL frequency in Hz.
+ **/
+uint32_t LicDeviceManager::GetClock( const LicDeviceAddress address ) const {
+	if ( !GetIsRegistered( address ) )
+		return LICD_DEFAULT_CLOCK;
+
+	const LicDeviceState* state = FindState( address );
+
+	return ( state != nullptr ) ? state->clock : GetClockCeiling( address );
+}
+
+/**
+ * @brief Retrieves the number of bus recoveries performed.
+ *
+ * @return The recovery counter.
+ **/
+uint32_t LicDeviceManager::GetRecoveries( ) const {
+	return m_recoveries;
+}
+
+/**
+ * @brief Retrieves the number of failed device polls.
+ *
+ * @return The poll error counter, an empty bus is not an error.
+ **/
+uint32_t LicDeviceManager::GetPollErrors( ) const {
+	return m_poll_errors;
+}
+
+/**
+ * @brief Retrieves the statistics of a device.
+ *
+ * @param address I2C address of the device.
+ * @return The device statistics, empty for devices without runtime state.
+ **/
+LicDeviceStats LicDeviceManager::GetStats( const LicDeviceAddress address ) const {
+	const LicDeviceState* state = FindState( address );
+
+	if ( state != nullptr )
+		return state->stats;
+
+	LicDeviceStats stats;
+
+	stats.clock = GetClock( address );
+
+	return stats;
+}
+
+/**
+ * @brief Retrieves the largest payload accepted by a device in a single transaction.
+ *
+ * @param address I2C address of the device.
+ * @return The payload size in bytes.
+ **/
+uint8_t LicDeviceManager::GetPayloadSize( const LicDeviceAddress address ) const {
+	return LicCapabilities::payload( GetCapabilities( address ) );
+}
+
+/**
+ * @brief Retrieves the read cache, to read its hit and miss counters.
+ *
+ * @return Reference to the read cache.
+ **/
+LicReadCache& LicDeviceManager::GetCache( ) {
+	return m_cache;
+}
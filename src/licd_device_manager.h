@@ -1,10 +1,46 @@
 #ifndef LICD_DEVICE_MANAGER_H
 #define LICD_DEVICE_MANAGER_H
 
-struct LicDeviceHeader {
+/**
+ * @brief Kinds of errors counted per device.
+ **/
+enum LicDeviceError : uint8_t {
 
-	uint32_t uuid = 0;
-	uint32_t flags = 0;
+	LICD_ERROR_NONE = 0,
+	LICD_ERROR_NACK,
+	LICD_ERROR_READ,
+	LICD_ERROR_CRC
+
+};
+
+/**
+ * @brief Transaction statistics and clock decisions of a device.
+ **/
+struct LicDeviceStats {
+
+	uint32_t transactions = 0;
+	uint32_t nack_errors = 0;
+	uint32_t read_errors = 0;
+	uint32_t crc_errors = 0;
+	uint16_t clock_downs = 0;
+	uint16_t clock_ups = 0;
+	uint32_t clock = LICD_DEFAULT_CLOCK;
+
+};
+
+/**
+ * @brief Master-side runtime state of a registered device.
+ **/
+struct LicDeviceState {
+
+	LicDeviceAddress address = 0;
+	uint16_t cache_ttl = 0;
+	uint16_t credits = 0;
+	uint32_t clock = LICD_DEFAULT_CLOCK;
+	uint8_t window_transactions = 0;
+	uint8_t window_errors = 0;
+	uint8_t clean_windows = 0;
+	LicDeviceStats stats;
 
 };
 
@@ -23,6 +59,15 @@ private:
 	uint32_t m_retry_delay;
 	uint32_t m_wait_delay;
 	LicDeviceHeader m_devices[ LICD_DEVICE_COUNT ];
+	LicDeviceState m_states[ LICD_MANAGED_DEVICE_COUNT ];
+	uint8_t m_misses[ ( LICD_DEVICE_COUNT + 3 ) / 4 ];
+	LicReadCache m_cache;
+	LicShadowRegister m_shadows[ LICD_SHADOW_COUNT ];
+	uint32_t m_clock;
+	bool m_is_adaptive;
+	bool m_is_stuck;
+	uint32_t m_recoveries;
+	uint32_t m_poll_errors;
 
 public:
 	/**
@@ -50,20 +95,616 @@ public:
 	 **/
 	void PollDevice( );
 
+	/**
+	 * @brief Polls once for a new device, without delays nor error messages.
+	 * 
+	 * Meant for loops that must stay responsive or share the `Serial` port, like
+	 * `LicGateway`. An empty bus costs a single listener query, errors are only
+	 * counted (see `GetPollErrors`).
+	 * 
+	 * @return true if a device was registered; false otherwise.
+	 **/
+	bool PollDeviceOnce( );
+
+	/**
+	 * @brief Frees a stuck bus, restarts Wire and drops devices that stopped answering.
+	 * 
+	 * Called by `PollDevice` when the bus looks stuck, it can also be called directly.
+	 * A device is dropped once it stayed silent for `LICD_RECOVERY_MISSES` recoveries
+	 * in a row.
+	 * 
+	 * @return true if SDA and SCL are released after the recovery; false otherwise.
+	 **/
+	bool RecoverBus( );
+
+	/**
+	 * @brief Sends a command to a registered device and reads its answer.
+	 * 
+	 * Answers are served from the read cache while the device cache TTL is not elapsed.
+	 * 
+	 * @tparam T The type of data to be read.
+	 * @param address I2C address of the device.
+	 * @param command Command code sent before the request.
+	 * @param data Pointer to the memory where the read data will be stored.
+	 * @param count Number of elements of type T to read (must be >= 1).
+	 * @return true if the whole answer was read; false otherwise.
+	 **/
+	template<typename T>
+	bool Read( 
+		const LicDeviceAddress address,
+		const uint8_t command,
+		T* data,
+		const uint32_t count
+	) {
+		return ReadBytes( address, command, reinterpret_cast<uint8_t*>( data ), sizeof( T ) * count );
+	};
+
+	/**
+	 * @brief Sets how long the answers of a device stay in the read cache.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param ttl Time-to-live (in milliseconds), 0 disables caching for the device (default).
+	 **/
+	void SetCacheTTL( const LicDeviceAddress address, const uint16_t ttl );
+
+	/**
+	 * @brief Drops every cached answer of a device.
+	 * 
+	 * @param address I2C address of the device.
+	 **/
+	void Invalidate( const LicDeviceAddress address );
+
+	/**
+	 * @brief Drops the cached answer of a device for a command.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param command Command code of the answer.
+	 **/
+	void Invalidate( const LicDeviceAddress address, const uint8_t command );
+
+	/**
+	 * @brief Stages a register write in the device shadow, sent at the next flush.
+	 * 
+	 * When every shadow is bound to another device the write is sent immediately.
+	 * 
+	 * @tparam T The type of data to be written.
+	 * @param address I2C address of the device.
+	 * @param offset Register offset of the first byte.
+	 * @param data Pointer to the data to write.
+	 * @param count Number of elements of type T to write (must be >= 1).
+	 * @return true if the write was staged or sent; false otherwise.
+	 **/
+	template<typename T>
+	bool Stage( 
+		const LicDeviceAddress address,
+		const uint8_t offset,
+		const T* data,
+		const uint32_t count
+	) {
+		return StageBytes( address, offset, reinterpret_cast<const uint8_t*>( data ), sizeof( T ) * count );
+	};
+
+	/**
+	 * @brief Sends the dirty runs of every shadow, one write per contiguous run.
+	 * 
+	 * @return true if every write succeeded; false otherwise.
+	 **/
+	bool Flush( );
+
+	/**
+	 * @brief Sends the dirty runs of a device shadow.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return true if the write succeeded or nothing was staged; false otherwise.
+	 **/
+	bool Flush( const LicDeviceAddress address );
+
+	/**
+	 * @brief Writes a range of a device register block, bypassing its shadow.
+	 * 
+	 * Staged bytes of the range are dropped, a later flush does not overwrite the
+	 * written value.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param offset Register offset of the first byte.
+	 * @param data Pointer to the data to write.
+	 * @param size Size of the data in bytes.
+	 * @return true if the write succeeded; false otherwise, or when the device
+	 * payload leaves no room for data.
+	 **/
+	bool WriteRegisters( 
+		const LicDeviceAddress address,
+		const uint8_t offset,
+		const uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Streams data to a device without overrunning its stream buffer.
+	 * 
+	 * Only as many bytes as the device advertised free space for are sent. The
+	 * call never waits for the device to drain its buffer, the caller resends the
+	 * remaining bytes on a later loop iteration.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param data Pointer to the data to stream.
+	 * @param size Size of the data in bytes.
+	 * @return The number of bytes accepted by the device.
+	 **/
+	uint32_t Stream( const LicDeviceAddress address, const uint8_t* data, const uint32_t size );
+
+	/**
+	 * @brief Advances a bulk object transfer by a few chunks.
+	 * 
+	 * Pushes first read the device checkpoint when the transfer is not synced,
+	 * send up to `chunk_count` chunks from it and read the checkpoint again. Pulls
+	 * request up to `chunk_count` chunks from the master offset. On a bus error the
+	 * transfer keeps its last checkpoint and the next call resumes from it.
+	 * 
+	 * @param transfer Transfer to advance.
+	 * @param chunk_count Maximum number of chunks exchanged by this call.
+	 * @return true if the transfer progressed or is done; false on bus error, when
+	 * a push stalled on chunks the device rejects, or when the device payload
+	 * cannot hold a chunk header and data.
+	 **/
+	bool Transfer( LicBulkTransfer& transfer, const uint8_t chunk_count );
+
+	/**
+	 * @brief Advances several firmware updates, interleaving their devices on the bus.
+	 * 
+	 * Each call advances every running session by one step, the image transfer
+	 * step sending up to `chunk_count` chunks. Devices rebooted into their new
+	 * firmware are removed from the device list and register again on their own.
+	 * 
+	 * @param sessions Pointer to the sessions.
+	 * @param session_count Number of sessions.
+	 * @param chunk_count Maximum number of chunks sent per session and per call.
+	 * @return The number of sessions still running.
+	 **/
+	uint8_t UpdateFirmware( 
+		LicFirmwareSession* sessions,
+		const uint8_t session_count,
+		const uint8_t chunk_count
+	);
+
+	/**
+	 * @brief Enables or disables adaptive clock scaling (default: enabled).
+	 * 
+	 * When enabled, a device clock steps down once `LICD_CLOCK_ERROR_THRESHOLD`
+	 * errors are seen within `LICD_CLOCK_WINDOW` transactions, and steps back up
+	 * after `LICD_CLOCK_CLEAN_WINDOWS` windows without errors.
+	 * 
+	 * @param is_adaptive Whether device clocks follow the observed error rate.
+	 **/
+	void SetAdaptiveClock( const bool is_adaptive );
+
+	/**
+	 * @brief Resets the statistics of a device, keeping its current clock.
+	 * 
+	 * @param address I2C address of the device.
+	 **/
+	void ResetStats( const LicDeviceAddress address );
+
+	/**
+	 * @brief Fetches the aggregate computed by a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param aggregate Aggregate to fill.
+	 * @return true if the aggregate was read; false otherwise.
+	 **/
+	bool ReadAggregate( const LicDeviceAddress address, LicAggregate& aggregate );
+
+	/**
+	 * @brief Sends a command to a registered device and decodes its packed sample stream.
+	 * 
+	 * The device is expected to answer with `WireHelper::write_packed`.
+	 * 
+	 * @tparam T The integer sample type.
+	 * @param address I2C address of the device.
+	 * @param command Command code sent before the request.
+	 * @param samples Pointer to the memory where decoded samples will be stored.
+	 * @param capacity Maximum number of samples to decode.
+	 * @return The number of decoded samples, 0 on failure.
+	 **/
+	template<typename T>
+	uint8_t ReadPacked( 
+		const LicDeviceAddress address,
+		const uint8_t command,
+		T* samples,
+		const uint8_t capacity
+	) {
+		BeginTransmission( address );
+		LicTransport::write( command );
+
+		if ( EndTransmission( address, true ) != 0 )
+			return 0;
+
+		LicTransport::requestFrom( (uint8_t)address, (uint8_t)LICD_FRAME_SIZE );
+
+		const uint8_t sample_count = WireHelper::read_packed( samples, capacity, m_wait_delay );
+
+		if ( sample_count == 0 )
+			RecordError( address, LICD_ERROR_READ );
+
+		return sample_count;
+	};
+
 private:
+	/**
+	 * @brief Polls for a new device and registers it.
+	 * 
+	 * @param retry_count Number of listener queries before giving up.
+	 * @param is_quiet Whether errors are only counted, without delays nor messages.
+	 * @return true if a device was registered; false otherwise.
+	 **/
+	bool Poll( const uint32_t retry_count, const bool is_quiet );
+
 	/**
 	 * @brief Checks for devices waiting to be registered.
 	 * 
+	 * @param retry_count Number of listener queries before giving up.
+	 * @param is_quiet Whether errors are only counted, without delays nor messages.
 	 * @return true if a device is waiting for registration; false otherwise.
 	 **/
-	bool DoPollDevice( );
+	bool DoPollDevice( const uint32_t retry_count, const bool is_quiet );
 
 	/**
 	 * @brief Registers a device to the device list and assigns it an I2C address.
 	 * 
+	 * A device registering again with a UUID of the list gets its previous address.
+	 * 
+	 * @param is_quiet Whether errors are only counted, without messages.
 	 * @return The assigned I2C address for the registered device.
 	 **/
-	uint8_t RegisterDevice( );
+	uint8_t RegisterDevice( const bool is_quiet );
+
+	/**
+	 * @brief Sends a command to a device and reads its answer through the read cache.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param command Command code sent before the request.
+	 * @param data Pointer to the memory where the answer will be stored.
+	 * @param size Size of the answer in bytes.
+	 * @return true if the whole answer was read; false otherwise.
+	 **/
+	bool ReadBytes( 
+		const LicDeviceAddress address,
+		const uint8_t command,
+		uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Stages a register write in the device shadow.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param offset Register offset of the first byte.
+	 * @param data Pointer to the data to write.
+	 * @param size Size of the data in bytes.
+	 * @return true if the write was staged or sent; false otherwise.
+	 **/
+	bool StageBytes( 
+		const LicDeviceAddress address,
+		const uint8_t offset,
+		const uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Sends the dirty runs of a shadow, marking each run clean once sent.
+	 * 
+	 * @param shadow Shadow to flush.
+	 * @return true if every write succeeded or nothing was staged; false otherwise.
+	 **/
+	bool FlushShadow( LicShadowRegister& shadow );
+
+	/**
+	 * @brief Sends a range of a device register block, in as many writes as needed.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param offset Register offset of the first byte.
+	 * @param data Pointer to the data to write.
+	 * @param size Size of the data in bytes.
+	 * @return true if every write succeeded; false otherwise, or when the device
+	 * payload leaves no room for data.
+	 **/
+	bool SendRegisters( 
+		const LicDeviceAddress address,
+		const uint8_t offset,
+		const uint8_t* data,
+		const uint32_t size
+	);
+
+	/**
+	 * @brief Finds the shadow bound to a device, binding a free one if requested.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param bind Whether a free shadow is bound when none matches.
+	 * @return Pointer to the shadow, nullptr if none is available.
+	 **/
+	LicShadowRegister* FindShadow( const LicDeviceAddress address, const bool bind );
+
+	/**
+	 * @brief Queries the free space of a device stream buffer.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The number of bytes the device can accept, 0 on failure.
+	 **/
+	uint16_t QueryCredits( const LicDeviceAddress address );
+
+	/**
+	 * @brief Advances a bulk push transfer.
+	 * 
+	 * @param transfer Transfer to advance.
+	 * @param chunk_count Maximum number of chunks sent.
+	 * @return true if the checkpoint moved or the transfer is done; false on bus
+	 * error, when the device acknowledged no chunk, or when the device payload
+	 * cannot hold a chunk header and data.
+	 **/
+	bool TransferPush( LicBulkTransfer& transfer, const uint8_t chunk_count );
+
+	/**
+	 * @brief Advances a bulk pull transfer.
+	 * 
+	 * @param transfer Transfer to advance.
+	 * @param chunk_count Maximum number of chunks requested.
+	 * @return true if the transfer progressed or is done; false on bus error, or
+	 * when the device payload cannot hold a chunk header and data.
+	 **/
+	bool TransferPull( LicBulkTransfer& transfer, const uint8_t chunk_count );
+
+	/**
+	 * @brief Reads the checkpoint of a bulk transfer from its device.
+	 * 
+	 * @param transfer Transfer to synchronize.
+	 * @return true if the checkpoint was read; false otherwise.
+	 **/
+	bool SyncBulk( LicBulkTransfer& transfer );
+
+	/**
+	 * @brief Writes a bulk chunk header : command, object and little-endian offset.
+	 * 
+	 * @param command Bulk command code.
+	 * @param object Object identifier.
+	 * @param offset Chunk offset.
+	 **/
+	void WriteBulkHeader( const uint8_t command, const uint8_t object, const uint32_t offset );
+
+	/**
+	 * @brief Advances the firmware update of a single device by one step.
+	 * 
+	 * @param session Session to advance.
+	 * @param chunk_count Maximum number of chunks sent.
+	 **/
+	void StepFirmware( LicFirmwareSession& session, const uint8_t chunk_count );
+
+	/**
+	 * @brief Sends a firmware operation and reads the resulting device state.
+	 * 
+	 * @param session Session of the device.
+	 * @param operation Firmware operation.
+	 * @param state Firmware state answered by the device.
+	 * @return true if the state was read; false otherwise.
+	 **/
+	bool SendFirmware( 
+		LicFirmwareSession& session,
+		const LicFirmwareOperation operation,
+		LicFirmwareState& state
+	);
+
+	/**
+	 * @brief Starts the transport as master at the current clock, with transaction timeouts when available.
+	 **/
+	void BeginBus( );
+
+	/**
+	 * @brief Checks if the bus looks stuck.
+	 * 
+	 * @return true if the bus needs a recovery; false otherwise.
+	 **/
+	bool DetectStuckBus( );
+
+	/**
+	 * @brief Removes a device from the device list and drops its master-side state.
+	 * 
+	 * @param address I2C address of the device.
+	 **/
+	void ForgetDevice( const LicDeviceAddress address );
+
+	/**
+	 * @brief Pings a device, retrying up to the retry count.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return true if the device acknowledged its address; false otherwise.
+	 **/
+	bool PingDevice( const LicDeviceAddress address );
+
+	/**
+	 * @brief Stores the number of recoveries in a row a device stayed silent.
+	 * 
+	 * @param device_id Index of the device.
+	 * @param misses Number of silent recoveries, at most 3.
+	 **/
+	void SetMisses( const uint8_t device_id, const uint8_t misses );
+
+	/**
+	 * @brief Starts a transmission to a device at the bus clock it supports.
+	 * 
+	 * @param address I2C address of the device.
+	 **/
+	void BeginTransmission( const LicDeviceAddress address );
+
+	/**
+	 * @brief Ends a transmission to a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param is_query Whether a request to the same device follows.
+	 * @return The `LicTransport::endTransmission` status, 0 on success.
+	 **/
+	uint8_t EndTransmission( const LicDeviceAddress address, const bool is_query );
+
+	/**
+	 * @brief Reads a reply and counts a read error when it is short or late.
+	 * 
+	 * @tparam T The type of data to be read.
+	 * @param address I2C address of the device.
+	 * @param data Pointer to the memory where the read data will be stored.
+	 * @param count Number of elements of type T to read (must be >= 1).
+	 * @return true if the whole reply was read; false otherwise.
+	 **/
+	template<typename T>
+	bool ReadReply( const LicDeviceAddress address, T* data, const uint32_t count ) {
+		if ( WireHelper::read( data, count, m_wait_delay ) )
+			return true;
+
+		RecordError( address, LICD_ERROR_READ );
+
+		return false;
+	};
+
+	/**
+	 * @brief Counts a transaction in the device statistics and clock window.
+	 * 
+	 * @param address I2C address of the device.
+	 **/
+	void RecordTransaction( const LicDeviceAddress address );
+
+	/**
+	 * @brief Counts an error in the device statistics and clock window.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param error Kind of error.
+	 **/
+	void RecordError( const LicDeviceAddress address, const LicDeviceError error );
+
+	/**
+	 * @brief Moves a device clock one step up or down the clock ladder.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param state Runtime state of the device.
+	 * @param is_up Whether the clock steps up.
+	 **/
+	void StepClock( const LicDeviceAddress address, LicDeviceState& state, const bool is_up );
+
+	/**
+	 * @brief Finds the state bound to a device, binding a free one if requested.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param bind Whether a free state is bound when none matches.
+	 * @return Pointer to the state, nullptr if none is available.
+	 **/
+	LicDeviceState* FindState( const LicDeviceAddress address, const bool bind );
+
+	/**
+	 * @brief Finds the state bound to a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return Pointer to the state, nullptr if the device has none.
+	 **/
+	const LicDeviceState* FindState( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Retrieves the fastest clock usable with a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The device capability clock, clamped to `LICD_MASTER_CLOCK`.
+	 **/
+	uint32_t GetClockCeiling( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Converts an address to an index in the device list.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The device index, LICD_DEVICE_COUNT if the address is outside the address space.
+	 **/
+	uint8_t GetDeviceIndex( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Finds the device registered with a UUID.
+	 * 
+	 * @param uuid UUID of the device.
+	 * @return The device index, LICD_DEVICE_COUNT if the UUID is unknown, the
+	 * default one or shared by several devices.
+	 **/
+	uint8_t FindDevice( const uint32_t uuid ) const;
+
+	/**
+	 * @brief Retrieves the number of recoveries in a row a device stayed silent.
+	 * 
+	 * @param device_id Index of the device.
+	 * @return The number of silent recoveries.
+	 **/
+	uint8_t GetMisses( const uint8_t device_id ) const;
+
+public:
+	/**
+	 * @brief Retrieves the read cache, to read its hit and miss counters.
+	 * 
+	 * @return Reference to the read cache.
+	 **/
+	LicReadCache& GetCache( );
+
+	/**
+	 * @brief Checks if a device is registered at an address.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return true if a device owns the address; false otherwise.
+	 **/
+	bool GetIsRegistered( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Retrieves the UUID of a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The UUID, 0 for unregistered devices.
+	 **/
+	uint32_t GetUUID( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Retrieves the capability flags advertised by a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The capability flags, 0 for unregistered devices.
+	 **/
+	uint32_t GetCapabilities( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Retrieves the bus clock used with a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The SCL frequency in Hz.
+	 **/
+	uint32_t GetClock( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Retrieves the number of bus recoveries performed.
+	 * 
+	 * @return The recovery counter.
+	 **/
+	uint32_t GetRecoveries( ) const;
+
+	/**
+	 * @brief Retrieves the number of failed device polls.
+	 * 
+	 * @return The poll error counter, an empty bus is not an error.
+	 **/
+	uint32_t GetPollErrors( ) const;
+
+	/**
+	 * @brief Retrieves the statistics of a device.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The device statistics, empty for devices without runtime state.
+	 **/
+	LicDeviceStats GetStats( const LicDeviceAddress address ) const;
+
+	/**
+	 * @brief Retrieves the largest payload accepted by a device in a single transaction.
+	 * 
+	 * @param address I2C address of the device.
+	 * @return The payload size in bytes.
+	 **/
+	uint8_t GetPayloadSize( const LicDeviceAddress address ) const;
 
 };
 
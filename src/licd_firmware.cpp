@@ -0,0 +1,101 @@
+/**
+ * @file licd_firmware.cpp
+ * @brief Implementation of the master-side firmware session.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicFirmwareSession
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an empty `LicFirmwareSession`, already done.
+ **/
+LicFirmwareSession::LicFirmwareSession( )
+	: m_step{ LICD_FIRMWARE_STEP_DONE },
+	m_errors{ 0 },
+	m_crc{ 0 },
+	m_transfer{ }
+{ }
+
+/**
+ * @brief Constructs a `LicFirmwareSession` and computes the image CRC-32.
+ *
+ * @param address I2C address of the device.
+ * @param image Pointer to the firmware image.
+ * @param size Size of the firmware image in bytes.
+ **/
+LicFirmwareSession::LicFirmwareSession( const uint8_t address, const uint8_t* image, const uint32_t size )
+	: m_step{ LICD_FIRMWARE_STEP_BEGIN },
+	m_errors{ 0 },
+	m_crc{ LicCRC::crc32( image, size ) },
+	m_transfer{ address, LICD_BULK_OBJECT_FIRMWARE, LICD_BULK_PUSH, const_cast<uint8_t*>( image ), size }
+{ }
+
+/**
+ * @brief Destructor for `LicFirmwareSession`.
+ **/
+LicFirmwareSession::~LicFirmwareSession( ) { }
+
+/**
+ * @brief Moves the session to a step and clears its error counter.
+ *
+ * @param step Next step.
+ **/
+void LicFirmwareSession::SetStep( const LicFirmwareStep step ) {
+	m_step = step;
+	m_errors = 0;
+}
+
+/**
+ * @brief Counts a failed step, failing the session after `LICD_FIRMWARE_RETRY` errors in a row.
+ **/
+void LicFirmwareSession::Fail( ) {
+	m_errors += 1;
+
+	if ( m_errors >= LICD_FIRMWARE_RETRY )
+		m_step = LICD_FIRMWARE_STEP_FAILED;
+}
+
+/**
+ * @brief Counts a failed step and moves back to an earlier step.
+ *
+ * @param step Step to retry from.
+ **/
+void LicFirmwareSession::Retry( const LicFirmwareStep step ) {
+	m_step = step;
+
+	Fail( );
+}
+
+// PUBLIC GETTERS
+
+LicFirmwareStep LicFirmwareSession::GetStep( ) const {
+	return m_step;
+}
+
+/**
+ * @brief Checks if the session ended, successfully or not.
+ *
+ * @return true if nothing is left to do; false otherwise.
+ **/
+bool LicFirmwareSession::GetIsDone( ) const {
+	return ( m_step == LICD_FIRMWARE_STEP_DONE || m_step == LICD_FIRMWARE_STEP_FAILED );
+}
+
+uint32_t LicFirmwareSession::GetCRC( ) const {
+	return m_crc;
+}
+
+LicBulkTransfer& LicFirmwareSession::GetTransfer( ) {
+	return m_transfer;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file licd_firmware.h
+ * @brief Provides in-band firmware updates over the LICD bus.
+ *
+ * This header defines the types used to stream a firmware image from the master
+ * to slave devices. The image travels as the `LICD_BULK_OBJECT_FIRMWARE` bulk
+ * object, so every chunk is CRC-16 checked and an interrupted update resumes from
+ * its checkpoint. The slave computes the CRC-32 of the image while it is staged,
+ * compares it to the one announced by the master, then reboots into it on request.
+ *
+ * ## Update Sequence
+ * 1. `LICD_FIRMWARE_BEGIN`: The master announces the image size and CRC-32.
+ * 2. Bulk push of the image, chunks are written to the staging area.
+ * 3. `LICD_FIRMWARE_COMMIT`: The slave verifies the staged image.
+ * 4. `LICD_FIRMWARE_REBOOT`: The slave reboots into the verified image.
+ *
+ * ## Slave Side
+ * The staging area is platform specific, the sketch provides it as a
+ * `LicFirmwareTarget` (for instance around the ESP32 `Update` library or a
+ * bootloader staging partition) and registers it with `LicDevice::SetFirmwareTarget`.
+ * Target callbacks run from the Wire interrupt handlers.
+ *
+ * ## Master Side
+ * Each slave to update is a `LicFirmwareSession`. `LicDeviceManager::UpdateFirmware`
+ * advances every session by a few chunks per call, interleaving the slaves on the bus.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_FIRMWARE_H_
+#define LICD_FIRMWARE_H_
+
+/**
+ * @brief Bulk object identifier of firmware images.
+ **/
+#define LICD_BULK_OBJECT_FIRMWARE 0xF0
+
+/**
+ * @brief Firmware operations sent after `LICD_COMMAND_FIRMWARE`.
+ **/
+enum LicFirmwareOperation : uint8_t {
+
+	LICD_FIRMWARE_STATUS = 0,
+	LICD_FIRMWARE_BEGIN,
+	LICD_FIRMWARE_COMMIT,
+	LICD_FIRMWARE_REBOOT
+
+};
+
+/**
+ * @brief Firmware state reported by a slave.
+ **/
+enum LicFirmwareState : uint8_t {
+
+	LICD_FIRMWARE_IDLE = 0,
+	LICD_FIRMWARE_RECEIVING,
+	LICD_FIRMWARE_VERIFIED,
+	LICD_FIRMWARE_FAILED,
+	LICD_FIRMWARE_BUSY
+
+};
+
+/**
+ * @brief Slave staging area for firmware images.
+ * 
+ * - `begin`: Prepares the staging area for an image of the given size.
+ * - `write`: Stores a chunk of the image at an offset.
+ * - `commit`: Finalizes the staging area once the CRC-32 matched, may be nullptr.
+ * - `reboot`: Reboots into the staged image, never returns.
+ **/
+struct LicFirmwareTarget {
+
+	bool (*begin)( uint32_t size );
+	bool (*write)( uint32_t offset, const uint8_t* data, uint8_t size );
+	bool (*commit)( uint32_t size, uint32_t crc );
+	void (*reboot)( );
+
+};
+
+/**
+ * @brief Steps of a master-side firmware session.
+ **/
+enum LicFirmwareStep : uint8_t {
+
+	LICD_FIRMWARE_STEP_BEGIN = 0,
+	LICD_FIRMWARE_STEP_BEGIN_WAIT,
+	LICD_FIRMWARE_STEP_TRANSFER,
+	LICD_FIRMWARE_STEP_COMMIT,
+	LICD_FIRMWARE_STEP_COMMIT_WAIT,
+	LICD_FIRMWARE_STEP_REBOOT,
+	LICD_FIRMWARE_STEP_DONE,
+	LICD_FIRMWARE_STEP_FAILED
+
+};
+
+/**
+ * @class LicFirmwareSession
+ * @brief Master-side state of the firmware update of a single slave.
+ * @author : ALVES Quentin
+ **/
+class LicFirmwareSession final {
+
+private:
+	LicFirmwareStep m_step;
+	uint8_t m_errors;
+	uint32_t m_crc;
+	LicBulkTransfer m_transfer;
+
+public:
+	/**
+	 * @brief Constructor to initialize an empty session, already done.
+	 **/
+	LicFirmwareSession( );
+
+	/**
+	 * @brief Constructor to initialize a session.
+	 * 
+	 * The image must stay readable for the whole update, memory-mapped flash is fine.
+	 * 
+	 * @param address I2C address of the device.
+	 * @param image Pointer to the firmware image.
+	 * @param size Size of the firmware image in bytes.
+	 **/
+	LicFirmwareSession( const uint8_t address, const uint8_t* image, const uint32_t size );
+
+	/**
+	 * @brief Destructor for the session.
+	 **/
+	~LicFirmwareSession( );
+
+	/**
+	 * @brief Moves the session to a step and clears its error counter.
+	 * 
+	 * @param step Next step.
+	 **/
+	void SetStep( const LicFirmwareStep step );
+
+	/**
+	 * @brief Counts a failed step, failing the session after `LICD_FIRMWARE_RETRY` errors in a row.
+	 **/
+	void Fail( );
+
+	/**
+	 * @brief Counts a failed step and moves back to an earlier step.
+	 * 
+	 * @param step Step to retry from.
+	 **/
+	void Retry( const LicFirmwareStep step );
+
+public:
+	LicFirmwareStep GetStep( ) const;
+
+	/**
+	 * @brief Checks if the session ended, successfully or not.
+	 * 
+	 * @return true if nothing is left to do; false otherwise.
+	 **/
+	bool GetIsDone( ) const;
+
+	uint32_t GetCRC( ) const;
+
+	LicBulkTransfer& GetTransfer( );
+
+};
+
+#endif /* !LICD_FIRMWARE_H_ */
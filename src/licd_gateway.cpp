@@ -0,0 +1,506 @@
+/**
+ * @file licd_gateway.cpp
+ * @brief Implementation of the binary gateway.
+ *
+ * Both classes are portable, host builds run a `LicGateway` over the host
+ * `Stream` interface of `licd_platform.h`.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicGatewayParser
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an empty `LicGatewayParser`.
+ **/
+LicGatewayParser::LicGatewayParser( )
+	: m_buffer{ },
+	m_size{ 0 },
+	m_errors{ 0 },
+	m_frame{ }
+{ }
+
+/**
+ * @brief Destructor for `LicGatewayParser`.
+ **/
+LicGatewayParser::~LicGatewayParser( ) { }
+
+/**
+ * @brief Pushes one received byte.
+ *
+ * Bytes before a sync byte are skipped. A frame with an oversized payload or a
+ * bad CRC is dropped and the parse restarts on the next sync byte it holds.
+ *
+ * @param value Received byte.
+ * @return true when the byte completes a valid frame; false otherwise.
+ **/
+bool LicGatewayParser::Push( const uint8_t value ) {
+	if ( m_size == 0 && value != LICD_GATEWAY_SYNC )
+		return false;
+
+	m_buffer[ m_size++ ] = value;
+
+	if ( m_size == 2 && m_buffer[ 1 ] > LICD_GATEWAY_PAYLOAD_SIZE ) {
+		m_errors += 1;
+
+		return Resync( );
+	}
+
+	if ( m_size < 2 || m_size < LICD_GATEWAY_HEADER_SIZE + m_buffer[ 1 ] + 2 )
+		return false;
+
+	const uint8_t payload_size = m_buffer[ 1 ];
+	const uint8_t crc_offset = LICD_GATEWAY_HEADER_SIZE + payload_size;
+	const uint16_t crc = LicCRC::crc16( m_buffer + 1, crc_offset - 1 );
+
+	if ( ( m_buffer[ crc_offset ] | ( m_buffer[ crc_offset + 1 ] << 8 ) ) != crc ) {
+		m_errors += 1;
+
+		return Resync( );
+	}
+
+	m_frame.type = m_buffer[ 2 ];
+	m_frame.address = m_buffer[ 3 ];
+	m_frame.timestamp = 0;
+	m_frame.size = payload_size;
+
+	for ( uint8_t byte_id = 0; byte_id < 4; byte_id++ )
+		m_frame.timestamp |= (uint32_t)m_buffer[ 4 + byte_id ] << ( 8 * byte_id );
+
+	memcpy( m_frame.payload, m_buffer + LICD_GATEWAY_HEADER_SIZE, payload_size );
+
+	m_size = 0;
+
+	return true;
+}
+
+/**
+ * @brief Drops the partially received frame.
+ **/
+void LicGatewayParser::Reset( ) {
+	m_size = 0;
+}
+
+/**
+ * @brief Encodes a frame.
+ *
+ * @param frame Frame to encode, its payload is truncated to `LICD_GATEWAY_PAYLOAD_SIZE`.
+ * @param buffer Pointer to at least `LICD_GATEWAY_FRAME_SIZE` bytes.
+ * @return The number of bytes written.
+ **/
+uint8_t LicGatewayParser::Encode( const LicGatewayFrame& frame, uint8_t* buffer ) {
+	const uint8_t payload_size = ( frame.size < LICD_GATEWAY_PAYLOAD_SIZE ) ? frame.size : LICD_GATEWAY_PAYLOAD_SIZE;
+
+	buffer[ 0 ] = LICD_GATEWAY_SYNC;
+	buffer[ 1 ] = payload_size;
+	buffer[ 2 ] = frame.type;
+	buffer[ 3 ] = frame.address;
+
+	for ( uint8_t byte_id = 0; byte_id < 4; byte_id++ )
+		buffer[ 4 + byte_id ] = (uint8_t)( frame.timestamp >> ( 8 * byte_id ) );
+
+	memcpy( buffer + LICD_GATEWAY_HEADER_SIZE, frame.payload, payload_size );
+
+	const uint8_t crc_offset = LICD_GATEWAY_HEADER_SIZE + payload_size;
+	const uint16_t crc = LicCRC::crc16( buffer + 1, crc_offset - 1 );
+
+	buffer[ crc_offset ] = (uint8_t)crc;
+	buffer[ crc_offset + 1 ] = (uint8_t)( crc >> 8 );
+
+	return crc_offset + 2;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Restarts the parse on the next sync byte of the buffer.
+ *
+ * A sync byte inside a dropped frame may start the next one, the bytes from it
+ * are pushed again. They hold at most one frame with a payload.
+ *
+ * @return true when the pushed bytes complete a valid frame; false otherwise.
+ **/
+bool LicGatewayParser::Resync( ) {
+	const uint8_t size = m_size;
+	uint8_t offset = 1;
+
+	while ( offset < size && m_buffer[ offset ] != LICD_GATEWAY_SYNC )
+		offset += 1;
+
+	uint8_t pending[ LICD_GATEWAY_FRAME_SIZE ];
+	const uint8_t pending_size = size - offset;
+	bool is_complete = false;
+
+	memcpy( pending, m_buffer + offset, pending_size );
+
+	m_size = 0;
+
+	for ( uint8_t byte_id = 0; byte_id < pending_size; byte_id++ ) {
+		if ( Push( pending[ byte_id ] ) )
+			is_complete = true;
+	}
+
+	return is_complete;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the last valid frame.
+ *
+ * @return Reference to the frame.
+ **/
+const LicGatewayFrame& LicGatewayParser::GetFrame( ) const {
+	return m_frame;
+}
+
+/**
+ * @brief Retrieves the number of frames dropped on size or CRC errors.
+ *
+ * @return The error count.
+ **/
+uint32_t LicGatewayParser::GetErrors( ) const {
+	return m_errors;
+}
+
+/**
+ * ====================
+ * LicGateway
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs a `LicGateway`.
+ *
+ * @param manager Reference to the device manager driving the bus.
+ * @param port Reference to the host port, opened by the sketch.
+ **/
+LicGateway::LicGateway( LicDeviceManager& manager, Stream& port )
+	: m_manager{ manager },
+	m_port{ port },
+	m_parser{ },
+	m_subscriptions{ },
+	m_attached{ },
+	m_poll_time{ 0 },
+	m_is_polled{ false }
+{ }
+
+/**
+ * @brief Destructor for `LicGateway`.
+ **/
+LicGateway::~LicGateway( ) { }
+
+/**
+ * @brief Reads a command of a device periodically.
+ *
+ * A subscription to the same device and command replaces the previous one,
+ * it is bound to the UUID of the device when the device is registered.
+ *
+ * @param address I2C address of the device.
+ * @param command Command code to read.
+ * @param size Size of the answer in bytes, at most `LICD_FRAME_SIZE`.
+ * @param period Delay between two reads (in milliseconds).
+ * @return true if the subscription was stored; false when the table is full.
+ **/
+bool LicGateway::Subscribe(
+	const LicDeviceAddress address,
+	const uint8_t command,
+	const uint8_t size,
+	const uint16_t period
+) {
+	if ( address < LICD_ADDRESS_SPACE || size == 0 || size > LICD_FRAME_SIZE )
+		return false;
+
+	LicGatewaySubscription* subscription = Find( address, command );
+
+	if ( subscription == nullptr )
+		subscription = Find( 0, 0 );
+
+	if ( subscription == nullptr )
+		return false;
+
+	subscription->address = address;
+	subscription->command = command;
+	subscription->size = size;
+	subscription->period = period;
+	subscription->timestamp = LicClock::millis( ) - period;
+	subscription->uuid = m_manager.GetIsRegistered( address ) ? m_manager.GetUUID( address ) : 0;
+
+	return true;
+}
+
+/**
+ * @brief Stops reading a command of a device.
+ *
+ * @param address I2C address of the device.
+ * @param command Command code.
+ **/
+void LicGateway::Unsubscribe( const LicDeviceAddress address, const uint8_t command ) {
+	LicGatewaySubscription* subscription = Find( address, command );
+
+	if ( subscription != nullptr )
+		subscription->address = 0;
+}
+
+/**
+ * @brief Runs host commands, polls for devices and streams due subscriptions.
+ *
+ * Host commands run first so a read requested by the host is not delayed by
+ * the subscriptions. The poll queries the bus once, without delays nor text on
+ * the port.
+ **/
+void LicGateway::Update( ) {
+	while ( m_port.available( ) > 0 ) {
+		const int value = m_port.read( );
+
+		if ( value >= 0 && m_parser.Push( (uint8_t)value ) )
+			Execute( m_parser.GetFrame( ) );
+	}
+
+	const uint32_t now = LicClock::millis( );
+
+	if ( !m_is_polled || ( now - m_poll_time ) >= LICD_GATEWAY_POLL_PERIOD ) {
+		m_manager.PollDeviceOnce( );
+		m_poll_time = now;
+		m_is_polled = true;
+
+		TrackDevices( );
+	}
+
+	StreamSubscriptions( );
+}
+
+/**
+ * @brief Sends a frame to the host.
+ *
+ * The frame is encoded in RAM and written at once, so a frame is never
+ * interleaved with another one.
+ *
+ * @param type Frame type.
+ * @param address Address of the device.
+ * @param payload Pointer to the payload.
+ * @param size Payload size, at most `LICD_GATEWAY_PAYLOAD_SIZE`.
+ **/
+void LicGateway::Send(
+	const uint8_t type,
+	const LicDeviceAddress address,
+	const uint8_t* payload,
+	const uint8_t size
+) {
+	LicGatewayFrame frame;
+	uint8_t buffer[ LICD_GATEWAY_FRAME_SIZE ];
+
+	frame.type = type;
+	frame.address = address;
+	frame.timestamp = LicClock::millis( );
+	frame.size = ( size < LICD_GATEWAY_PAYLOAD_SIZE ) ? size : LICD_GATEWAY_PAYLOAD_SIZE;
+
+	if ( frame.size > 0 )
+		memcpy( frame.payload, payload, frame.size );
+
+	m_port.write( buffer, LicGatewayParser::Encode( frame, buffer ) );
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Reports devices that appeared or vanished since the last poll.
+ **/
+void LicGateway::TrackDevices( ) {
+	for ( uint8_t device_id = 0; device_id < LICD_DEVICE_COUNT; device_id++ ) {
+		const LicDeviceAddress address = LICD_ADDRESS_SPACE + device_id;
+		const uint8_t mask = 1 << ( device_id % 8 );
+		const bool is_attached = ( m_attached[ device_id / 8 ] & mask ) != 0;
+		const bool is_registered = m_manager.GetIsRegistered( address );
+
+		if ( is_registered == is_attached )
+			continue;
+
+		m_attached[ device_id / 8 ] ^= mask;
+
+		if ( is_registered ) {
+			const uint32_t uuid = m_manager.GetUUID( address );
+			const uint32_t capabilities = m_manager.GetCapabilities( address );
+			uint8_t payload[ 8 ];
+
+			for ( uint8_t byte_id = 0; byte_id < 4; byte_id++ ) {
+				payload[ byte_id ] = (uint8_t)( uuid >> ( 8 * byte_id ) );
+				payload[ 4 + byte_id ] = (uint8_t)( capabilities >> ( 8 * byte_id ) );
+			}
+
+			Send( LICD_GATEWAY_ATTACH, address, payload, 8 );
+			Rearm( address, uuid );
+		} else
+			Send( LICD_GATEWAY_DETACH, address, nullptr, 0 );
+	}
+}
+
+/**
+ * @brief Moves the subscriptions of an attached device to its address and re-arms them.
+ *
+ * Subscriptions bound to the UUID follow the device, subscriptions made before
+ * any device was registered at the address are bound to it. Both are read on
+ * the next update.
+ *
+ * @param address I2C address of the device.
+ * @param uuid UUID of the device.
+ **/
+void LicGateway::Rearm( const LicDeviceAddress address, const uint32_t uuid ) {
+	const uint32_t now = LicClock::millis( );
+
+	for ( uint8_t subscription_id = 0; subscription_id < LICD_GATEWAY_SUBSCRIPTIONS; subscription_id++ ) {
+		LicGatewaySubscription& subscription = m_subscriptions[ subscription_id ];
+
+		if ( subscription.address == 0 )
+			continue;
+
+		if ( subscription.uuid != uuid && ( subscription.uuid != 0 || subscription.address != address ) )
+			continue;
+
+		subscription.address = address;
+		subscription.uuid = uuid;
+		subscription.timestamp = now - subscription.period;
+	}
+}
+
+/**
+ * @brief Reads the due subscriptions and streams their answers.
+ *
+ * Subscriptions to devices that are not registered yet wait for them, so do
+ * subscriptions whose address now belongs to another device. A failed read is
+ * skipped until the next period.
+ **/
+void LicGateway::StreamSubscriptions( ) {
+	uint8_t payload[ LICD_GATEWAY_PAYLOAD_SIZE ];
+
+	for ( uint8_t subscription_id = 0; subscription_id < LICD_GATEWAY_SUBSCRIPTIONS; subscription_id++ ) {
+		LicGatewaySubscription& subscription = m_subscriptions[ subscription_id ];
+		const uint32_t now = LicClock::millis( );
+
+		if ( subscription.address == 0 || ( now - subscription.timestamp ) < subscription.period )
+			continue;
+
+		if ( !m_manager.GetIsRegistered( subscription.address ) )
+			continue;
+
+		if ( subscription.uuid != 0 && m_manager.GetUUID( subscription.address ) != subscription.uuid )
+			continue;
+
+		subscription.timestamp = now;
+		payload[ 0 ] = subscription.command;
+
+		if ( m_manager.Read( subscription.address, subscription.command, payload + 1, subscription.size ) )
+			Send( LICD_GATEWAY_DATA, subscription.address, payload, subscription.size + 1 );
+	}
+}
+
+/**
+ * @brief Runs a host command.
+ *
+ * Malformed commands are answered with a status of 1.
+ *
+ * @param frame Frame received from the host.
+ **/
+void LicGateway::Execute( const LicGatewayFrame& frame ) {
+	uint8_t status = 1;
+
+	switch ( frame.type ) {
+		case LICD_GATEWAY_READ : {
+			uint8_t answer[ LICD_FRAME_SIZE ];
+			const uint8_t size = ( frame.size >= 2 ) ? frame.payload[ 1 ] : 0;
+
+			if ( size > 0 && size <= LICD_FRAME_SIZE && m_manager.Read( frame.address, frame.payload[ 0 ], answer, size ) ) {
+				Reply( frame.type, frame.address, 0, answer, size );
+
+				return;
+			}
+
+			break;
+		}
+
+		case LICD_GATEWAY_WRITE :
+			if ( frame.size >= 2 && m_manager.WriteRegisters( frame.address, frame.payload[ 0 ], frame.payload + 1, frame.size - 1 ) )
+				status = 0;
+
+			break;
+
+		case LICD_GATEWAY_SUBSCRIBE :
+			if ( frame.size >= 4 && Subscribe( frame.address, frame.payload[ 0 ], frame.payload[ 1 ], frame.payload[ 2 ] | ( frame.payload[ 3 ] << 8 ) ) )
+				status = 0;
+
+			break;
+
+		case LICD_GATEWAY_UNSUBSCRIBE :
+			if ( frame.size >= 1 ) {
+				Unsubscribe( frame.address, frame.payload[ 0 ] );
+
+				status = 0;
+			}
+
+			break;
+
+		default :
+			break;
+	}
+
+	Reply( frame.type, frame.address, status, nullptr, 0 );
+}
+
+/**
+ * @brief Sends a reply to a host command.
+ *
+ * @param request Frame type of the host command.
+ * @param address Address of the device.
+ * @param status 0 on success.
+ * @param answer Pointer to the answer, may be `nullptr`.
+ * @param size Answer size.
+ **/
+void LicGateway::Reply(
+	const uint8_t request,
+	const LicDeviceAddress address,
+	const uint8_t status,
+	const uint8_t* answer,
+	const uint8_t size
+) {
+	uint8_t payload[ LICD_GATEWAY_PAYLOAD_SIZE ];
+
+	payload[ 0 ] = request;
+	payload[ 1 ] = status;
+
+	if ( answer != nullptr && size > 0 )
+		memcpy( payload + 2, answer, size );
+
+	Send( LICD_GATEWAY_REPLY, address, payload, size + 2 );
+}
+
+/**
+ * @brief Finds the subscription of a device command.
+ *
+ * An address of 0 finds a free slot.
+ *
+ * @param address I2C address of the device.
+ * @param command Command code.
+ * @return Pointer to the subscription, `nullptr` when none.
+ **/
+LicGatewaySubscription* LicGateway::Find( const LicDeviceAddress address, const uint8_t command ) {
+	for ( uint8_t subscription_id = 0; subscription_id < LICD_GATEWAY_SUBSCRIPTIONS; subscription_id++ ) {
+		LicGatewaySubscription& subscription = m_subscriptions[ subscription_id ];
+
+		if ( subscription.address == address && ( address == 0 || subscription.command == command ) )
+			return &subscription;
+	}
+
+	return nullptr;
+}
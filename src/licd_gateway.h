@@ -0,0 +1,348 @@
+/**
+ * @file licd_gateway.h
+ * @brief Binary gateway streaming device data from the master to a host.
+ *
+ * This header defines the gateway frame format, the `LicGatewayParser` class that
+ * decodes a byte stream back into frames, and the `LicGateway` class that turns a
+ * master into a serial gateway. The gateway polls for devices, reads subscribed
+ * commands at their own period and streams the answers to a host over a serial
+ * port, the host tunnels its own reads and writes back through the same port.
+ *
+ * ## Frame
+ * `[sync][size][type][address][timestamp u32][payload][crc16]`
+ *
+ * - `sync` is `LICD_GATEWAY_SYNC`, `size` the payload size, at most
+ *   `LICD_GATEWAY_PAYLOAD_SIZE`.
+ * - `timestamp` is the gateway time (in milliseconds) when the data was read.
+ * - Multi-byte fields are little-endian, the CRC-16 covers `size` to the end of
+ *   the payload. A parser that meets a bad CRC drops the frame and resyncs on the
+ *   next sync byte.
+ *
+ * ## Frame Types
+ * | Type          | Direction      | Payload                                |
+ * |---------------|----------------|----------------------------------------|
+ * | `DATA`        | gateway → host | `[command][answer]`                    |
+ * | `ATTACH`      | gateway → host | `[uuid u32][capabilities u32]`         |
+ * | `DETACH`      | gateway → host | -                                      |
+ * | `REPLY`       | gateway → host | `[request type][status][answer]`       |
+ * | `READ`        | host → gateway | `[command][size]`                      |
+ * | `WRITE`       | host → gateway | `[offset][data]`                       |
+ * | `SUBSCRIBE`   | host → gateway | `[command][size][period u16]`          |
+ * | `UNSUBSCRIBE` | host → gateway | `[command]`                            |
+ *
+ * `WRITE` goes through `LicDeviceManager::WriteRegisters`, a status of 0 in a
+ * `REPLY` means success.
+ *
+ * ## Devices
+ * The gateway polls with `LicDeviceManager::PollDeviceOnce`, a poll never blocks
+ * the loop nor writes text to the port, failures only show in
+ * `LicDeviceManager::GetPollErrors`. Subscriptions outlive a `DETACH`, they
+ * follow the device by UUID and are read again as soon as it attaches, at its
+ * new address.
+ *
+ * ## Usage Example
+ * ```
+ * LicDeviceManager manager;
+ * LicGateway gateway( manager, Serial );
+ *
+ * void setup( ) {
+ *     Serial.begin( 1000000 );
+ *
+ *     gateway.Subscribe( 0x02, 0x10, 2, 10 );
+ * }
+ *
+ * void loop( ) {
+ *     gateway.Update( );
+ * }
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_GATEWAY_H_
+#define LICD_GATEWAY_H_
+
+/**
+ * @brief First byte of every gateway frame.
+ **/
+#define LICD_GATEWAY_SYNC 0xA5
+
+/**
+ * @brief Size of the frame header, sync to timestamp.
+ **/
+#define LICD_GATEWAY_HEADER_SIZE 8
+
+/**
+ * @brief Largest frame payload, a reply carrying a full device answer.
+ **/
+#define LICD_GATEWAY_PAYLOAD_SIZE ( LICD_FRAME_SIZE + 2 )
+
+/**
+ * @brief Largest frame on the wire.
+ **/
+#define LICD_GATEWAY_FRAME_SIZE ( LICD_GATEWAY_HEADER_SIZE + LICD_GATEWAY_PAYLOAD_SIZE + 2 )
+
+/**
+ * @brief Maximum number of subscriptions of a gateway.
+ **/
+#ifndef LICD_GATEWAY_SUBSCRIPTIONS
+#define LICD_GATEWAY_SUBSCRIPTIONS 8
+#endif
+
+/**
+ * @brief Delay (in milliseconds) between two device polls of a gateway.
+ **/
+#ifndef LICD_GATEWAY_POLL_PERIOD
+#define LICD_GATEWAY_POLL_PERIOD 500
+#endif
+
+/**
+ * @brief Gateway frame types.
+ **/
+enum LicGatewayType : uint8_t {
+
+	LICD_GATEWAY_DATA = 0x01,
+	LICD_GATEWAY_ATTACH = 0x02,
+	LICD_GATEWAY_DETACH = 0x03,
+	LICD_GATEWAY_REPLY = 0x04,
+	LICD_GATEWAY_READ = 0x10,
+	LICD_GATEWAY_WRITE = 0x11,
+	LICD_GATEWAY_SUBSCRIBE = 0x12,
+	LICD_GATEWAY_UNSUBSCRIBE = 0x13
+
+};
+
+/**
+ * @brief Decoded gateway frame.
+ **/
+struct LicGatewayFrame {
+
+	uint8_t type = 0;
+	uint8_t address = 0;
+	uint32_t timestamp = 0;
+	uint8_t size = 0;
+	uint8_t payload[ LICD_GATEWAY_PAYLOAD_SIZE ];
+
+};
+
+/**
+ * @class LicGatewayParser
+ * @brief Decodes a byte stream into gateway frames, one byte at a time.
+ * @author : ALVES Quentin
+ **/
+class LicGatewayParser final {
+
+private:
+	uint8_t m_buffer[ LICD_GATEWAY_FRAME_SIZE ];
+	uint8_t m_size;
+	uint32_t m_errors;
+	LicGatewayFrame m_frame;
+
+public:
+	/**
+	 * @brief Constructor to initialize an empty parser.
+	 **/
+	LicGatewayParser( );
+
+	/**
+	 * @brief Destructor for the parser.
+	 **/
+	~LicGatewayParser( );
+
+	/**
+	 * @brief Pushes one received byte.
+	 *
+	 * @param value Received byte.
+	 * @return true when the byte completes a valid frame; false otherwise.
+	 **/
+	bool Push( const uint8_t value );
+
+	/**
+	 * @brief Drops the partially received frame.
+	 **/
+	void Reset( );
+
+	/**
+	 * @brief Encodes a frame.
+	 *
+	 * @param frame Frame to encode, its payload is truncated to `LICD_GATEWAY_PAYLOAD_SIZE`.
+	 * @param buffer Pointer to at least `LICD_GATEWAY_FRAME_SIZE` bytes.
+	 * @return The number of bytes written.
+	 **/
+	static uint8_t Encode( const LicGatewayFrame& frame, uint8_t* buffer );
+
+private:
+	/**
+	 * @brief Restarts the parse on the next sync byte of the buffer.
+	 *
+	 * @return true when the bytes pushed again complete a valid frame; false otherwise.
+	 **/
+	bool Resync( );
+
+public:
+	/**
+	 * @brief Retrieves the last valid frame.
+	 *
+	 * @return Reference to the frame.
+	 **/
+	const LicGatewayFrame& GetFrame( ) const;
+
+	/**
+	 * @brief Retrieves the number of frames dropped on size or CRC errors.
+	 *
+	 * @return The error count.
+	 **/
+	uint32_t GetErrors( ) const;
+
+};
+
+/**
+ * @brief Command read periodically by a gateway.
+ **/
+struct LicGatewaySubscription {
+
+	uint8_t address = 0;
+	uint8_t command = 0;
+	uint8_t size = 0;
+	uint16_t period = 0;
+	uint32_t timestamp = 0;
+	uint32_t uuid = 0;
+
+};
+
+/**
+ * @class LicGateway
+ * @brief Streams device data to a host and runs host commands.
+ * @author : ALVES Quentin
+ **/
+class LicGateway final {
+
+private:
+	LicDeviceManager& m_manager;
+	Stream& m_port;
+	LicGatewayParser m_parser;
+	LicGatewaySubscription m_subscriptions[ LICD_GATEWAY_SUBSCRIPTIONS ];
+	uint8_t m_attached[ ( LICD_DEVICE_COUNT + 7 ) / 8 ];
+	uint32_t m_poll_time;
+	bool m_is_polled;
+
+public:
+	/**
+	 * @brief Constructor to initialize a gateway.
+	 *
+	 * @param manager Reference to the device manager driving the bus.
+	 * @param port Reference to the host port, opened by the sketch.
+	 **/
+	LicGateway( LicDeviceManager& manager, Stream& port );
+
+	/**
+	 * @brief Destructor for the gateway.
+	 **/
+	~LicGateway( );
+
+	/**
+	 * @brief Reads a command of a device periodically.
+	 *
+	 * A subscription to the same device and command replaces the previous one,
+	 * it is bound to the UUID of the device when the device is registered.
+	 *
+	 * @param address I2C address of the device.
+	 * @param command Command code to read.
+	 * @param size Size of the answer in bytes, at most `LICD_FRAME_SIZE`.
+	 * @param period Delay between two reads (in milliseconds).
+	 * @return true if the subscription was stored; false when the table is full.
+	 **/
+	bool Subscribe(
+		const LicDeviceAddress address,
+		const uint8_t command,
+		const uint8_t size,
+		const uint16_t period
+	);
+
+	/**
+	 * @brief Stops reading a command of a device.
+	 *
+	 * @param address I2C address of the device.
+	 * @param command Command code.
+	 **/
+	void Unsubscribe( const LicDeviceAddress address, const uint8_t command );
+
+	/**
+	 * @brief Runs host commands, polls for devices and streams due subscriptions.
+	 *
+	 * Call it from the sketch loop.
+	 **/
+	void Update( );
+
+	/**
+	 * @brief Sends a frame to the host.
+	 *
+	 * @param type Frame type.
+	 * @param address Address of the device.
+	 * @param payload Pointer to the payload.
+	 * @param size Payload size, at most `LICD_GATEWAY_PAYLOAD_SIZE`.
+	 **/
+	void Send(
+		const uint8_t type,
+		const LicDeviceAddress address,
+		const uint8_t* payload,
+		const uint8_t size
+	);
+
+private:
+	/**
+	 * @brief Reports devices that appeared or vanished since the last poll.
+	 **/
+	void TrackDevices( );
+
+	/**
+	 * @brief Moves the subscriptions of an attached device to its address and re-arms them.
+	 *
+	 * @param address I2C address of the device.
+	 * @param uuid UUID of the device.
+	 **/
+	void Rearm( const LicDeviceAddress address, const uint32_t uuid );
+
+	/**
+	 * @brief Reads the due subscriptions and streams their answers.
+	 **/
+	void StreamSubscriptions( );
+
+	/**
+	 * @brief Runs a host command.
+	 *
+	 * @param frame Frame received from the host.
+	 **/
+	void Execute( const LicGatewayFrame& frame );
+
+	/**
+	 * @brief Sends a reply to a host command.
+	 *
+	 * @param request Frame type of the host command.
+	 * @param address Address of the device.
+	 * @param status 0 on success.
+	 * @param answer Pointer to the answer, may be `nullptr`.
+	 * @param size Answer size.
+	 **/
+	void Reply(
+		const uint8_t request,
+		const LicDeviceAddress address,
+		const uint8_t status,
+		const uint8_t* answer,
+		const uint8_t size
+	);
+
+	/**
+	 * @brief Finds the subscription of a device command.
+	 *
+	 * @param address I2C address of the device.
+	 * @param command Command code.
+	 * @return Pointer to the subscription, `nullptr` when none.
+	 **/
+	LicGatewaySubscription* Find( const LicDeviceAddress address, const uint8_t command );
+
+};
+
+#endif /* !LICD_GATEWAY_H_ */
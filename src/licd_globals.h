@@ -11,11 +11,32 @@
  *   their initial connection.
  * - `LICD_ADDRESS_SPACE`: The starting address in the I2C address space for slave devices.
  * - `LICD_DEVICE_COUNT`: The maximum number of slave devices that can be managed by the master.
+ * - `LICD_DEFAULT_UUID`: The UUID of slave devices built without one, shared by all of them.
+ * - `LICD_FRAME_SIZE`: The maximum number of bytes exchanged in a single bus transaction.
+ * - `LICD_AGGREGATOR_WINDOW`: The maximum number of samples kept by a sliding aggregation window.
+ * - `LICD_CACHE_SIZE`: The number of answers kept by the master read cache.
+ * - `LICD_CACHE_ENTRY_SIZE`: The largest answer, in bytes, kept by the master read cache.
+ * - `LICD_MANAGED_DEVICE_COUNT`: The number of devices the master keeps runtime state for.
+ * - `LICD_SHADOW_COUNT`: The number of devices the master can keep shadow registers for.
+ * - `LICD_SHADOW_SIZE`: The number of register bytes covered by a shadow.
+ * - `LICD_STREAM_SIZE`: The size of the slave stream receive buffer.
+ * - `LICD_FIRMWARE_RETRY`: The number of failed steps in a row aborting a firmware update.
+ * - `LICD_DEFAULT_CLOCK`: The SCL frequency used for registration and devices without capabilities.
+ * - `LICD_MASTER_CLOCK`: The fastest SCL frequency the master and the bus wiring support.
+ * - `LICD_CLOCK_WINDOW`: The number of transactions per adaptive clock window.
+ * - `LICD_CLOCK_ERROR_THRESHOLD`: The number of errors in a window stepping a device clock down.
+ * - `LICD_CLOCK_CLEAN_WINDOWS`: The number of clean windows stepping a device clock up.
+ * - `LICD_WIRE_TIMEOUT`: The Wire transaction timeout, used to detect a stuck bus.
+ * - `LICD_SDA_PIN` / `LICD_SCL_PIN`: The bus pins driven by hand during a bus recovery.
+ * - `LICD_RECOVERY_MISSES`: The number of recoveries in a row a device stays silent before it is forgotten.
+ * - `LICD_TRANSPORT`: The transport class carrying the LICD protocol, defaulted by `licd_transport.h`.
+ * - `LICD_CLOCK`: The clock class timing the LICD protocol.
  *
  * ## Usage Notes
  * - Ensure that these constants are consistent across all components of the LICD system to avoid
  *   communication conflicts.
- * - This file is intended for use in Arduino-compatible environments where the Wire library is used.
+ * - This file is intended for use in Arduino-compatible environments where the Wire library is used,
+ *   and in Linux host builds (see `licd_platform.h`).
  *
  * @author ALVES Quentin
  * @date 18/01/2025
@@ -49,4 +70,181 @@
  **/
 #define LICD_DEVICE_COUNT 126
 
+/**
+ * @brief UUID answered by slave devices built without one.
+ * 
+ * Every such device answers the same UUID, the master never uses it to recognize
+ * a device registering again.
+ **/
+#define LICD_DEFAULT_UUID 1
+
+/**
+ * @brief Maximum number of bytes exchanged in a single bus transaction.
+ * 
+ * Matches the default transmit and receive buffer of the Arduino Wire library.
+ **/
+#ifndef LICD_FRAME_SIZE
+#define LICD_FRAME_SIZE 32
+#endif
+
+/**
+ * @brief Maximum number of samples kept by a sliding aggregation window.
+ * 
+ * Each slot costs 4 bytes of slave RAM. Tumbling windows do not store samples
+ * and are not limited by this value.
+ **/
+#ifndef LICD_AGGREGATOR_WINDOW
+#define LICD_AGGREGATOR_WINDOW 16
+#endif
+
+/**
+ * @brief Number of answers kept by the master read cache.
+ * 
+ * Set to 0 to compile the cache out of `LicDeviceManager`.
+ **/
+#ifndef LICD_CACHE_SIZE
+#define LICD_CACHE_SIZE 8
+#endif
+
+/**
+ * @brief Largest answer, in bytes, kept by the master read cache.
+ * 
+ * Sized to hold a `LicAggregate`.
+ **/
+#ifndef LICD_CACHE_ENTRY_SIZE
+#define LICD_CACHE_ENTRY_SIZE 24
+#endif
+
+/**
+ * @brief Number of devices the master keeps runtime state for.
+ * 
+ * A state holds the cache TTL, stream credits, adaptive clock window and
+ * statistics of a device, about 40 bytes of master RAM each (4 states on AVR, 8
+ * elsewhere). States are bound at registration, devices registered once every
+ * state is bound run at their advertised clock, without caching, adaptive clock
+ * or statistics.
+ **/
+#ifndef LICD_MANAGED_DEVICE_COUNT
+#if defined( __AVR__ )
+#define LICD_MANAGED_DEVICE_COUNT 4
+#else
+#define LICD_MANAGED_DEVICE_COUNT 8
+#endif
+#endif
+
+/**
+ * @brief Number of devices the master can keep shadow registers for.
+ **/
+#ifndef LICD_SHADOW_COUNT
+#define LICD_SHADOW_COUNT 4
+#endif
+
+/**
+ * @brief Number of register bytes covered by a shadow.
+ * 
+ * Register offsets are sent as a single byte, this value must not exceed 255.
+ **/
+#ifndef LICD_SHADOW_SIZE
+#define LICD_SHADOW_SIZE 32
+#endif
+
+/**
+ * @brief Size of the slave stream receive buffer.
+ * 
+ * The buffer holds one byte less than its size, this value must not exceed 255.
+ **/
+#ifndef LICD_STREAM_SIZE
+#define LICD_STREAM_SIZE 64
+#endif
+
+/**
+ * @brief Number of failed steps in a row aborting a firmware update.
+ **/
+#ifndef LICD_FIRMWARE_RETRY
+#define LICD_FIRMWARE_RETRY 16
+#endif
+
+/**
+ * @brief SCL frequency (in Hz) used for registration and devices without capabilities.
+ **/
+#ifndef LICD_DEFAULT_CLOCK
+#define LICD_DEFAULT_CLOCK 100000
+#endif
+
+/**
+ * @brief Fastest SCL frequency (in Hz) the master and the bus wiring support.
+ * 
+ * Device clocks advertised above this value are clamped to it.
+ **/
+#ifndef LICD_MASTER_CLOCK
+#define LICD_MASTER_CLOCK 400000
+#endif
+
+/**
+ * @brief Number of transactions per adaptive clock window.
+ **/
+#ifndef LICD_CLOCK_WINDOW
+#define LICD_CLOCK_WINDOW 32
+#endif
+
+/**
+ * @brief Number of errors within a window stepping a device clock down.
+ **/
+#ifndef LICD_CLOCK_ERROR_THRESHOLD
+#define LICD_CLOCK_ERROR_THRESHOLD 2
+#endif
+
+/**
+ * @brief Number of consecutive clean windows stepping a device clock up.
+ **/
+#ifndef LICD_CLOCK_CLEAN_WINDOWS
+#define LICD_CLOCK_CLEAN_WINDOWS 4
+#endif
+
+/**
+ * @brief Wire transaction timeout (in microseconds), used to detect a stuck bus.
+ * 
+ * Only applied by Wire implementations defining `WIRE_HAS_TIMEOUT`.
+ **/
+#ifndef LICD_WIRE_TIMEOUT
+#define LICD_WIRE_TIMEOUT 25000
+#endif
+
+/**
+ * @brief `Wire.endTransmission` status reporting a timeout.
+ **/
+#define LICD_WIRE_TIMEOUT_ERROR 5
+
+/**
+ * @brief Bus pins driven by hand during a bus recovery.
+ **/
+#ifndef LICD_SDA_PIN
+#define LICD_SDA_PIN SDA
+#endif
+
+#ifndef LICD_SCL_PIN
+#define LICD_SCL_PIN SCL
+#endif
+
+/**
+ * @brief Half period (in microseconds) of the clocks pulsed during a bus recovery, 100 kHz.
+ **/
+#define LICD_RECOVERY_HALF_PERIOD 5
+
+/**
+ * @brief Number of bus recoveries in a row a device must stay silent before it is forgotten.
+ * 
+ * Counted on 2 bits per device, from 1 to 3.
+ **/
+#ifndef LICD_RECOVERY_MISSES
+#define LICD_RECOVERY_MISSES 3
+#endif
+
+/**
+ * @brief Clock class timing the LICD protocol, see `licd_clock.h`.
+ **/
+#ifndef LICD_CLOCK
+#define LICD_CLOCK LicSystemClock
+#endif
+
 #endif /* !LICD_GLOBALS_H_ */
@@ -0,0 +1,402 @@
+/**
+ * @file licd_i2c_dev.cpp
+ * @brief Implementation of the `LicI2cDevTransport` class.
+ *
+ * Only compiled by Linux host builds, Arduino builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __linux__ ) && !defined( ARDUINO )
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+/**
+ * ====================
+ * LicI2cDevTransport
+ * ====================
+ */
+
+const char* LicI2cDevTransport::s_path = LICD_I2C_DEV_PATH;
+int LicI2cDevTransport::s_file = -1;
+LicI2cDevHandler LicI2cDevTransport::s_handler = nullptr;
+LicI2cDevObserver LicI2cDevTransport::s_observer = nullptr;
+bool LicI2cDevTransport::s_is_timeout = false;
+uint8_t LicI2cDevTransport::s_tx_address = 0;
+uint8_t LicI2cDevTransport::s_tx_data[ LICD_FRAME_SIZE ] = { };
+uint8_t LicI2cDevTransport::s_tx_size = 0;
+bool LicI2cDevTransport::s_is_overflow = false;
+bool LicI2cDevTransport::s_is_pending = false;
+uint8_t LicI2cDevTransport::s_status = 0;
+uint8_t LicI2cDevTransport::s_rx_data[ LICD_FRAME_SIZE ] = { };
+uint8_t LicI2cDevTransport::s_rx_size = 0;
+uint8_t LicI2cDevTransport::s_rx_offset = 0;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Sets the device opened by `begin`.
+ *
+ * @param path Path of the i2c-dev device.
+ **/
+void LicI2cDevTransport::setDevice( const char* path ) {
+	s_path = path;
+}
+
+/**
+ * @brief Executes transactions with a handler instead of the kernel.
+ *
+ * @param handler Transaction handler, nullptr to use the kernel again.
+ **/
+void LicI2cDevTransport::setHandler( LicI2cDevHandler handler ) {
+	s_handler = handler;
+}
+
+/**
+ * @brief Reports every transaction to an observer, after its execution.
+ *
+ * @param observer Transaction observer, nullptr to stop reporting.
+ **/
+void LicI2cDevTransport::setObserver( LicI2cDevObserver observer ) {
+	s_observer = observer;
+}
+
+/**
+ * @brief Opens the i2c-dev device, unless a handler replaces the kernel.
+ **/
+void LicI2cDevTransport::begin( ) {
+	if ( s_file >= 0 || s_handler != nullptr )
+		return;
+
+	s_file = open( s_path, O_RDWR );
+
+	if ( s_file < 0 ) {
+		Serial.print( "[ERR] i2c-dev : Unable to open " );
+		Serial.println( s_path );
+	}
+}
+
+/**
+ * @brief Does nothing, i2c-dev is master only.
+ **/
+void LicI2cDevTransport::begin( const uint8_t address ) {
+	(void)address;
+}
+
+/**
+ * @brief Closes the i2c-dev device and drops the pending write.
+ **/
+void LicI2cDevTransport::end( ) {
+	if ( s_file >= 0 )
+		close( s_file );
+
+	s_file = -1;
+	s_is_pending = false;
+	s_status = 0;
+	s_tx_size = 0;
+	s_rx_size = 0;
+	s_rx_offset = 0;
+}
+
+/**
+ * @brief Does nothing, the adapter driver owns the bus clock.
+ **/
+void LicI2cDevTransport::setClock( const uint32_t clock ) {
+	(void)clock;
+}
+
+/**
+ * @brief Sets the adapter transaction timeout.
+ *
+ * `I2C_TIMEOUT` counts in units of 10 ms.
+ *
+ * @param timeout Transaction timeout (in microseconds).
+ **/
+void LicI2cDevTransport::setTimeout( const uint32_t timeout ) {
+	if ( s_file < 0 )
+		return;
+
+	const unsigned long ticks = ( timeout + 9999 ) / 10000;
+
+	ioctl( s_file, I2C_TIMEOUT, ( ticks > 0 ) ? ticks : 1 );
+}
+
+/**
+ * @brief Reads and clears the transaction timeout flag.
+ *
+ * @return true if a transaction timed out since the last call; false otherwise.
+ **/
+bool LicI2cDevTransport::getTimeoutFlag( ) {
+	const bool is_timeout = s_is_timeout;
+
+	s_is_timeout = false;
+
+	return is_timeout;
+}
+
+/**
+ * @brief Always true, the adapter driver does not expose the bus lines.
+ **/
+bool LicI2cDevTransport::isIdle( ) {
+	return true;
+}
+
+/**
+ * @brief Does nothing, the adapter driver recovers the bus by itself.
+ **/
+bool LicI2cDevTransport::recover( ) {
+	return true;
+}
+
+/**
+ * @brief Starts a write to a slave, sending the pending write first.
+ *
+ * @param address I2C address of the slave.
+ **/
+void LicI2cDevTransport::beginTransmission( const uint8_t address ) {
+	if ( s_is_pending )
+		keep( flush( ) );
+
+	s_tx_address = address;
+	s_tx_size = 0;
+	s_is_overflow = false;
+}
+
+/**
+ * @brief Queues one byte of the current write.
+ *
+ * @param value Byte to write.
+ * @return The number of bytes queued, 0 when the write exceeds `LICD_FRAME_SIZE`.
+ **/
+size_t LicI2cDevTransport::write( const uint8_t value ) {
+	if ( s_tx_size == LICD_FRAME_SIZE ) {
+		s_is_overflow = true;
+
+		return 0;
+	}
+
+	s_tx_data[ s_tx_size++ ] = value;
+
+	return 1;
+}
+
+/**
+ * @brief Sends the current write, or keeps it for the next request.
+ *
+ * A deferred write that failed since the previous call is reported here, the
+ * caller counts its NACK or timeout even though the transaction was not its own.
+ *
+ * @param send_stop Whether the write is sent now, it waits for `requestFrom` otherwise.
+ * @return A `Wire.endTransmission` like status, 0 on success, or the kept
+ *         status of a failed deferred write.
+ **/
+uint8_t LicI2cDevTransport::endTransmission( const bool send_stop ) {
+	if ( s_is_overflow ) {
+		s_tx_size = 0;
+
+		return 1;
+	}
+
+	if ( !send_stop ) {
+		s_is_pending = true;
+
+		return report( 0 );
+	}
+
+	s_is_pending = true;
+
+	return report( flush( ) );
+}
+
+/**
+ * @brief Reads bytes from a slave.
+ *
+ * A pending write to the same slave is sent in the same `I2C_RDWR` call,
+ * the read follows it with a repeated start. The status of a failed
+ * combined transaction is kept for the next `endTransmission`.
+ *
+ * @param address I2C address of the slave.
+ * @param size Number of bytes to read.
+ * @return The number of bytes received.
+ **/
+uint8_t LicI2cDevTransport::requestFrom( const uint8_t address, const uint8_t size ) {
+	struct i2c_msg messages[ 2 ];
+	uint32_t message_count = 0;
+
+	if ( s_is_pending && s_tx_address != address )
+		keep( flush( ) );
+
+	const bool is_combined = s_is_pending;
+
+	if ( s_is_pending ) {
+		messages[ message_count ].addr = s_tx_address;
+		messages[ message_count ].flags = 0;
+		messages[ message_count ].len = s_tx_size;
+		messages[ message_count ].buf = s_tx_data;
+		message_count += 1;
+
+		s_is_pending = false;
+	}
+
+	messages[ message_count ].addr = address;
+	messages[ message_count ].flags = I2C_M_RD;
+	messages[ message_count ].len = ( size < LICD_FRAME_SIZE ) ? size : LICD_FRAME_SIZE;
+	messages[ message_count ].buf = s_rx_data;
+	message_count += 1;
+
+	const uint8_t status = transfer( messages, message_count );
+
+	if ( is_combined )
+		keep( status );
+
+	s_rx_offset = 0;
+	s_rx_size = ( status == 0 ) ? (uint8_t)messages[ message_count - 1 ].len : 0;
+
+	return s_rx_size;
+}
+
+/**
+ * @brief Gets the number of received bytes left.
+ **/
+int LicI2cDevTransport::available( ) {
+	return s_rx_size - s_rx_offset;
+}
+
+/**
+ * @brief Consumes one received byte.
+ *
+ * @return The byte, -1 when none is left.
+ **/
+int LicI2cDevTransport::read( ) {
+	if ( s_rx_offset == s_rx_size )
+		return -1;
+
+	return s_rx_data[ s_rx_offset++ ];
+}
+
+/**
+ * @brief Gets the next received byte without consuming it.
+ *
+ * @return The byte, -1 when none is left.
+ **/
+int LicI2cDevTransport::peek( ) {
+	if ( s_rx_offset == s_rx_size )
+		return -1;
+
+	return s_rx_data[ s_rx_offset ];
+}
+
+/**
+ * @brief Does nothing, i2c-dev is master only.
+ **/
+void LicI2cDevTransport::onReceive( void (*handler)( int ) ) {
+	(void)handler;
+}
+
+/**
+ * @brief Does nothing, i2c-dev is master only.
+ **/
+void LicI2cDevTransport::onRequest( void (*handler)( void ) ) {
+	(void)handler;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Sends the pending write on its own.
+ *
+ * @return A `Wire.endTransmission` like status, 0 on success.
+ **/
+uint8_t LicI2cDevTransport::flush( ) {
+	struct i2c_msg message;
+
+	message.addr = s_tx_address;
+	message.flags = 0;
+	message.len = s_tx_size;
+	message.buf = s_tx_data;
+
+	s_is_pending = false;
+
+	return transfer( &message, 1 );
+}
+
+/**
+ * @brief Keeps the status of a deferred write until it is reported.
+ *
+ * @param status A `Wire.endTransmission` like status, 0 keeps the previous one.
+ **/
+void LicI2cDevTransport::keep( const uint8_t status ) {
+	if ( status != 0 )
+		s_status = status;
+}
+
+/**
+ * @brief Reports the kept status before the status of the current write.
+ *
+ * @param status A `Wire.endTransmission` like status.
+ * @return The kept status if any, the current status otherwise.
+ **/
+uint8_t LicI2cDevTransport::report( const uint8_t status ) {
+	const uint8_t kept = s_status;
+
+	s_status = 0;
+
+	return ( kept != 0 ) ? kept : status;
+}
+
+/**
+ * @brief Executes an `I2C_RDWR` transaction.
+ *
+ * `errno` values are mapped to the `Wire.endTransmission` status codes, a
+ * timeout raises the timeout flag. The observer sees the transaction once it
+ * is done, with its status and timing.
+ *
+ * @param messages Messages of the transaction.
+ * @param count Number of messages.
+ * @return A `Wire.endTransmission` like status, 0 on success.
+ **/
+uint8_t LicI2cDevTransport::transfer( struct i2c_msg* messages, const uint32_t count ) {
+	struct i2c_rdwr_ioctl_data transaction;
+	const uint64_t start = licd_host_micros( );
+	uint8_t status = 4;
+	int error = 0;
+
+	transaction.msgs = messages;
+	transaction.nmsgs = count;
+
+	if ( s_handler != nullptr )
+		error = s_handler( &transaction );
+	else if ( s_file < 0 )
+		error = ENODEV;
+	else if ( ioctl( s_file, I2C_RDWR, &transaction ) < 0 )
+		error = errno;
+
+	switch ( error ) {
+		case 0 : status = 0; break;
+		case EMSGSIZE : status = 1; break;
+		case ENXIO : status = 2; break;
+		case EREMOTEIO : status = 3; break;
+
+		case ETIMEDOUT :
+			s_is_timeout = true;
+			status = LICD_WIRE_TIMEOUT_ERROR;
+
+			break;
+
+		default : break;
+	}
+
+	if ( s_observer != nullptr )
+		s_observer( &transaction, status, start, licd_host_micros( ) - start );
+
+	return status;
+}
+
+#endif
@@ -0,0 +1,272 @@
+/**
+ * @file licd_i2c_dev.h
+ * @brief LICD master transport over the Linux i2c-dev interface.
+ *
+ * This header defines `LicI2cDevTransport`, the transport of host builds
+ * running the `LicDeviceManager` on a Linux board. It drives `/dev/i2c-N`
+ * with `ioctl( I2C_RDWR )`, a command and the request that follows it are
+ * sent as one combined transaction of two `i2c_msg`, joined by a repeated
+ * start, in a single system call.
+ *
+ * ## Behavior
+ * - `endTransmission( false )` keeps the write pending, the next `requestFrom`
+ *   to the same address sends both messages at once. Any other call sends the
+ *   pending write on its own first.
+ * - A combined transaction that fails returns no byte from `requestFrom`, a
+ *   pending write sent on its own is not checked by anyone either. Their status
+ *   is kept and returned by the next `endTransmission`, so NACKs and timeouts
+ *   of deferred writes still reach the caller.
+ * - The bus clock is set by the adapter driver (device tree `clock-frequency`),
+ *   `setClock` is accepted and ignored.
+ * - Bus recovery is performed by the adapter driver, `recover` does nothing.
+ * - i2c-dev is master only, the slave methods do nothing.
+ *
+ * ## Usage Example
+ * ```
+ * LicI2cDevTransport::setDevice( "/dev/i2c-1" );
+ *
+ * LicDeviceManager manager;
+ * ```
+ *
+ * A handler can replace the kernel, to run the master against a userspace
+ * stand-in of the bus:
+ * ```
+ * int stand_in( struct i2c_rdwr_ioctl_data* transaction ) { ... return 0; }
+ *
+ * LicI2cDevTransport::setHandler( stand_in );
+ * ```
+ *
+ * An observer sees every transaction once it is done, to trace the bus:
+ * ```
+ * void trace( const struct i2c_rdwr_ioctl_data* transaction, uint8_t status, uint64_t start, uint64_t duration ) { ... }
+ *
+ * LicI2cDevTransport::setObserver( trace );
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_I2C_DEV_H_
+#define LICD_I2C_DEV_H_
+
+#if defined( __linux__ ) && !defined( ARDUINO )
+
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+/**
+ * @brief Default i2c-dev device path.
+ **/
+#ifndef LICD_I2C_DEV_PATH
+#define LICD_I2C_DEV_PATH "/dev/i2c-1"
+#endif
+
+/**
+ * LicI2cDevHandler typedef
+ * @note : Executes an `I2C_RDWR` transaction in place of the kernel, returns 0
+ *         on success or the `errno` value the kernel would have set.
+ **/
+typedef int (*LicI2cDevHandler)( struct i2c_rdwr_ioctl_data* transaction );
+
+/**
+ * LicI2cDevObserver typedef
+ * @note : Sees an executed `I2C_RDWR` transaction, with its `Wire` like status,
+ *         its start time and its duration (in microseconds).
+ **/
+typedef void (*LicI2cDevObserver)(
+	const struct i2c_rdwr_ioctl_data* transaction,
+	const uint8_t status,
+	const uint64_t start,
+	const uint64_t duration
+);
+
+/**
+ * @class LicI2cDevTransport
+ * @brief LICD master transport over `/dev/i2c-N`.
+ * @author : ALVES Quentin
+ **/
+class LicI2cDevTransport final {
+
+private:
+	static const char* s_path;
+	static int s_file;
+	static LicI2cDevHandler s_handler;
+	static LicI2cDevObserver s_observer;
+	static bool s_is_timeout;
+	static uint8_t s_tx_address;
+	static uint8_t s_tx_data[ LICD_FRAME_SIZE ];
+	static uint8_t s_tx_size;
+	static bool s_is_overflow;
+	static bool s_is_pending;
+	static uint8_t s_status;
+	static uint8_t s_rx_data[ LICD_FRAME_SIZE ];
+	static uint8_t s_rx_size;
+	static uint8_t s_rx_offset;
+
+public:
+	/**
+	 * @brief Sets the device opened by `begin`.
+	 *
+	 * @param path Path of the i2c-dev device.
+	 **/
+	static void setDevice( const char* path );
+
+	/**
+	 * @brief Executes transactions with a handler instead of the kernel.
+	 *
+	 * @param handler Transaction handler, nullptr to use the kernel again.
+	 **/
+	static void setHandler( LicI2cDevHandler handler );
+
+	/**
+	 * @brief Reports every transaction to an observer, after its execution.
+	 *
+	 * @param observer Transaction observer, nullptr to stop reporting.
+	 **/
+	static void setObserver( LicI2cDevObserver observer );
+
+	/**
+	 * @brief Opens the i2c-dev device.
+	 **/
+	static void begin( );
+
+	/**
+	 * @brief Does nothing, i2c-dev is master only.
+	 **/
+	static void begin( const uint8_t address );
+
+	/**
+	 * @brief Closes the i2c-dev device.
+	 **/
+	static void end( );
+
+	/**
+	 * @brief Does nothing, the adapter driver owns the bus clock.
+	 **/
+	static void setClock( const uint32_t clock );
+
+	/**
+	 * @brief Sets the adapter transaction timeout.
+	 *
+	 * @param timeout Transaction timeout (in microseconds), rounded up to 10 ms.
+	 **/
+	static void setTimeout( const uint32_t timeout );
+
+	/**
+	 * @brief Reads and clears the transaction timeout flag.
+	 *
+	 * @return true if a transaction timed out since the last call; false otherwise.
+	 **/
+	static bool getTimeoutFlag( );
+
+	/**
+	 * @brief Always true, the adapter driver does not expose the bus lines.
+	 **/
+	static bool isIdle( );
+
+	/**
+	 * @brief Does nothing, the adapter driver recovers the bus by itself.
+	 **/
+	static bool recover( );
+
+	/**
+	 * @brief Starts a write to a slave.
+	 *
+	 * @param address I2C address of the slave.
+	 **/
+	static void beginTransmission( const uint8_t address );
+
+	/**
+	 * @brief Queues one byte of the current write.
+	 *
+	 * @param value Byte to write.
+	 * @return The number of bytes queued, 0 when the write exceeds `LICD_FRAME_SIZE`.
+	 **/
+	static size_t write( const uint8_t value );
+
+	/**
+	 * @brief Sends the current write, or keeps it for the next request.
+	 *
+	 * @param send_stop Whether the write is sent now, it waits for `requestFrom` otherwise.
+	 * @return A `Wire.endTransmission` like status, 0 on success, or the kept
+	 *         status of a failed deferred write.
+	 **/
+	static uint8_t endTransmission( const bool send_stop );
+
+	/**
+	 * @brief Reads bytes from a slave, after the pending write if any.
+	 *
+	 * @param address I2C address of the slave.
+	 * @param size Number of bytes to read.
+	 * @return The number of bytes received.
+	 **/
+	static uint8_t requestFrom( const uint8_t address, const uint8_t size );
+
+	/**
+	 * @brief Gets the number of received bytes left.
+	 **/
+	static int available( );
+
+	/**
+	 * @brief Consumes one received byte.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int read( );
+
+	/**
+	 * @brief Gets the next received byte without consuming it.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int peek( );
+
+	/**
+	 * @brief Does nothing, i2c-dev is master only.
+	 **/
+	static void onReceive( void (*handler)( int ) );
+
+	/**
+	 * @brief Does nothing, i2c-dev is master only.
+	 **/
+	static void onRequest( void (*handler)( void ) );
+
+private:
+	/**
+	 * @brief Sends the pending write on its own.
+	 *
+	 * @return A `Wire.endTransmission` like status, 0 on success.
+	 **/
+	static uint8_t flush( );
+
+	/**
+	 * @brief Keeps the status of a deferred write until it is reported.
+	 *
+	 * @param status A `Wire.endTransmission` like status, 0 keeps the previous one.
+	 **/
+	static void keep( const uint8_t status );
+
+	/**
+	 * @brief Reports the kept status before the status of the current write.
+	 *
+	 * @param status A `Wire.endTransmission` like status.
+	 * @return The kept status if any, the current status otherwise.
+	 **/
+	static uint8_t report( const uint8_t status );
+
+	/**
+	 * @brief Executes an `I2C_RDWR` transaction.
+	 *
+	 * @param messages Messages of the transaction.
+	 * @param count Number of messages.
+	 * @return A `Wire.endTransmission` like status, 0 on success.
+	 **/
+	static uint8_t transfer( struct i2c_msg* messages, const uint32_t count );
+
+};
+
+#endif
+
+#endif /* !LICD_I2C_DEV_H_ */
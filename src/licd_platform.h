@@ -0,0 +1,235 @@
+/**
+ * @file licd_platform.h
+ * @brief Provides the platform functions used by the LICD library.
+ *
+ * On Arduino this header only includes `Arduino.h`. On a host build (Linux
+ * gateways driving the bus through `/dev/i2c-N`) it provides the few Arduino
+ * functions the library relies on: `millis`, `micros`, `delay`,
+ * `delayMicroseconds`, `yield`, `noInterrupts`, `interrupts`, a `Serial`
+ * writing to `stderr` and the `Stream` interface of the serial gateway.
+ *
+ * ## Notes
+ * - A host build is any build where `ARDUINO` is not defined.
+ * - Host interrupts do not exist, the interrupt masks are no-op.
+ * - The host clock can be made virtual for simulations: time only moves when
+ *   the library sleeps or yields, or when the simulated bus spends wire time,
+ *   so a simulated session runs as fast as the host allows.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_PLATFORM_H_
+#define LICD_PLATFORM_H_
+
+#if defined( ARDUINO )
+
+#include <Arduino.h>
+
+#else
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include <sched.h>
+
+/**
+ * @brief Time advanced by `yield` on the virtual clock (in nanoseconds).
+ **/
+#ifndef LICD_HOST_YIELD_TIME
+#define LICD_HOST_YIELD_TIME 1000
+#endif
+
+/**
+ * @brief Virtual clock of host builds.
+ **/
+struct LicHostClock {
+
+	bool is_virtual = false;
+	uint64_t now = 0;
+
+};
+
+/**
+ * @brief Gets the virtual clock, shared by every translation unit.
+ *
+ * @return Reference to the clock, `now` counts nanoseconds.
+ **/
+inline LicHostClock& licd_host_clock( ) {
+	static LicHostClock clock;
+
+	return clock;
+}
+
+/**
+ * @brief Switches the host clock between real and virtual time.
+ *
+ * @param is_virtual Whether the clock becomes virtual.
+ * @param start Time of the virtual clock (in microseconds), ignored otherwise.
+ **/
+inline void licd_host_set_virtual( const bool is_virtual, const uint64_t start = 0 ) {
+	licd_host_clock( ).is_virtual = is_virtual;
+	licd_host_clock( ).now = start * 1000;
+}
+
+/**
+ * @brief Advances the virtual clock, does nothing on real time.
+ *
+ * @param duration Elapsed time (in nanoseconds).
+ **/
+inline void licd_host_advance( const uint64_t duration ) {
+	if ( licd_host_clock( ).is_virtual )
+		licd_host_clock( ).now += duration;
+}
+
+/**
+ * @brief Gets the time elapsed on the host monotonic clock, or the virtual time.
+ *
+ * @return The elapsed time (in microseconds).
+ **/
+inline uint64_t licd_host_micros( ) {
+	if ( licd_host_clock( ).is_virtual )
+		return licd_host_clock( ).now / 1000;
+
+	struct timespec now;
+
+	clock_gettime( CLOCK_MONOTONIC, &now );
+
+	return (uint64_t)now.tv_sec * 1000000 + (uint64_t)( now.tv_nsec / 1000 );
+}
+
+/**
+ * @brief Sleeps the calling thread, or advances the virtual time.
+ *
+ * @param duration Sleep duration (in microseconds).
+ **/
+inline void licd_host_sleep( const uint64_t duration ) {
+	if ( licd_host_clock( ).is_virtual ) {
+		licd_host_clock( ).now += duration * 1000;
+
+		return;
+	}
+
+	struct timespec request;
+
+	request.tv_sec = (time_t)( duration / 1000000 );
+	request.tv_nsec = (long)( duration % 1000000 ) * 1000;
+
+	while ( nanosleep( &request, &request ) != 0 );
+}
+
+inline unsigned long millis( ) {
+	return (unsigned long)( licd_host_micros( ) / 1000 );
+}
+
+inline unsigned long micros( ) {
+	return (unsigned long)licd_host_micros( );
+}
+
+inline void delay( const unsigned long duration ) {
+	licd_host_sleep( (uint64_t)duration * 1000 );
+}
+
+inline void delayMicroseconds( const unsigned int duration ) {
+	licd_host_sleep( duration );
+}
+
+inline void yield( ) {
+	if ( licd_host_clock( ).is_virtual )
+		licd_host_advance( LICD_HOST_YIELD_TIME );
+	else
+		sched_yield( );
+}
+
+inline void noInterrupts( ) { }
+
+inline void interrupts( ) { }
+
+/**
+ * @class LicHostSerial
+ * @brief Minimal `Serial` replacement writing to `stderr`.
+ * @author : ALVES Quentin
+ **/
+class LicHostSerial final {
+
+public:
+	void begin( const unsigned long baud_rate ) {
+		(void)baud_rate;
+	};
+
+	size_t print( const char* text ) {
+		return (size_t)fprintf( stderr, "%s", text );
+	};
+
+	size_t print( const long value ) {
+		return (size_t)fprintf( stderr, "%ld", value );
+	};
+
+	size_t print( const unsigned long value ) {
+		return (size_t)fprintf( stderr, "%lu", value );
+	};
+
+	size_t print( const int value ) {
+		return print( (long)value );
+	};
+
+	size_t print( const unsigned int value ) {
+		return print( (unsigned long)value );
+	};
+
+	size_t print( const double value ) {
+		return (size_t)fprintf( stderr, "%.2f", value );
+	};
+
+	template<typename T>
+	size_t println( const T value ) {
+		const size_t size = print( value );
+
+		return size + print( "\n" );
+	};
+
+	size_t println( ) {
+		return print( "\n" );
+	};
+
+};
+
+static LicHostSerial Serial;
+
+/**
+ * @class Stream
+ * @brief Minimal `Stream` interface, implemented by host tools to plug a
+ *        `LicGateway` on a socket, a tty or a memory queue.
+ * @author : ALVES Quentin
+ **/
+class Stream {
+
+public:
+	virtual ~Stream( ) { };
+
+	virtual int available( ) = 0;
+
+	virtual int read( ) = 0;
+
+	virtual int peek( ) = 0;
+
+	virtual size_t write( const uint8_t value ) = 0;
+
+	virtual size_t write( const uint8_t* data, size_t size ) {
+		size_t written = 0;
+
+		while ( written < size && write( data[ written ] ) == 1 )
+			written += 1;
+
+		return written;
+	};
+
+};
+
+#endif
+
+#endif /* !LICD_PLATFORM_H_ */
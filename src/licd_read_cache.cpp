@@ -0,0 +1,237 @@
+/**
+ * @file licd_read_cache.cpp
+ * @brief Implementation of the master-side read-through cache.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicReadCache
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an empty `LicReadCache`.
+ **/
+LicReadCache::LicReadCache( )
+	: m_next{ 0 },
+	m_hits{ 0 },
+	m_misses{ 0 }
+{ }
+
+/**
+ * @brief Destructor for `LicReadCache`.
+ **/
+LicReadCache::~LicReadCache( ) { }
+
+/**
+ * @brief Copies a live cached answer.
+ *
+ * Expired entries are dropped on lookup. Every call counts as a hit or a miss.
+ *
+ * @param address Address of the device.
+ * @param command Command code of the answer.
+ * @param data Pointer to the memory where the cached answer will be copied.
+ * @param size Size of the answer in bytes.
+ * @param now Current time (in milliseconds).
+ * @return true on cache hit; false otherwise.
+ **/
+bool LicReadCache::Fetch(
+	const uint8_t address,
+	const uint8_t command,
+	uint8_t* data,
+	const uint8_t size,
+	const uint32_t now
+) {
+	LicReadCacheEntry* entry = Find( address, command );
+
+	if ( entry != nullptr && ( now - entry->timestamp ) >= entry->ttl ) {
+		entry->address = 0;
+		entry = nullptr;
+	}
+
+	if ( entry == nullptr || entry->size != size ) {
+		m_misses += 1;
+
+		return false;
+	}
+
+	memcpy( data, entry->data, size );
+
+	m_hits += 1;
+
+	return true;
+}
+
+/**
+ * @brief Stores an answer, replacing any previous answer for the same key.
+ *
+ * @param address Address of the device.
+ * @param command Command code of the answer.
+ * @param data Pointer to the answer.
+ * @param size Size of the answer in bytes.
+ * @param now Current time (in milliseconds).
+ * @param ttl Time-to-live of the entry (in milliseconds).
+ **/
+void LicReadCache::Store(
+	const uint8_t address,
+	const uint8_t command,
+	const uint8_t* data,
+	const uint8_t size,
+	const uint32_t now,
+	const uint16_t ttl
+) {
+	if ( ttl == 0 || size > LICD_CACHE_ENTRY_SIZE )
+		return;
+
+	LicReadCacheEntry* entry = Find( address, command );
+
+	if ( entry == nullptr )
+		entry = Claim( now );
+
+	if ( entry == nullptr )
+		return;
+
+	entry->address = address;
+	entry->command = command;
+	entry->size = size;
+	entry->ttl = ttl;
+	entry->timestamp = now;
+
+	memcpy( entry->data, data, size );
+}
+
+/**
+ * @brief Drops every entry of a device.
+ *
+ * @param address Address of the device.
+ **/
+void LicReadCache::Invalidate( const uint8_t address ) {
+#if LICD_CACHE_SIZE > 0
+	for ( uint8_t entry_id = 0; entry_id < LICD_CACHE_SIZE; entry_id++ ) {
+		if ( m_entries[ entry_id ].address == address )
+			m_entries[ entry_id ].address = 0;
+	}
+#else
+	(void)address;
+#endif
+}
+
+/**
+ * @brief Drops the entry of a device for a command.
+ *
+ * @param address Address of the device.
+ * @param command Command code of the answer.
+ **/
+void LicReadCache::Invalidate( const uint8_t address, const uint8_t command ) {
+	LicReadCacheEntry* entry = Find( address, command );
+
+	if ( entry != nullptr )
+		entry->address = 0;
+}
+
+/**
+ * @brief Drops every entry.
+ **/
+void LicReadCache::Clear( ) {
+#if LICD_CACHE_SIZE > 0
+	for ( uint8_t entry_id = 0; entry_id < LICD_CACHE_SIZE; entry_id++ )
+		m_entries[ entry_id ].address = 0;
+#endif
+}
+
+/**
+ * @brief Resets the hit and miss counters.
+ **/
+void LicReadCache::ResetStats( ) {
+	m_hits = 0;
+	m_misses = 0;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Finds the entry of a key.
+ *
+ * Address 0 is the I2C general call address and is never assigned by LICD, it
+ * marks free slots.
+ *
+ * @return Pointer to the entry, nullptr if the key is not cached.
+ **/
+LicReadCacheEntry* LicReadCache::Find( const uint8_t address, const uint8_t command ) {
+#if LICD_CACHE_SIZE > 0
+	if ( address == 0 )
+		return nullptr;
+
+	for ( uint8_t entry_id = 0; entry_id < LICD_CACHE_SIZE; entry_id++ ) {
+		LicReadCacheEntry& entry = m_entries[ entry_id ];
+
+		if ( entry.address == address && entry.command == command )
+			return &entry;
+	}
+#else
+	(void)address;
+	(void)command;
+#endif
+
+	return nullptr;
+}
+
+/**
+ * @brief Picks the slot a new key is stored in.
+ *
+ * Free and expired slots are taken first, so a live answer is only replaced
+ * once every slot holds one. The round-robin cursor then points at the live
+ * entry stored the longest ago, give or take refreshed keys.
+ *
+ * @param now Current time (in milliseconds).
+ * @return Pointer to a free or expired entry, or to the next live entry in
+ *         round-robin order when none is left.
+ **/
+LicReadCacheEntry* LicReadCache::Claim( const uint32_t now ) {
+#if LICD_CACHE_SIZE > 0
+	for ( uint8_t entry_id = 0; entry_id < LICD_CACHE_SIZE; entry_id++ ) {
+		LicReadCacheEntry& entry = m_entries[ entry_id ];
+
+		if ( entry.address == 0 || ( now - entry.timestamp ) >= entry.ttl )
+			return &entry;
+	}
+
+	LicReadCacheEntry* entry = &m_entries[ m_next ];
+
+	m_next = ( m_next + 1 ) % LICD_CACHE_SIZE;
+
+	return entry;
+#else
+	(void)now;
+
+	return nullptr;
+#endif
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the number of reads served from the cache.
+ *
+ * @return The hit counter.
+ **/
+uint32_t LicReadCache::GetHits( ) const {
+	return m_hits;
+}
+
+/**
+ * @brief Retrieves the number of reads that went to the bus.
+ *
+ * @return The miss counter.
+ **/
+uint32_t LicReadCache::GetMisses( ) const {
+	return m_misses;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file licd_read_cache.h
+ * @brief Provides a master-side read-through cache for the LICD framework.
+ *
+ * This header defines the `LicReadCache` class, a small fixed-size cache of slave
+ * answers keyed by device address and command. Entries expire after their own
+ * time-to-live, so values read by several parts of the master firmware within a few
+ * milliseconds are served from RAM instead of causing a new bus transaction.
+ *
+ * ## Notes
+ * - Answers larger than `LICD_CACHE_ENTRY_SIZE` bytes are never cached.
+ * - A new answer takes a free or expired slot first; only when none is left is a
+ *   live slot replaced, in round-robin order.
+ * - Setting `LICD_CACHE_SIZE` to 0 compiles the entries out: every read misses and
+ *   goes to the bus.
+ * - Hit and miss counters are kept to tune `LICD_CACHE_SIZE` and device TTLs.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_READ_CACHE_H_
+#define LICD_READ_CACHE_H_
+
+/**
+ * @brief Cached answer of a device to a command.
+ **/
+struct LicReadCacheEntry {
+
+	uint8_t address = 0;
+	uint8_t command = 0;
+	uint8_t size = 0;
+	uint16_t ttl = 0;
+	uint32_t timestamp = 0;
+	uint8_t data[ LICD_CACHE_ENTRY_SIZE ];
+
+};
+
+/**
+ * @class LicReadCache
+ * @brief Fixed-size cache of device answers with per-entry time-to-live.
+ * @author : ALVES Quentin
+ **/
+class LicReadCache final {
+
+private:
+	uint8_t m_next;
+	uint32_t m_hits;
+	uint32_t m_misses;
+#if LICD_CACHE_SIZE > 0
+	LicReadCacheEntry m_entries[ LICD_CACHE_SIZE ];
+#endif
+
+public:
+	/**
+	 * @brief Constructor to initialize an empty cache.
+	 **/
+	LicReadCache( );
+
+	/**
+	 * @brief Destructor for the cache.
+	 **/
+	~LicReadCache( );
+
+	/**
+	 * @brief Copies a live cached answer.
+	 * 
+	 * @param address Address of the device.
+	 * @param command Command code of the answer.
+	 * @param data Pointer to the memory where the cached answer will be copied.
+	 * @param size Size of the answer in bytes.
+	 * @param now Current time (in milliseconds).
+	 * @return true on cache hit; false otherwise.
+	 **/
+	bool Fetch(
+		const uint8_t address,
+		const uint8_t command,
+		uint8_t* data,
+		const uint8_t size,
+		const uint32_t now
+	);
+
+	/**
+	 * @brief Stores an answer, replacing any previous answer for the same key.
+	 * 
+	 * @param address Address of the device.
+	 * @param command Command code of the answer.
+	 * @param data Pointer to the answer.
+	 * @param size Size of the answer in bytes.
+	 * @param now Current time (in milliseconds).
+	 * @param ttl Time-to-live of the entry (in milliseconds), 0 does not store anything.
+	 **/
+	void Store(
+		const uint8_t address,
+		const uint8_t command,
+		const uint8_t* data,
+		const uint8_t size,
+		const uint32_t now,
+		const uint16_t ttl
+	);
+
+	/**
+	 * @brief Drops every entry of a device.
+	 * 
+	 * @param address Address of the device.
+	 **/
+	void Invalidate( const uint8_t address );
+
+	/**
+	 * @brief Drops the entry of a device for a command.
+	 * 
+	 * @param address Address of the device.
+	 * @param command Command code of the answer.
+	 **/
+	void Invalidate( const uint8_t address, const uint8_t command );
+
+	/**
+	 * @brief Drops every entry.
+	 **/
+	void Clear( );
+
+	/**
+	 * @brief Resets the hit and miss counters.
+	 **/
+	void ResetStats( );
+
+private:
+	/**
+	 * @brief Finds the entry of a key.
+	 * 
+	 * @return Pointer to the entry, nullptr if the key is not cached.
+	 **/
+	LicReadCacheEntry* Find( const uint8_t address, const uint8_t command );
+
+	/**
+	 * @brief Picks the slot a new key is stored in.
+	 * 
+	 * @param now Current time (in milliseconds).
+	 * @return Pointer to a free or expired entry, or to the next live entry in
+	 *         round-robin order when none is left.
+	 **/
+	LicReadCacheEntry* Claim( const uint32_t now );
+
+public:
+	/**
+	 * @brief Retrieves the number of reads served from the cache.
+	 * 
+	 * @return The hit counter.
+	 **/
+	uint32_t GetHits( ) const;
+
+	/**
+	 * @brief Retrieves the number of reads that went to the bus.
+	 * 
+	 * @return The miss counter.
+	 **/
+	uint32_t GetMisses( ) const;
+
+};
+
+#endif /* !LICD_READ_CACHE_H_ */
@@ -0,0 +1,450 @@
+/**
+ * @file licd_replay.cpp
+ * @brief Implementation of the `LicSimReplay` class.
+ *
+ * Only compiled by Linux host builds, Arduino builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __linux__ ) && !defined( ARDUINO )
+
+/**
+ * ====================
+ * LicSimReplay
+ * ====================
+ */
+
+LicSimReplay* LicSimReplay::s_replay = nullptr;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an empty `LicSimReplay`.
+ **/
+LicSimReplay::LicSimReplay( )
+	: m_reader{ },
+	m_timeline{ },
+	m_next{ nullptr },
+	m_devices{ },
+	m_device_count{ 0 },
+	m_pending{ nullptr },
+	m_start{ 0 },
+	m_end{ 0 },
+	m_stats{ }
+{ }
+
+/**
+ * @brief Destructor for `LicSimReplay`, stops it.
+ **/
+LicSimReplay::~LicSimReplay( ) {
+	Stop( );
+}
+
+/**
+ * @brief Maps the capture to replay.
+ *
+ * @param path Path of the capture file.
+ * @return true if the capture holds records; false otherwise.
+ **/
+bool LicSimReplay::Open( const char* path ) {
+	LicCaptureRange range;
+	const uint8_t* payload = nullptr;
+
+	Stop( );
+
+	if ( !m_reader.Open( path ) || !m_reader.GetRange( LICD_CAPTURE_ANY, range ) )
+		return false;
+
+	m_start = range.first;
+	m_end = range.last;
+	m_timeline = m_reader.Find( );
+
+	if ( !m_reader.Next( m_timeline, m_next, payload ) )
+		m_next = nullptr;
+
+	return m_next != nullptr;
+}
+
+/**
+ * @brief Starts the replay on the simulated bus, under virtual time.
+ *
+ * Plugs the replay in `LicI2cDevTransport` and sets the virtual clock to the
+ * first record of the capture.
+ **/
+void LicSimReplay::Start( ) {
+	s_replay = this;
+
+	licd_host_set_virtual( true, m_start );
+
+	LicI2cDevTransport::setHandler( handle );
+
+	Update( );
+}
+
+/**
+ * @brief Applies the records up to the current virtual time.
+ *
+ * @return true until the virtual time passes the last record.
+ **/
+bool LicSimReplay::Update( ) {
+	const uint64_t now = licd_host_micros( );
+	const uint8_t* payload = nullptr;
+
+	while ( m_next != nullptr && m_next->timestamp <= now ) {
+		Apply( *m_next, reinterpret_cast<const uint8_t*>( m_next + 1 ) );
+
+		if ( !m_reader.Next( m_timeline, m_next, payload ) )
+			m_next = nullptr;
+	}
+
+	return now <= m_end;
+}
+
+/**
+ * @brief Stops the replay, removes its devices and restores real time.
+ *
+ * The transport is unplugged from the simulated bus.
+ **/
+void LicSimReplay::Stop( ) {
+	for ( uint8_t device_id = 0; device_id < m_device_count; device_id++ ) {
+		delete m_devices[ device_id ].device;
+
+		m_devices[ device_id ] = LicSimReplayDevice( );
+	}
+
+	m_device_count = 0;
+	m_pending = nullptr;
+	m_stats = LicSimReplayStats( );
+
+	if ( s_replay != this )
+		return;
+
+	s_replay = nullptr;
+
+	LicI2cDevTransport::setHandler( nullptr );
+
+	licd_host_set_virtual( false );
+}
+
+/**
+ * @brief Finds the device replaying a recorded address.
+ *
+ * @param address Address recorded in the capture.
+ * @return Pointer to the simulated device, nullptr when none.
+ **/
+LicSimDevice* LicSimReplay::Find( const uint8_t address ) const {
+	for ( uint8_t device_id = 0; device_id < m_device_count; device_id++ ) {
+		if ( m_devices[ device_id ].address == address )
+			return m_devices[ device_id ].device;
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief Applies the records up to the current time, then executes a transaction.
+ *
+ * @param transaction Transaction sent by `LicI2cDevTransport`.
+ * @return 0 on success, `ENXIO` when no device owns an address.
+ **/
+int LicSimReplay::handle( struct i2c_rdwr_ioctl_data* transaction ) {
+	if ( s_replay != nullptr )
+		s_replay->Update( );
+
+	return LicSimBus::handle( transaction );
+}
+
+/**
+ * @brief Answers a request with the next recorded answer.
+ *
+ * The search starts over from the binding of the device once the capture has
+ * no answer left, a request still unanswered reads as 0.
+ *
+ * @param device Simulated device.
+ * @param command Command of the request.
+ * @param data Pointer to the answer buffer.
+ * @param size Number of bytes read.
+ * @return The number of bytes written.
+ **/
+uint8_t LicSimReplay::answer( LicSimDevice& device, const uint8_t command, uint8_t* data, const uint8_t size ) {
+	LicSimReplayDevice* replayed = static_cast<LicSimReplayDevice*>( device.GetContext( ) );
+
+	if ( replayed == nullptr || replayed->replay == nullptr || replayed->address == 0 )
+		return 0;
+
+	LicSimReplay& replay = *replayed->replay;
+	const LicCaptureRecord* record = replay.Search( *replayed, command );
+
+	if ( record == nullptr ) {
+		replayed->cursor = replay.m_reader.Find( replayed->address, replayed->bind_time );
+		replayed->last_kind = 0;
+
+		record = replay.Search( *replayed, command );
+	}
+
+	if ( record == nullptr ) {
+		replay.m_stats.misses += 1;
+
+		return 0;
+	}
+
+	const uint8_t answer_size = ( record->size < size ) ? (uint8_t)record->size : size;
+	const uint64_t wire_time = LicSimBus::wireTime( record->size, LicSimBus::getClock( ) );
+	const uint64_t recorded_time = (uint64_t)record->duration * 1000;
+
+	memcpy( data, record + 1, answer_size );
+
+	if ( recorded_time > wire_time )
+		licd_host_advance( recorded_time - wire_time );
+
+	replay.m_stats.answers += 1;
+
+	return answer_size;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Applies one record of the timeline.
+ *
+ * @param record Record to apply.
+ * @param payload Payload of the record.
+ **/
+void LicSimReplay::Apply( const LicCaptureRecord& record, const uint8_t* payload ) {
+	if ( record.address == LICD_LISTENER_ADDRESS ) {
+		const bool is_write = record.kind == LICD_CAPTURE_WRITE && record.size > 0;
+
+		if ( is_write && payload[ 0 ] == LICD_COMMAND_UUID && record.status == 0 )
+			Register( );
+		else if ( is_write && payload[ 0 ] == LICD_COMMAND_ASSIGN && record.size > 1 && m_pending != nullptr ) {
+			Bind( *m_pending, payload[ 1 ], record.timestamp );
+
+			m_pending = nullptr;
+		}
+
+		return;
+	}
+
+	LicSimReplayDevice* device = FindBound( record.address );
+
+	if ( device == nullptr ) {
+		device = Create( LICD_REPLAY_UUID + record.address, 0 );
+
+		if ( device == nullptr )
+			return;
+
+		Bind( *device, record.address, record.timestamp );
+		SetAttached( *device, true );
+	}
+
+	if ( record.kind == LICD_CAPTURE_SAMPLE )
+		return;
+
+	if ( record.status != 0 && device->is_attached ) {
+		m_stats.silences += 1;
+
+		SetAttached( *device, false );
+	} else if ( record.status == 0 && !device->is_attached )
+		SetAttached( *device, true );
+}
+
+/**
+ * @brief Adds the device registered by the poll just applied.
+ *
+ * The header read after the poll gives the device identity, a device already
+ * replayed goes back to the listener address as after a reset.
+ **/
+void LicSimReplay::Register( ) {
+	LicCaptureCursor cursor = m_timeline;
+	const LicCaptureRecord* record = nullptr;
+	const uint8_t* payload = nullptr;
+
+	while ( m_reader.Next( cursor, record, payload ) ) {
+		if ( record->address != LICD_LISTENER_ADDRESS )
+			continue;
+
+		if ( record->kind != LICD_CAPTURE_READ )
+			return;
+
+		if ( record->status != 0 || record->size < sizeof( LicDeviceHeader ) )
+			return;
+
+		LicDeviceHeader header;
+
+		memcpy( &header, payload, sizeof( LicDeviceHeader ) );
+
+		for ( uint8_t device_id = 0; device_id < m_device_count; device_id++ ) {
+			LicSimReplayDevice& device = m_devices[ device_id ];
+
+			if ( device.device->GetHeader( ).uuid != header.uuid )
+				continue;
+
+			m_stats.resets += 1;
+			m_pending = &device;
+
+			device.device->Reset( );
+
+			SetAttached( device, true );
+
+			return;
+		}
+
+		m_pending = Create( header.uuid, header.flags );
+
+		if ( m_pending != nullptr )
+			SetAttached( *m_pending, true );
+
+		return;
+	}
+}
+
+/**
+ * @brief Creates a replayed device.
+ *
+ * @param uuid UUID of the device.
+ * @param flags Capability flags of the device.
+ * @return Pointer to the device, nullptr when the bus is full.
+ **/
+LicSimReplayDevice* LicSimReplay::Create( const uint32_t uuid, const uint32_t flags ) {
+	if ( m_device_count == LICD_SIM_DEVICE_COUNT )
+		return nullptr;
+
+	LicSimReplayDevice& device = m_devices[ m_device_count++ ];
+
+	device = LicSimReplayDevice( );
+	device.replay = this;
+	device.device = new LicSimDevice( uuid, flags );
+	device.device->SetHandlers( nullptr, answer, &device );
+
+	return &device;
+}
+
+/**
+ * @brief Binds a device to its recorded address.
+ *
+ * @param device Replayed device.
+ * @param address Recorded address.
+ * @param time Time of the binding, answers are searched after it.
+ **/
+void LicSimReplay::Bind( LicSimReplayDevice& device, const uint8_t address, const uint64_t time ) {
+	device.address = address;
+	device.bind_time = time;
+	device.cursor = m_reader.Find( address, time );
+	device.command = 0;
+	device.last_kind = 0;
+}
+
+/**
+ * @brief Adds or removes a device from the simulated bus.
+ *
+ * @param device Replayed device.
+ * @param is_attached Whether the device answers.
+ **/
+void LicSimReplay::SetAttached( LicSimReplayDevice& device, const bool is_attached ) {
+	if ( device.is_attached == is_attached )
+		return;
+
+	if ( is_attached )
+		device.is_attached = LicSimBus::attach( device.device );
+	else {
+		LicSimBus::detach( device.device );
+
+		device.is_attached = false;
+	}
+}
+
+/**
+ * @brief Finds the replayed device bound to a recorded address.
+ *
+ * @param address Recorded address.
+ * @return Pointer to the device, nullptr when none.
+ **/
+LicSimReplayDevice* LicSimReplay::FindBound( const uint8_t address ) {
+	for ( uint8_t device_id = 0; device_id < m_device_count; device_id++ ) {
+		if ( m_devices[ device_id ].address == address )
+			return &m_devices[ device_id ];
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief Searches the next recorded answer of a device.
+ *
+ * Writes give the command of the reads that follow them. A gateway sample right
+ * after a read holds the same answer and is skipped.
+ *
+ * @param device Replayed device, its cursor moves past the answer.
+ * @param command Command of the request.
+ * @return The answer record, nullptr when none is left.
+ **/
+const LicCaptureRecord* LicSimReplay::Search( LicSimReplayDevice& device, const uint8_t command ) const {
+	const LicCaptureRecord* record = nullptr;
+	const uint8_t* payload = nullptr;
+
+	while ( m_reader.Next( device.cursor, record, payload ) ) {
+		const uint8_t last_kind = device.last_kind;
+
+		device.last_kind = record->kind;
+
+		switch ( record->kind ) {
+			case LICD_CAPTURE_WRITE :
+				device.command = record->command;
+
+				break;
+
+			case LICD_CAPTURE_READ :
+				if ( record->status == 0 && device.command == command )
+					return record;
+
+				break;
+
+			case LICD_CAPTURE_SAMPLE :
+				if ( last_kind != LICD_CAPTURE_READ && record->command == command )
+					return record;
+
+				break;
+
+			default : break;
+		}
+	}
+
+	return nullptr;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the time of the first record (in microseconds).
+ **/
+uint64_t LicSimReplay::GetStart( ) const {
+	return m_start;
+}
+
+/**
+ * @brief Retrieves the time of the last record (in microseconds).
+ **/
+uint64_t LicSimReplay::GetEnd( ) const {
+	return m_end;
+}
+
+/**
+ * @brief Retrieves the replay counters.
+ **/
+const LicSimReplayStats& LicSimReplay::GetStats( ) const {
+	return m_stats;
+}
+
+/**
+ * @brief Retrieves the mapped capture.
+ **/
+const LicCaptureReader& LicSimReplay::GetReader( ) const {
+	return m_reader;
+}
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file licd_replay.h
+ * @brief Replay of captured bus sessions on the simulated bus.
+ *
+ * This header defines `LicSimReplay`, which plays the slave side of a capture
+ * (see `licd_capture.h`) with `LicSimDevice` peers while the real master code
+ * runs under the virtual host clock. Field traffic that caused a stall can then
+ * be reproduced, and scheduler or retry changes measured against it.
+ *
+ * ## Timeline
+ * Virtual time starts at the first record of the capture, so virtual and
+ * recorded times match. Before every transaction, the records up to the
+ * current time are applied to the devices:
+ * - A successful `UUID` poll adds the device whose header follows it, waiting on
+ *   the listener address. A known device registering again is reset.
+ * - `ASSIGN` binds that device to the address recorded for it.
+ * - A failed transaction to a device removes it from the bus until the next
+ *   successful one, the master sees the same NACKs.
+ * - A device with traffic but no registration in the capture is added on its
+ *   first record, with UUID `LICD_REPLAY_UUID` plus its recorded address.
+ *
+ * ## Answers
+ * A device answers each request with the next recorded answer to the same
+ * command, found after its last answer, from the start again once the capture
+ * runs out. Gateway samples are answers too, unless they only repeat the read
+ * recorded just before them. The recorded duration of an answer beyond its
+ * modeled wire time is spent on the virtual clock, so slow slaves stay slow. A
+ * request without recorded answer reads as 0.
+ *
+ * ## Usage Example
+ * ```
+ * LicSimReplay replay;
+ * LicDeviceManager manager;
+ *
+ * replay.Open( "field.lcap" );
+ * replay.Start( );
+ *
+ * while ( replay.Update( ) ) {
+ *     manager.PollDevice( );
+ *     ...
+ * }
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_REPLAY_H_
+#define LICD_REPLAY_H_
+
+#if defined( __linux__ ) && !defined( ARDUINO )
+
+/**
+ * @brief Base UUID of replayed devices whose registration was not captured.
+ **/
+#define LICD_REPLAY_UUID 0x5EED0000
+
+/**
+ * @brief Counters of a replay.
+ **/
+struct LicSimReplayStats {
+
+	uint32_t answers = 0;
+	uint32_t misses = 0;
+	uint32_t silences = 0;
+	uint32_t resets = 0;
+
+};
+
+class LicSimReplay;
+
+/**
+ * @brief Replayed device and its position in the capture.
+ **/
+struct LicSimReplayDevice {
+
+	LicSimReplay* replay = nullptr;
+	LicSimDevice* device = nullptr;
+	LicCaptureCursor cursor;
+	uint64_t bind_time = 0;
+	uint8_t address = 0;
+	uint8_t command = 0;
+	uint8_t last_kind = 0;
+	bool is_attached = false;
+
+};
+
+/**
+ * @class LicSimReplay
+ * @brief Plays the slave side of a capture on the simulated bus.
+ * @author : ALVES Quentin
+ **/
+class LicSimReplay final {
+
+private:
+	static LicSimReplay* s_replay;
+
+	LicCaptureReader m_reader;
+	LicCaptureCursor m_timeline;
+	const LicCaptureRecord* m_next;
+	LicSimReplayDevice m_devices[ LICD_SIM_DEVICE_COUNT ];
+	uint8_t m_device_count;
+	LicSimReplayDevice* m_pending;
+	uint64_t m_start;
+	uint64_t m_end;
+	LicSimReplayStats m_stats;
+
+public:
+	/**
+	 * @brief Constructor to initialize an empty replay.
+	 **/
+	LicSimReplay( );
+
+	/**
+	 * @brief Destructor for the replay, stops it.
+	 **/
+	~LicSimReplay( );
+
+	/**
+	 * @brief Maps the capture to replay.
+	 *
+	 * @param path Path of the capture file.
+	 * @return true if the capture holds records; false otherwise.
+	 **/
+	bool Open( const char* path );
+
+	/**
+	 * @brief Starts the replay on the simulated bus, under virtual time.
+	 *
+	 * Plugs the replay in `LicI2cDevTransport` and sets the virtual clock to the
+	 * first record of the capture.
+	 **/
+	void Start( );
+
+	/**
+	 * @brief Applies the records up to the current virtual time.
+	 *
+	 * @return true until the virtual time passes the last record.
+	 **/
+	bool Update( );
+
+	/**
+	 * @brief Stops the replay, removes its devices and restores real time.
+	 **/
+	void Stop( );
+
+	/**
+	 * @brief Finds the device replaying a recorded address.
+	 *
+	 * @param address Address recorded in the capture.
+	 * @return Pointer to the simulated device, nullptr when none.
+	 **/
+	LicSimDevice* Find( const uint8_t address ) const;
+
+	/**
+	 * @brief Applies the records up to the current time, then executes a transaction.
+	 *
+	 * @param transaction Transaction sent by `LicI2cDevTransport`.
+	 * @return 0 on success, `ENXIO` when no device owns an address.
+	 **/
+	static int handle( struct i2c_rdwr_ioctl_data* transaction );
+
+	/**
+	 * @brief Answers a request with the next recorded answer.
+	 *
+	 * @param device Simulated device.
+	 * @param command Command of the request.
+	 * @param data Pointer to the answer buffer.
+	 * @param size Number of bytes read.
+	 * @return The number of bytes written.
+	 **/
+	static uint8_t answer( LicSimDevice& device, const uint8_t command, uint8_t* data, const uint8_t size );
+
+private:
+	/**
+	 * @brief Applies one record of the timeline.
+	 *
+	 * @param record Record to apply.
+	 * @param payload Payload of the record.
+	 **/
+	void Apply( const LicCaptureRecord& record, const uint8_t* payload );
+
+	/**
+	 * @brief Adds the device registered by the poll just applied.
+	 **/
+	void Register( );
+
+	/**
+	 * @brief Creates a replayed device.
+	 *
+	 * @param uuid UUID of the device.
+	 * @param flags Capability flags of the device.
+	 * @return Pointer to the device, nullptr when the bus is full.
+	 **/
+	LicSimReplayDevice* Create( const uint32_t uuid, const uint32_t flags );
+
+	/**
+	 * @brief Binds a device to its recorded address.
+	 *
+	 * @param device Replayed device.
+	 * @param address Recorded address.
+	 * @param time Time of the binding, answers are searched after it.
+	 **/
+	void Bind( LicSimReplayDevice& device, const uint8_t address, const uint64_t time );
+
+	/**
+	 * @brief Adds or removes a device from the simulated bus.
+	 *
+	 * @param device Replayed device.
+	 * @param is_attached Whether the device answers.
+	 **/
+	void SetAttached( LicSimReplayDevice& device, const bool is_attached );
+
+	/**
+	 * @brief Finds the replayed device bound to a recorded address.
+	 *
+	 * @param address Recorded address.
+	 * @return Pointer to the device, nullptr when none.
+	 **/
+	LicSimReplayDevice* FindBound( const uint8_t address );
+
+	/**
+	 * @brief Searches the next recorded answer of a device.
+	 *
+	 * @param device Replayed device, its cursor moves past the answer.
+	 * @param command Command of the request.
+	 * @return The answer record, nullptr when none is left.
+	 **/
+	const LicCaptureRecord* Search( LicSimReplayDevice& device, const uint8_t command ) const;
+
+public:
+	/**
+	 * @brief Retrieves the time of the first record (in microseconds).
+	 **/
+	uint64_t GetStart( ) const;
+
+	/**
+	 * @brief Retrieves the time of the last record (in microseconds).
+	 **/
+	uint64_t GetEnd( ) const;
+
+	/**
+	 * @brief Retrieves the replay counters.
+	 **/
+	const LicSimReplayStats& GetStats( ) const;
+
+	/**
+	 * @brief Retrieves the mapped capture.
+	 **/
+	const LicCaptureReader& GetReader( ) const;
+
+};
+
+#endif
+
+#endif /* !LICD_REPLAY_H_ */
@@ -0,0 +1,337 @@
+/**
+ * @file licd_ring.cpp
+ * @brief Implementation of the shared-memory sample ring.
+ *
+ * Only compiled by POSIX host builds, Arduino builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __unix__ ) && !defined( ARDUINO )
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * ====================
+ * LicSampleRing
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an unmapped `LicSampleRing`.
+ **/
+LicSampleRing::LicSampleRing( )
+	: m_header{ nullptr },
+	m_slots{ nullptr },
+	m_size{ 0 },
+	m_generation{ 0 },
+	m_cursor{ 0 },
+	m_lost{ 0 }
+{ }
+
+/**
+ * @brief Destructor for `LicSampleRing`, unmaps it.
+ **/
+LicSampleRing::~LicSampleRing( ) {
+	Close( );
+}
+
+/**
+ * @brief Creates or resets a ring file and maps it as producer.
+ *
+ * Consumers may still map the file, it is only grown and is reset in place:
+ * the magic number is cleared and the generation bumped first, the geometry
+ * written next and the magic number last. A consumer meanwhile sees an invalid
+ * ring instead of a half initialized one, then follows the new generation.
+ *
+ * @param path Path of the ring file, on a tmpfs like `/dev/shm`.
+ * @param slot_count Number of slots.
+ * @return true if the ring is mapped; false otherwise.
+ **/
+bool LicSampleRing::Create( const char* path, const uint32_t slot_count ) {
+	Close( );
+
+	if ( slot_count == 0 )
+		return false;
+
+	const int file = open( path, O_RDWR | O_CREAT, 0644 );
+	const size_t size = sizeof( LicRingHeader ) + (size_t)slot_count * sizeof( LicRingSlot );
+	struct stat status;
+
+	if ( file < 0 )
+		return false;
+
+	if ( fstat( file, &status ) != 0 || ( (size_t)status.st_size < size && ftruncate( file, (off_t)size ) != 0 ) ) {
+		close( file );
+
+		return false;
+	}
+
+	if ( !Map( file ) )
+		return false;
+
+	const uint32_t generation = m_header->generation.load( std::memory_order_relaxed ) + 1;
+
+	m_header->magic.store( 0, std::memory_order_relaxed );
+	m_header->generation.store( generation, std::memory_order_relaxed );
+
+	std::atomic_thread_fence( std::memory_order_release );
+
+	m_header->version = LICD_RING_VERSION;
+	m_header->slot_size = (uint16_t)sizeof( LicRingSlot );
+	m_header->slot_count = slot_count;
+	m_header->head.store( 0, std::memory_order_relaxed );
+
+	for ( uint32_t slot_id = 0; slot_id < slot_count; slot_id++ )
+		m_slots[ slot_id ].sequence.store( 0, std::memory_order_relaxed );
+
+	m_header->magic.store( LICD_RING_MAGIC, std::memory_order_release );
+
+	m_generation = generation;
+
+	return true;
+}
+
+/**
+ * @brief Maps an existing ring file as consumer.
+ *
+ * @param path Path of the ring file.
+ * @return true if the ring is mapped; false otherwise.
+ **/
+bool LicSampleRing::Open( const char* path ) {
+	Close( );
+
+	const int file = open( path, O_RDWR );
+
+	if ( file < 0 || !Map( file ) )
+		return false;
+
+	const bool is_valid = m_header->magic == LICD_RING_MAGIC
+		&& m_header->version == LICD_RING_VERSION
+		&& m_header->slot_size == sizeof( LicRingSlot )
+		&& m_size >= sizeof( LicRingHeader ) + (size_t)m_header->slot_count * sizeof( LicRingSlot );
+
+	if ( !is_valid ) {
+		Close( );
+
+		return false;
+	}
+
+	m_generation = m_header->generation.load( std::memory_order_acquire );
+	m_cursor = m_header->head.load( std::memory_order_acquire );
+
+	return true;
+}
+
+/**
+ * @brief Unmaps the ring.
+ **/
+void LicSampleRing::Close( ) {
+	if ( m_header != nullptr )
+		munmap( m_header, m_size );
+
+	m_header = nullptr;
+	m_slots = nullptr;
+	m_size = 0;
+	m_generation = 0;
+	m_cursor = 0;
+	m_lost = 0;
+}
+
+/**
+ * @brief Publishes a sample, overwriting the oldest one when the ring is full.
+ *
+ * @param command Command code of the sample.
+ * @param timestamp Time of the sample (in milliseconds).
+ * @param data Pointer to the sample bytes.
+ * @param size Number of bytes, truncated to `LICD_FRAME_SIZE`.
+ **/
+void LicSampleRing::Publish(
+	const uint8_t command,
+	const uint32_t timestamp,
+	const uint8_t* data,
+	const uint8_t size
+) {
+	if ( m_header == nullptr )
+		return;
+
+	const uint64_t head = m_header->head.load( std::memory_order_relaxed );
+	LicRingSlot& slot = m_slots[ head % m_header->slot_count ];
+
+	slot.sequence.store( 2 * head + 1, std::memory_order_relaxed );
+
+	std::atomic_thread_fence( std::memory_order_release );
+
+	slot.timestamp = timestamp;
+	slot.command = command;
+	slot.size = ( size < LICD_FRAME_SIZE ) ? size : LICD_FRAME_SIZE;
+
+	memcpy( slot.data, data, slot.size );
+
+	slot.sequence.store( 2 * head + 2, std::memory_order_release );
+	m_header->head.store( head + 1, std::memory_order_release );
+}
+
+/**
+ * @brief Reads the next sample of the consumer, never blocks.
+ *
+ * The slot is copied and its sequence checked again, a copy raced by the
+ * producer is dropped and attempted again up to `LICD_RING_READ_ATTEMPTS`
+ * times. A slot already holding a newer sample counts as lost. A slot still
+ * being written, for instance by a producer that died in `Publish`, reads as
+ * an empty ring.
+ *
+ * @param sample Reference to the sample to fill.
+ * @return `LICD_RING_EMPTY` when no sample is left, `LICD_RING_OVERRUN` when
+ *         samples were lost before this one, `LICD_RING_OK` otherwise.
+ **/
+LicRingStatus LicSampleRing::Read( LicRingSample& sample ) {
+	if ( m_header == nullptr )
+		return LICD_RING_EMPTY;
+
+	bool is_overrun = false;
+
+	for ( uint8_t attempt = 0; attempt < LICD_RING_READ_ATTEMPTS; attempt++ ) {
+		if ( !Follow( ) )
+			return LICD_RING_EMPTY;
+
+		const uint32_t slot_count = m_header->slot_count;
+		const uint64_t head = m_header->head.load( std::memory_order_acquire );
+
+		if ( slot_count == 0 || sizeof( LicRingHeader ) + (size_t)slot_count * sizeof( LicRingSlot ) > m_size )
+			return LICD_RING_EMPTY;
+
+		if ( m_cursor >= head )
+			return LICD_RING_EMPTY;
+
+		if ( head - m_cursor > slot_count ) {
+			m_lost += head - slot_count - m_cursor;
+			m_cursor = head - slot_count;
+			is_overrun = true;
+		}
+
+		const LicRingSlot& slot = m_slots[ m_cursor % slot_count ];
+		const uint64_t sequence = slot.sequence.load( std::memory_order_acquire );
+
+		if ( sequence < 2 * m_cursor + 2 )
+			return LICD_RING_EMPTY;
+
+		if ( sequence > 2 * m_cursor + 2 ) {
+			m_lost += 1;
+			m_cursor += 1;
+			is_overrun = true;
+
+			continue;
+		}
+
+		sample.sequence = m_cursor;
+		sample.timestamp = slot.timestamp;
+		sample.command = slot.command;
+		sample.size = ( slot.size < LICD_FRAME_SIZE ) ? slot.size : LICD_FRAME_SIZE;
+
+		memcpy( sample.data, slot.data, sample.size );
+
+		std::atomic_thread_fence( std::memory_order_acquire );
+
+		if ( slot.sequence.load( std::memory_order_relaxed ) != sequence )
+			continue;
+
+		if ( m_header->generation.load( std::memory_order_relaxed ) != m_generation )
+			continue;
+
+		m_cursor += 1;
+
+		return is_overrun ? LICD_RING_OVERRUN : LICD_RING_OK;
+	}
+
+	return LICD_RING_EMPTY;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Maps a ring file.
+ *
+ * Consumers map the ring writable too, 64-bit atomic loads of some 32-bit
+ * targets store to the word they read.
+ *
+ * @param file File descriptor of the ring file, closed by this call.
+ * @return true if the ring is mapped; false otherwise.
+ **/
+bool LicSampleRing::Map( const int file ) {
+	struct stat status;
+
+	if ( fstat( file, &status ) != 0 || (size_t)status.st_size < sizeof( LicRingHeader ) ) {
+		close( file );
+
+		return false;
+	}
+
+	void* memory = mmap( nullptr, (size_t)status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0 );
+
+	close( file );
+
+	if ( memory == MAP_FAILED )
+		return false;
+
+	m_header = static_cast<LicRingHeader*>( memory );
+	m_slots = reinterpret_cast<LicRingSlot*>( m_header + 1 );
+	m_size = (size_t)status.st_size;
+
+	return true;
+}
+
+/**
+ * @brief Follows the generation of the ring.
+ *
+ * A new generation restarts the consumer on its first sample.
+ *
+ * @return true if the ring is valid; false while it is reset.
+ **/
+bool LicSampleRing::Follow( ) {
+	if ( m_header->magic.load( std::memory_order_acquire ) != LICD_RING_MAGIC )
+		return false;
+
+	const uint32_t generation = m_header->generation.load( std::memory_order_acquire );
+
+	if ( generation != m_generation ) {
+		m_generation = generation;
+		m_cursor = 0;
+	}
+
+	return true;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the number of samples published so far.
+ **/
+uint64_t LicSampleRing::GetHead( ) const {
+	return ( m_header != nullptr ) ? m_header->head.load( std::memory_order_acquire ) : 0;
+}
+
+/**
+ * @brief Retrieves the number of samples the consumer lost to overruns.
+ **/
+uint64_t LicSampleRing::GetLost( ) const {
+	return m_lost;
+}
+
+/**
+ * @brief Retrieves whether the ring is mapped.
+ **/
+bool LicSampleRing::GetIsOpen( ) const {
+	return m_header != nullptr;
+}
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * @file licd_ring.h
+ * @brief Shared-memory ring publishing device samples to host consumers.
+ *
+ * This header defines `LicSampleRing`, a memory-mapped single-producer,
+ * multi-consumer ring of device samples. The producer (usually `licd-gatewayd`)
+ * publishes every sample of a device in its own ring file, consumers in other
+ * processes map the same file and read the samples without system calls or
+ * copies through the kernel.
+ *
+ * ## Layout
+ * `[header][slot 0]...[slot N-1]`, the header holds the ring geometry and the
+ * head, the number of samples published so far. Sample `n` lives in slot
+ * `n % N`.
+ *
+ * ## Sequence Numbers
+ * - Each slot holds a sequence word, odd while the producer writes the slot and
+ *   `2 * n + 2` once sample `n` is complete.
+ * - A consumer keeps its own cursor. When the producer laps it, or overwrites
+ *   the slot while it is copied, the consumer jumps to the oldest sample still
+ *   in the ring, counts the skipped samples as lost and reports
+ *   `LICD_RING_OVERRUN`. The producer never waits for consumers.
+ * - A slot still being written reads as `LICD_RING_EMPTY`, a consumer never
+ *   waits for the producer either.
+ *
+ * ## Generations
+ * Creating the ring again resets it in place: the magic number is cleared, the
+ * generation bumped, then the ring is initialized and the magic number written
+ * back. Consumers still mapping the file restart from the first sample of the
+ * new generation instead of waiting for the old head.
+ *
+ * ## Usage Example
+ * ```
+ * // Producer
+ * LicSampleRing ring;
+ *
+ * ring.Create( "/dev/shm/licd-0-02.ring", 1024 );
+ * ring.Publish( 0x10, millis( ), data, 4 );
+ *
+ * // Consumer
+ * LicSampleRing ring;
+ * LicRingSample sample;
+ *
+ * ring.Open( "/dev/shm/licd-0-02.ring" );
+ *
+ * while ( ring.Read( sample ) != LICD_RING_EMPTY ) { ... }
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_RING_H_
+#define LICD_RING_H_
+
+#if defined( __unix__ ) && !defined( ARDUINO )
+
+#include <atomic>
+
+/**
+ * @brief Magic number of ring files, "LRNG".
+ **/
+#define LICD_RING_MAGIC 0x474E524C
+
+/**
+ * @brief Version of the ring file layout.
+ **/
+#define LICD_RING_VERSION 1
+
+/**
+ * @brief Default number of slots of a ring.
+ **/
+#ifndef LICD_RING_SLOT_COUNT
+#define LICD_RING_SLOT_COUNT 1024
+#endif
+
+/**
+ * @brief Number of attempts of a ring read before it reports an empty ring.
+ *
+ * A read is attempted again when the producer overwrites the slot while it is
+ * copied.
+ **/
+#ifndef LICD_RING_READ_ATTEMPTS
+#define LICD_RING_READ_ATTEMPTS 4
+#endif
+
+/**
+ * @brief Results of a ring read.
+ **/
+enum LicRingStatus : uint8_t {
+
+	LICD_RING_OK = 0,
+	LICD_RING_EMPTY,
+	LICD_RING_OVERRUN
+
+};
+
+/**
+ * @brief Header at the start of a ring file.
+ **/
+struct LicRingHeader {
+
+	std::atomic<uint32_t> magic;
+	uint16_t version;
+	uint16_t slot_size;
+	uint32_t slot_count;
+	std::atomic<uint32_t> generation;
+	std::atomic<uint64_t> head;
+
+};
+
+/**
+ * @brief Slot of a ring file.
+ **/
+struct LicRingSlot {
+
+	std::atomic<uint64_t> sequence;
+	uint32_t timestamp;
+	uint8_t command;
+	uint8_t size;
+	uint8_t reserved[ 2 ];
+	uint8_t data[ LICD_FRAME_SIZE ];
+
+};
+
+/**
+ * @brief Sample read from a ring.
+ **/
+struct LicRingSample {
+
+	uint64_t sequence = 0;
+	uint32_t timestamp = 0;
+	uint8_t command = 0;
+	uint8_t size = 0;
+	uint8_t data[ LICD_FRAME_SIZE ];
+
+};
+
+/**
+ * @class LicSampleRing
+ * @brief Memory-mapped single-producer, multi-consumer ring of device samples.
+ * @author : ALVES Quentin
+ **/
+class LicSampleRing final {
+
+private:
+	LicRingHeader* m_header;
+	LicRingSlot* m_slots;
+	size_t m_size;
+	uint32_t m_generation;
+	uint64_t m_cursor;
+	uint64_t m_lost;
+
+public:
+	/**
+	 * @brief Constructor to initialize an unmapped ring.
+	 **/
+	LicSampleRing( );
+
+	/**
+	 * @brief Destructor for the ring, unmaps it.
+	 **/
+	~LicSampleRing( );
+
+	/**
+	 * @brief Creates or resets a ring file and maps it as producer.
+	 *
+	 * An existing ring is reset in place under a new generation, the file is
+	 * never shrunk under the consumers mapping it.
+	 *
+	 * @param path Path of the ring file, on a tmpfs like `/dev/shm`.
+	 * @param slot_count Number of slots.
+	 * @return true if the ring is mapped; false otherwise.
+	 **/
+	bool Create( const char* path, const uint32_t slot_count = LICD_RING_SLOT_COUNT );
+
+	/**
+	 * @brief Maps an existing ring file as consumer.
+	 *
+	 * The consumer starts after the last published sample.
+	 *
+	 * @param path Path of the ring file.
+	 * @return true if the ring is mapped; false otherwise.
+	 **/
+	bool Open( const char* path );
+
+	/**
+	 * @brief Unmaps the ring.
+	 **/
+	void Close( );
+
+	/**
+	 * @brief Publishes a sample, overwriting the oldest one when the ring is full.
+	 *
+	 * @param command Command code of the sample.
+	 * @param timestamp Time of the sample (in milliseconds).
+	 * @param data Pointer to the sample bytes.
+	 * @param size Number of bytes, truncated to `LICD_FRAME_SIZE`.
+	 **/
+	void Publish(
+		const uint8_t command,
+		const uint32_t timestamp,
+		const uint8_t* data,
+		const uint8_t size
+	);
+
+	/**
+	 * @brief Reads the next sample of the consumer, never blocks.
+	 *
+	 * @param sample Reference to the sample to fill.
+	 * @return `LICD_RING_EMPTY` when no sample is left, `LICD_RING_OVERRUN` when
+	 *         samples were lost before this one, `LICD_RING_OK` otherwise.
+	 **/
+	LicRingStatus Read( LicRingSample& sample );
+
+private:
+	/**
+	 * @brief Maps a ring file.
+	 *
+	 * @param file File descriptor of the ring file, closed by this call.
+	 * @return true if the ring is mapped; false otherwise.
+	 **/
+	bool Map( const int file );
+
+	/**
+	 * @brief Follows the generation of the ring.
+	 *
+	 * @return true if the ring is valid; false while it is reset.
+	 **/
+	bool Follow( );
+
+public:
+	/**
+	 * @brief Retrieves the number of samples published so far.
+	 **/
+	uint64_t GetHead( ) const;
+
+	/**
+	 * @brief Retrieves the number of samples the consumer lost to overruns.
+	 **/
+	uint64_t GetLost( ) const;
+
+	/**
+	 * @brief Retrieves whether the ring is mapped.
+	 **/
+	bool GetIsOpen( ) const;
+
+};
+
+#endif
+
+#endif /* !LICD_RING_H_ */
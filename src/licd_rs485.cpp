@@ -0,0 +1,175 @@
+/**
+ * @file licd_rs485.cpp
+ * @brief Implementation of the `LicRs485PosixPort` class.
+ *
+ * Only compiled by POSIX host builds, Arduino builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if !defined( ARDUINO ) && defined( __unix__ )
+
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+/**
+ * ====================
+ * LicRs485PosixPort
+ * ====================
+ */
+
+const char* LicRs485PosixPort::s_path = LICD_RS485_PATH;
+int LicRs485PosixPort::s_file = -1;
+bool LicRs485PosixPort::s_is_owner = false;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Sets the tty opened by `begin`.
+ *
+ * @param path Path of the tty.
+ **/
+void LicRs485PosixPort::setDevice( const char* path ) {
+	s_path = path;
+}
+
+/**
+ * @brief Uses an already opened tty, a pseudo-terminal for instance.
+ *
+ * @param file File descriptor of the tty, closed by `end`.
+ **/
+void LicRs485PosixPort::setFile( const int file ) {
+	s_file = file;
+	s_is_owner = true;
+}
+
+/**
+ * @brief Opens the tty in raw mode.
+ *
+ * Only the usual speeds are known, others fall back to 115200 bauds.
+ *
+ * @param baud_rate Line speed (in bauds).
+ **/
+void LicRs485PosixPort::begin( const uint32_t baud_rate ) {
+	if ( s_file < 0 ) {
+		s_file = open( s_path, O_RDWR | O_NOCTTY );
+		s_is_owner = true;
+	}
+
+	if ( s_file < 0 ) {
+		Serial.print( "[ERR] RS-485 : Unable to open " );
+		Serial.println( s_path );
+
+		return;
+	}
+
+	fcntl( s_file, F_SETFL, fcntl( s_file, F_GETFL ) | O_NONBLOCK );
+
+	struct termios options;
+	speed_t speed = B115200;
+
+	switch ( baud_rate ) {
+		case 9600 : speed = B9600; break;
+		case 19200 : speed = B19200; break;
+		case 38400 : speed = B38400; break;
+		case 57600 : speed = B57600; break;
+		case 230400 : speed = B230400; break;
+		case 460800 : speed = B460800; break;
+		case 500000 : speed = B500000; break;
+		case 921600 : speed = B921600; break;
+		case 1000000 : speed = B1000000; break;
+		case 2000000 : speed = B2000000; break;
+
+		default : break;
+	}
+
+	if ( tcgetattr( s_file, &options ) == 0 ) {
+		cfmakeraw( &options );
+		cfsetispeed( &options, speed );
+		cfsetospeed( &options, speed );
+
+		options.c_cflag |= CLOCAL | CREAD;
+
+		tcsetattr( s_file, TCSANOW, &options );
+	}
+}
+
+/**
+ * @brief Closes the tty.
+ **/
+void LicRs485PosixPort::end( ) {
+	if ( s_file >= 0 && s_is_owner )
+		close( s_file );
+
+	s_file = -1;
+	s_is_owner = false;
+}
+
+/**
+ * @brief Does nothing, the driver enable line is left to the kernel or the transceiver.
+ **/
+void LicRs485PosixPort::setTransmit( const bool is_transmit ) {
+	(void)is_transmit;
+}
+
+/**
+ * @brief Writes bytes to the tty.
+ *
+ * @param data Pointer to the bytes.
+ * @param size Number of bytes.
+ **/
+void LicRs485PosixPort::write( const uint8_t* data, const uint8_t size ) {
+	uint8_t offset = 0;
+
+	while ( s_file >= 0 && offset < size ) {
+		const ssize_t written = ::write( s_file, data + offset, size - offset );
+
+		if ( written > 0 )
+			offset += (uint8_t)written;
+		else if ( written < 0 && errno != EAGAIN && errno != EINTR )
+			return;
+	}
+}
+
+/**
+ * @brief Waits for the written bytes to leave the tty.
+ **/
+void LicRs485PosixPort::flush( ) {
+	if ( s_file >= 0 )
+		tcdrain( s_file );
+}
+
+/**
+ * @brief Gets the number of bytes waiting in the tty.
+ **/
+int LicRs485PosixPort::available( ) {
+	int size = 0;
+
+	if ( s_file < 0 || ioctl( s_file, FIONREAD, &size ) < 0 )
+		return 0;
+
+	return size;
+}
+
+/**
+ * @brief Consumes one byte.
+ *
+ * @return The byte, -1 when none is waiting.
+ **/
+int LicRs485PosixPort::read( ) {
+	uint8_t value = 0;
+
+	if ( s_file < 0 || ::read( s_file, &value, 1 ) != 1 )
+		return -1;
+
+	return value;
+}
+
+#endif
@@ -0,0 +1,655 @@
+/**
+ * @file licd_rs485.h
+ * @brief LICD transport over a half-duplex UART / RS-485 multi-drop line.
+ *
+ * This header defines `LicRs485Transport`, a transport carrying the LICD
+ * protocol over a serial line shared by the master and every slave. Each bus
+ * transaction becomes a frame starting with the address of the slave, so the
+ * `LicDevice` and `LicDeviceManager` logic run unchanged, registration included.
+ *
+ * ## Frame Layout
+ * | Offset | Size   | Content                                        |
+ * |--------|--------|------------------------------------------------|
+ * | 0      | 1      | Slave address                                  |
+ * | 1      | 1      | Frame type (`LICD_RS485_*`)                    |
+ * | 2      | 1      | Payload size                                   |
+ * | 3      | n      | Payload                                        |
+ * | 3 + n  | 2      | CRC-16/CCITT-FALSE of the previous bytes, LE   |
+ *
+ * ## Transactions
+ * - A write (`endTransmission( true )`) is a `WRITE` frame, the slave answers
+ *   an `ACK` frame as soon as the CRC is checked, a missing `ACK` is an address NACK.
+ * - A request is a `QUERY` frame whose payload starts with the requested size,
+ *   followed by the pending write when `endTransmission( false )` was used. The
+ *   slave runs its receive then request handlers and answers a `RESPONSE` frame,
+ *   a command and its answer cost a single turnaround.
+ * - A frame is dropped on a bad CRC or when the line stays silent more than
+ *   `LICD_RS485_GAP` between two of its bytes, the master then times out.
+ * - A slave waits `LICD_RS485_TURNAROUND` before driving the line, leaving the
+ *   master transceiver time to release it.
+ *
+ * ## Ports
+ * The transport is a template over a port moving the bytes:
+ * - `LicRs485SerialPort<Serial1, DE>`: Arduino hardware serial, driver enable on pin `DE` (-1 for none).
+ * - `LicRs485PosixPort`: POSIX tty, pseudo-terminals included (Linux host builds).
+ *
+ * ## Usage Example
+ * ```
+ * // Header selected with LICD_TRANSPORT_HEADER on every node.
+ * typedef LicRs485Transport<LicRs485SerialPort<Serial1, 4>> Rs485Transport;
+ * #define LICD_TRANSPORT Rs485Transport
+ *
+ * // Slaves have no bus interrupt, the sketch polls the line.
+ * void loop( ) {
+ *     Rs485Transport::poll( );
+ * }
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_RS485_H_
+#define LICD_RS485_H_
+
+/**
+ * @brief Line speed (in bauds).
+ **/
+#ifndef LICD_RS485_BAUD
+#define LICD_RS485_BAUD 1000000
+#endif
+
+/**
+ * @brief Time (in milliseconds) the master waits for the answer of a slave.
+ * 
+ * A slave stays busy 30 ms after handling an `ASSIGN`, the timeout must be longer.
+ **/
+#ifndef LICD_RS485_TIMEOUT
+#define LICD_RS485_TIMEOUT 40
+#endif
+
+/**
+ * @brief Silence (in microseconds) between two bytes restarting the frame.
+ * 
+ * Host ttys deliver bytes in bursts, MCU only lines can lower it to a few
+ * character times.
+ **/
+#ifndef LICD_RS485_GAP
+#define LICD_RS485_GAP 5000
+#endif
+
+/**
+ * @brief Delay (in microseconds) before a slave drives the line.
+ **/
+#ifndef LICD_RS485_TURNAROUND
+#define LICD_RS485_TURNAROUND 20
+#endif
+
+/**
+ * @brief Default tty path of POSIX host builds.
+ **/
+#ifndef LICD_RS485_PATH
+#define LICD_RS485_PATH "/dev/ttyUSB0"
+#endif
+
+/**
+ * @brief Frame types.
+ **/
+#define LICD_RS485_WRITE 0x01
+#define LICD_RS485_QUERY 0x02
+#define LICD_RS485_ACK 0x03
+#define LICD_RS485_RESPONSE 0x04
+
+/**
+ * @brief Frame header (address, type, size) and CRC sizes.
+ **/
+#define LICD_RS485_HEADER_SIZE 3
+#define LICD_RS485_CRC_SIZE 2
+
+/**
+ * @brief Largest frame, a query carrying a full write.
+ **/
+#define LICD_RS485_FRAME_SIZE ( LICD_RS485_HEADER_SIZE + 1 + LICD_FRAME_SIZE + LICD_RS485_CRC_SIZE )
+
+#if defined( ARDUINO )
+
+/**
+ * @class LicRs485SerialPort
+ * @brief RS-485 port over an Arduino hardware serial.
+ * @author : ALVES Quentin
+ *
+ * @tparam Port : Hardware serial wired to the transceiver.
+ * @tparam DePin : Driver enable pin of the transceiver, -1 for auto-direction transceivers.
+ **/
+template<HardwareSerial& Port, int DePin>
+class LicRs485SerialPort final {
+
+public:
+	static void begin( const uint32_t baud_rate ) {
+		if ( DePin >= 0 ) {
+			pinMode( DePin, OUTPUT );
+			digitalWrite( DePin, LOW );
+		}
+
+		Port.begin( baud_rate );
+	};
+
+	static void end( ) {
+		Port.end( );
+	};
+
+	static void setTransmit( const bool is_transmit ) {
+		if ( DePin >= 0 )
+			digitalWrite( DePin, is_transmit ? HIGH : LOW );
+	};
+
+	static void write( const uint8_t* data, const uint8_t size ) {
+		Port.write( data, size );
+	};
+
+	/**
+	 * @brief Waits for the last byte to leave the UART, not only its buffer.
+	 **/
+	static void flush( ) {
+		Port.flush( );
+	};
+
+	static int available( ) {
+		return Port.available( );
+	};
+
+	static int read( ) {
+		return Port.read( );
+	};
+
+};
+
+#elif defined( __unix__ )
+
+/**
+ * @class LicRs485PosixPort
+ * @brief RS-485 port over a POSIX tty.
+ * @author : ALVES Quentin
+ *
+ * The driver enable line is left to the kernel (`TIOCSRS485`) or to an
+ * auto-direction transceiver.
+ **/
+class LicRs485PosixPort final {
+
+private:
+	static const char* s_path;
+	static int s_file;
+	static bool s_is_owner;
+
+public:
+	/**
+	 * @brief Sets the tty opened by `begin`.
+	 *
+	 * @param path Path of the tty.
+	 **/
+	static void setDevice( const char* path );
+
+	/**
+	 * @brief Uses an already opened tty, a pseudo-terminal for instance.
+	 *
+	 * @param file File descriptor of the tty, closed by `end`.
+	 **/
+	static void setFile( const int file );
+
+	/**
+	 * @brief Opens the tty in raw mode.
+	 *
+	 * @param baud_rate Line speed (in bauds).
+	 **/
+	static void begin( const uint32_t baud_rate );
+
+	/**
+	 * @brief Closes the tty.
+	 **/
+	static void end( );
+
+	/**
+	 * @brief Does nothing, see the class notes.
+	 **/
+	static void setTransmit( const bool is_transmit );
+
+	/**
+	 * @brief Writes bytes to the tty.
+	 *
+	 * @param data Pointer to the bytes.
+	 * @param size Number of bytes.
+	 **/
+	static void write( const uint8_t* data, const uint8_t size );
+
+	/**
+	 * @brief Waits for the written bytes to leave the tty.
+	 **/
+	static void flush( );
+
+	/**
+	 * @brief Gets the number of bytes waiting in the tty.
+	 **/
+	static int available( );
+
+	/**
+	 * @brief Consumes one byte.
+	 *
+	 * @return The byte, -1 when none is waiting.
+	 **/
+	static int read( );
+
+};
+
+#endif
+
+/**
+ * @class LicRs485Transport
+ * @brief LICD transport over a half-duplex multi-drop serial line.
+ * @author : ALVES Quentin
+ *
+ * @tparam Port : Port moving the bytes (`LicRs485SerialPort`, `LicRs485PosixPort`).
+ **/
+template<typename Port>
+class LicRs485Transport final {
+
+private:
+	static bool s_is_slave;
+	static uint8_t s_address;
+	static void (*s_receive)( int );
+	static void (*s_request)( void );
+	static uint8_t s_tx_address;
+	static uint8_t s_tx_data[ LICD_FRAME_SIZE ];
+	static uint8_t s_tx_size;
+	static bool s_is_overflow;
+	static bool s_is_pending;
+	static uint8_t s_rx_data[ LICD_FRAME_SIZE ];
+	static uint8_t s_rx_size;
+	static uint8_t s_rx_offset;
+	static uint8_t s_frame[ LICD_RS485_FRAME_SIZE ];
+	static uint8_t s_frame_size;
+	static uint32_t s_frame_time;
+
+public:
+	/**
+	 * @brief Opens the line as master.
+	 **/
+	static void begin( ) {
+		Port::begin( LICD_RS485_BAUD );
+		Port::setTransmit( false );
+
+		s_is_slave = false;
+	};
+
+	/**
+	 * @brief Opens the line as slave, or changes the slave address.
+	 *
+	 * @param address Address answered by the slave.
+	 **/
+	static void begin( const uint8_t address ) {
+		if ( !s_is_slave ) {
+			Port::begin( LICD_RS485_BAUD );
+			Port::setTransmit( false );
+		}
+
+		s_is_slave = true;
+		s_address = address;
+	};
+
+	/**
+	 * @brief Closes the line.
+	 **/
+	static void end( ) {
+		Port::end( );
+
+		s_is_pending = false;
+		s_frame_size = 0;
+	};
+
+	/**
+	 * @brief Does nothing, the line speed is `LICD_RS485_BAUD`.
+	 **/
+	static void setClock( const uint32_t clock ) {
+		(void)clock;
+	};
+
+	/**
+	 * @brief Does nothing, answers are awaited `LICD_RS485_TIMEOUT`.
+	 **/
+	static void setTimeout( const uint32_t timeout ) {
+		(void)timeout;
+	};
+
+	/**
+	 * @brief Always false, a missing answer is reported as a NACK.
+	 **/
+	static bool getTimeoutFlag( ) {
+		return false;
+	};
+
+	/**
+	 * @brief Always true, a frame never holds the line past its last byte.
+	 **/
+	static bool isIdle( ) {
+		return true;
+	};
+
+	/**
+	 * @brief Drops a partially received frame.
+	 **/
+	static bool recover( ) {
+		s_frame_size = 0;
+
+		return true;
+	};
+
+	/**
+	 * @brief Starts a write to a slave, sending the pending write first.
+	 *
+	 * @param address Address of the slave.
+	 **/
+	static void beginTransmission( const uint8_t address ) {
+		if ( s_is_pending )
+			sendWrite( );
+
+		s_tx_address = address;
+		s_tx_size = 0;
+		s_is_overflow = false;
+	};
+
+	/**
+	 * @brief Queues one byte of the current write, or of the current answer on a slave.
+	 *
+	 * @param value Byte to write.
+	 * @return The number of bytes queued, 0 when the write exceeds `LICD_FRAME_SIZE`.
+	 **/
+	static size_t write( const uint8_t value ) {
+		if ( s_tx_size == LICD_FRAME_SIZE ) {
+			s_is_overflow = true;
+
+			return 0;
+		}
+
+		s_tx_data[ s_tx_size++ ] = value;
+
+		return 1;
+	};
+
+	/**
+	 * @brief Sends the current write, or keeps it for the next request.
+	 *
+	 * @param send_stop Whether the write is sent now, it travels in the next `QUERY` otherwise.
+	 * @return A `Wire.endTransmission` like status, 0 on success.
+	 **/
+	static uint8_t endTransmission( const bool send_stop ) {
+		if ( s_is_overflow ) {
+			s_tx_size = 0;
+
+			return 1;
+		}
+
+		s_is_pending = true;
+
+		return send_stop ? sendWrite( ) : 0;
+	};
+
+	/**
+	 * @brief Reads bytes from a slave with a `QUERY` frame.
+	 *
+	 * @param address Address of the slave.
+	 * @param size Number of bytes to read.
+	 * @return The number of bytes received.
+	 **/
+	static uint8_t requestFrom( const uint8_t address, const uint8_t size ) {
+		uint8_t payload[ 1 + LICD_FRAME_SIZE ];
+		uint8_t payload_size = 1;
+
+		if ( s_is_pending && s_tx_address != address )
+			sendWrite( );
+
+		payload[ 0 ] = ( size < LICD_FRAME_SIZE ) ? size : LICD_FRAME_SIZE;
+
+		if ( s_is_pending ) {
+			memcpy( payload + 1, s_tx_data, s_tx_size );
+
+			payload_size += s_tx_size;
+			s_is_pending = false;
+		}
+
+		s_rx_size = 0;
+		s_rx_offset = 0;
+
+		sendFrame( address, LICD_RS485_QUERY, payload, payload_size );
+
+		if ( waitFrame( address, LICD_RS485_RESPONSE ) )
+			loadReceive( s_frame + LICD_RS485_HEADER_SIZE, s_frame[ 2 ] );
+
+		return s_rx_size;
+	};
+
+	/**
+	 * @brief Gets the number of received bytes left.
+	 **/
+	static int available( ) {
+		return s_rx_size - s_rx_offset;
+	};
+
+	/**
+	 * @brief Consumes one received byte.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int read( ) {
+		if ( s_rx_offset == s_rx_size )
+			return -1;
+
+		return s_rx_data[ s_rx_offset++ ];
+	};
+
+	/**
+	 * @brief Gets the next received byte without consuming it.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int peek( ) {
+		if ( s_rx_offset == s_rx_size )
+			return -1;
+
+		return s_rx_data[ s_rx_offset ];
+	};
+
+	/**
+	 * @brief Registers the slave receive callback, called by `poll`.
+	 **/
+	static void onReceive( void (*handler)( int ) ) {
+		s_receive = handler;
+	};
+
+	/**
+	 * @brief Registers the slave request callback, called by `poll`.
+	 **/
+	static void onRequest( void (*handler)( void ) ) {
+		s_request = handler;
+	};
+
+	/**
+	 * @brief Processes the frames received by a slave.
+	 *
+	 * A serial line raises no bus interrupt, a slave calls it from its loop as
+	 * often as possible, every frame addressed to it is answered from here.
+	 **/
+	static void poll( ) {
+		while ( s_is_slave && Port::available( ) > 0 ) {
+			if ( !pushByte( (uint8_t)Port::read( ) ) || s_frame[ 0 ] != s_address )
+				continue;
+
+			const uint8_t address = s_frame[ 0 ];
+			const uint8_t type = s_frame[ 1 ];
+			const uint8_t size = s_frame[ 2 ];
+			const uint8_t* payload = s_frame + LICD_RS485_HEADER_SIZE;
+
+			if ( type == LICD_RS485_WRITE ) {
+				sendFrame( address, LICD_RS485_ACK, nullptr, 0 );
+				dispatchReceive( payload, size );
+			} else if ( type == LICD_RS485_QUERY && size > 0 ) {
+				const uint8_t request_size = payload[ 0 ];
+
+				dispatchReceive( payload + 1, size - 1 );
+
+				s_tx_size = 0;
+
+				if ( s_request != nullptr )
+					s_request( );
+
+				sendFrame( address, LICD_RS485_RESPONSE, s_tx_data, ( s_tx_size < request_size ) ? s_tx_size : request_size );
+			}
+		}
+	};
+
+private:
+	/**
+	 * @brief Sends the pending write in a `WRITE` frame and waits for its `ACK`.
+	 *
+	 * @return 0 on success, 2 when the slave did not acknowledge.
+	 **/
+	static uint8_t sendWrite( ) {
+		s_is_pending = false;
+
+		sendFrame( s_tx_address, LICD_RS485_WRITE, s_tx_data, s_tx_size );
+
+		return waitFrame( s_tx_address, LICD_RS485_ACK ) ? 0 : 2;
+	};
+
+	/**
+	 * @brief Sends a frame, driving the line only while it is transmitted.
+	 *
+	 * @param address Slave address.
+	 * @param type Frame type.
+	 * @param payload Pointer to the payload.
+	 * @param size Payload size.
+	 **/
+	static void sendFrame( const uint8_t address, const uint8_t type, const uint8_t* payload, const uint8_t size ) {
+		uint8_t frame[ LICD_RS485_FRAME_SIZE ];
+
+		frame[ 0 ] = address;
+		frame[ 1 ] = type;
+		frame[ 2 ] = size;
+
+		if ( size > 0 )
+			memcpy( frame + LICD_RS485_HEADER_SIZE, payload, size );
+
+		const uint16_t crc = LicCRC::crc16( frame, LICD_RS485_HEADER_SIZE + size );
+
+		frame[ LICD_RS485_HEADER_SIZE + size ] = (uint8_t)crc;
+		frame[ LICD_RS485_HEADER_SIZE + size + 1 ] = (uint8_t)( crc >> 8 );
+
+		if ( s_is_slave )
+			delayMicroseconds( LICD_RS485_TURNAROUND );
+
+		Port::setTransmit( true );
+		Port::write( frame, LICD_RS485_HEADER_SIZE + size + LICD_RS485_CRC_SIZE );
+		Port::flush( );
+		Port::setTransmit( false );
+	};
+
+	/**
+	 * @brief Waits for a frame from a slave.
+	 *
+	 * @param address Slave address.
+	 * @param type Expected frame type.
+	 * @return true if the frame arrived before `LICD_RS485_TIMEOUT`; false otherwise.
+	 **/
+	static bool waitFrame( const uint8_t address, const uint8_t type ) {
+		const uint64_t deadline = LicClock::now( ) + (uint64_t)LICD_RS485_TIMEOUT * 1000;
+
+		s_frame_size = 0;
+
+		for ( ; ; ) {
+			if ( Port::available( ) <= 0 ) {
+				if ( !LicYield::run( deadline ) )
+					return false;
+
+				continue;
+			}
+
+			if ( pushByte( (uint8_t)Port::read( ) ) && s_frame[ 0 ] == address && s_frame[ 1 ] == type )
+				return true;
+		}
+	};
+
+	/**
+	 * @brief Appends a received byte to the current frame.
+	 *
+	 * The frame restarts when the line was silent more than `LICD_RS485_GAP`.
+	 *
+	 * @param value Received byte.
+	 * @return true when the byte completes a frame with a valid CRC; false otherwise.
+	 **/
+	static bool pushByte( const uint8_t value ) {
+		const uint32_t now = micros( );
+
+		if ( s_frame_size > 0 && now - s_frame_time > LICD_RS485_GAP )
+			s_frame_size = 0;
+
+		s_frame_time = now;
+		s_frame[ s_frame_size++ ] = value;
+
+		if ( s_frame_size == LICD_RS485_HEADER_SIZE && s_frame[ 2 ] > 1 + LICD_FRAME_SIZE ) {
+			s_frame_size = 0;
+
+			return false;
+		}
+
+		if ( s_frame_size < LICD_RS485_HEADER_SIZE || s_frame_size < LICD_RS485_HEADER_SIZE + s_frame[ 2 ] + LICD_RS485_CRC_SIZE )
+			return false;
+
+		const uint8_t data_size = s_frame_size - LICD_RS485_CRC_SIZE;
+		const uint16_t crc = (uint16_t)s_frame[ data_size ] | ( (uint16_t)s_frame[ data_size + 1 ] << 8 );
+
+		s_frame_size = 0;
+
+		return LicCRC::crc16( s_frame, data_size ) == crc;
+	};
+
+	/**
+	 * @brief Copies bytes to the receive buffer read by `read`.
+	 **/
+	static void loadReceive( const uint8_t* data, const uint8_t size ) {
+		s_rx_size = ( size < LICD_FRAME_SIZE ) ? size : LICD_FRAME_SIZE;
+		s_rx_offset = 0;
+
+		memcpy( s_rx_data, data, s_rx_size );
+	};
+
+	/**
+	 * @brief Hands a received write to the slave receive callback.
+	 **/
+	static void dispatchReceive( const uint8_t* data, const uint8_t size ) {
+		if ( size == 0 )
+			return;
+
+		loadReceive( data, size );
+
+		if ( s_receive != nullptr )
+			s_receive( size );
+	};
+
+};
+
+template<typename Port> bool LicRs485Transport<Port>::s_is_slave = false;
+template<typename Port> uint8_t LicRs485Transport<Port>::s_address = 0;
+template<typename Port> void (*LicRs485Transport<Port>::s_receive)( int ) = nullptr;
+template<typename Port> void (*LicRs485Transport<Port>::s_request)( void ) = nullptr;
+template<typename Port> uint8_t LicRs485Transport<Port>::s_tx_address = 0;
+template<typename Port> uint8_t LicRs485Transport<Port>::s_tx_data[ LICD_FRAME_SIZE ] = { };
+template<typename Port> uint8_t LicRs485Transport<Port>::s_tx_size = 0;
+template<typename Port> bool LicRs485Transport<Port>::s_is_overflow = false;
+template<typename Port> bool LicRs485Transport<Port>::s_is_pending = false;
+template<typename Port> uint8_t LicRs485Transport<Port>::s_rx_data[ LICD_FRAME_SIZE ] = { };
+template<typename Port> uint8_t LicRs485Transport<Port>::s_rx_size = 0;
+template<typename Port> uint8_t LicRs485Transport<Port>::s_rx_offset = 0;
+template<typename Port> uint8_t LicRs485Transport<Port>::s_frame[ LICD_RS485_FRAME_SIZE ] = { };
+template<typename Port> uint8_t LicRs485Transport<Port>::s_frame_size = 0;
+template<typename Port> uint32_t LicRs485Transport<Port>::s_frame_time = 0;
+
+#endif /* !LICD_RS485_H_ */
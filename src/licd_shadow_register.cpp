@@ -0,0 +1,148 @@
+/**
+ * @file licd_shadow_register.cpp
+ * @brief Implementation of master-side shadow registers.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicShadowRegister
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an unbound `LicShadowRegister`.
+ **/
+LicShadowRegister::LicShadowRegister( )
+	: m_address{ 0 },
+	m_dirty{ },
+	m_data{ }
+{ }
+
+/**
+ * @brief Destructor for `LicShadowRegister`.
+ **/
+LicShadowRegister::~LicShadowRegister( ) { }
+
+/**
+ * @brief Binds the shadow to a device, dropping previous content.
+ *
+ * @param address I2C address of the device, 0 unbinds the shadow.
+ **/
+void LicShadowRegister::Bind( const uint8_t address ) {
+	m_address = address;
+
+	memset( m_data, 0, LICD_SHADOW_SIZE );
+	Clean( );
+}
+
+/**
+ * @brief Copies data into the shadow and marks its bytes dirty.
+ *
+ * @param offset Register offset of the first byte.
+ * @param data Pointer to the data.
+ * @param size Size of the data in bytes.
+ * @return true if the range fits in the shadow; false otherwise.
+ **/
+bool LicShadowRegister::Stage( const uint8_t offset, const uint8_t* data, const uint8_t size ) {
+	if ( size == 0 || (uint16_t)offset + size > LICD_SHADOW_SIZE )
+		return false;
+
+	memcpy( m_data + offset, data, size );
+
+	for ( uint16_t byte_id = offset; byte_id < offset + size; byte_id++ )
+		m_dirty[ byte_id / 8 ] |= (uint8_t)( 1 << ( byte_id % 8 ) );
+
+	return true;
+}
+
+/**
+ * @brief Marks the whole shadow as clean.
+ **/
+void LicShadowRegister::Clean( ) {
+	memset( m_dirty, 0, sizeof( m_dirty ) );
+}
+
+/**
+ * @brief Marks a range as clean, once it reached the device.
+ *
+ * Also drops staged bytes overwritten by a direct write, so a later flush does
+ * not send them back over the newer value.
+ *
+ * @param offset Register offset of the first byte.
+ * @param size Size of the range in bytes, clamped to the shadow.
+ **/
+void LicShadowRegister::Clean( const uint8_t offset, const uint32_t size ) {
+	const uint32_t end = ( (uint32_t)offset + size < LICD_SHADOW_SIZE ) ? offset + size : LICD_SHADOW_SIZE;
+
+	for ( uint32_t byte_id = offset; byte_id < end; byte_id++ )
+		m_dirty[ byte_id / 8 ] &= (uint8_t)~( 1 << ( byte_id % 8 ) );
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the address of the bound device.
+ *
+ * @return The device address, 0 when unbound.
+ **/
+uint8_t LicShadowRegister::GetAddress( ) const {
+	return m_address;
+}
+
+/**
+ * @brief Checks if staged data is waiting for a flush.
+ *
+ * @return true if a byte is dirty; false otherwise.
+ **/
+bool LicShadowRegister::GetIsDirty( ) const {
+	for ( uint8_t mask_id = 0; mask_id < sizeof( m_dirty ); mask_id++ ) {
+		if ( m_dirty[ mask_id ] != 0 )
+			return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Retrieves the first contiguous run of dirty bytes.
+ *
+ * @param offset Register offset of the first byte of the run.
+ * @param size Size of the run in bytes.
+ * @return true if a byte is dirty; false otherwise.
+ **/
+bool LicShadowRegister::GetDirtyRun( uint8_t& offset, uint8_t& size ) const {
+	uint16_t byte_id = 0;
+
+	while ( byte_id < LICD_SHADOW_SIZE && ( m_dirty[ byte_id / 8 ] & ( 1 << ( byte_id % 8 ) ) ) == 0 )
+		byte_id += 1;
+
+	if ( byte_id == LICD_SHADOW_SIZE )
+		return false;
+
+	offset = (uint8_t)byte_id;
+
+	while ( byte_id < LICD_SHADOW_SIZE && ( m_dirty[ byte_id / 8 ] & ( 1 << ( byte_id % 8 ) ) ) != 0 )
+		byte_id += 1;
+
+	size = (uint8_t)( byte_id - offset );
+
+	return true;
+}
+
+/**
+ * @brief Retrieves the shadow content at a register offset.
+ *
+ * @param offset Register offset.
+ * @return Pointer to the shadow content.
+ **/
+const uint8_t* LicShadowRegister::GetData( const uint8_t offset ) const {
+	return m_data + offset;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file licd_shadow_register.h
+ * @brief Provides master-side shadow copies of slave writable registers.
+ *
+ * This header defines the `LicShadowRegister` class, a master-side copy of the
+ * register block a slave exposes with `LicDevice::SetRegisters`. Application
+ * writes only update the shadow and mark their bytes dirty, each contiguous run
+ * of dirty bytes is then sent as one `LICD_COMMAND_REGISTER` write at flush time.
+ *
+ * ## Notes
+ * - Only staged bytes are sent: bytes between two staged writes keep the value
+ *   of the slave, the shadow never holds a copy of them.
+ * - A shadow covers the first `LICD_SHADOW_SIZE` bytes of a slave register block.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_SHADOW_REGISTER_H_
+#define LICD_SHADOW_REGISTER_H_
+
+/**
+ * @class LicShadowRegister
+ * @brief Shadow copy of a slave register block with per-byte dirty tracking.
+ * @author : ALVES Quentin
+ **/
+class LicShadowRegister final {
+
+private:
+	uint8_t m_address;
+	uint8_t m_dirty[ ( LICD_SHADOW_SIZE + 7 ) / 8 ];
+	uint8_t m_data[ LICD_SHADOW_SIZE ];
+
+public:
+	/**
+	 * @brief Constructor to initialize an unbound shadow.
+	 **/
+	LicShadowRegister( );
+
+	/**
+	 * @brief Destructor for the shadow.
+	 **/
+	~LicShadowRegister( );
+
+	/**
+	 * @brief Binds the shadow to a device, dropping previous content.
+	 * 
+	 * @param address I2C address of the device, 0 unbinds the shadow.
+	 **/
+	void Bind( const uint8_t address );
+
+	/**
+	 * @brief Copies data into the shadow and marks its bytes dirty.
+	 * 
+	 * @param offset Register offset of the first byte.
+	 * @param data Pointer to the data.
+	 * @param size Size of the data in bytes.
+	 * @return true if the range fits in the shadow; false otherwise.
+	 **/
+	bool Stage( const uint8_t offset, const uint8_t* data, const uint8_t size );
+
+	/**
+	 * @brief Marks the whole shadow as clean.
+	 **/
+	void Clean( );
+
+	/**
+	 * @brief Marks a range as clean, once it reached the device.
+	 * 
+	 * @param offset Register offset of the first byte.
+	 * @param size Size of the range in bytes, clamped to the shadow.
+	 **/
+	void Clean( const uint8_t offset, const uint32_t size );
+
+public:
+	/**
+	 * @brief Retrieves the address of the bound device.
+	 * 
+	 * @return The device address, 0 when unbound.
+	 **/
+	uint8_t GetAddress( ) const;
+
+	/**
+	 * @brief Checks if staged data is waiting for a flush.
+	 * 
+	 * @return true if a byte is dirty; false otherwise.
+	 **/
+	bool GetIsDirty( ) const;
+
+	/**
+	 * @brief Retrieves the first contiguous run of dirty bytes.
+	 * 
+	 * @param offset Register offset of the first byte of the run.
+	 * @param size Size of the run in bytes.
+	 * @return true if a byte is dirty; false otherwise.
+	 **/
+	bool GetDirtyRun( uint8_t& offset, uint8_t& size ) const;
+
+	/**
+	 * @brief Retrieves the shadow content at a register offset.
+	 * 
+	 * @param offset Register offset.
+	 * @return Pointer to the shadow content.
+	 **/
+	const uint8_t* GetData( const uint8_t offset ) const;
+
+};
+
+#endif /* !LICD_SHADOW_REGISTER_H_ */
@@ -0,0 +1,490 @@
+/**
+ * @file licd_sim.cpp
+ * @brief Implementation of the simulated LICD bus.
+ *
+ * Only compiled by Linux host builds, Arduino builds skip this file.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( __linux__ ) && !defined( ARDUINO )
+
+#include <errno.h>
+
+/**
+ * ====================
+ * LicSimDevice
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs a `LicSimDevice` waiting on the listener address.
+ *
+ * @param uuid UUID of the device.
+ * @param flags Capability flags of the device.
+ **/
+LicSimDevice::LicSimDevice( const uint32_t uuid, const uint32_t flags )
+	: m_address{ LICD_LISTENER_ADDRESS },
+	m_header{ },
+	m_command{ 0 },
+	m_receive{ nullptr },
+	m_request{ nullptr },
+	m_context{ nullptr },
+	m_counter{ 0 },
+	m_registers{ }
+{
+	m_header.uuid = uuid;
+	m_header.flags = flags;
+}
+
+/**
+ * @brief Destructor for `LicSimDevice`, removes it from the bus.
+ **/
+LicSimDevice::~LicSimDevice( ) {
+	LicSimBus::detach( this );
+}
+
+/**
+ * @brief Sets the handlers of the user commands.
+ *
+ * @param receive_handler Called on user command writes, may be nullptr.
+ * @param request_handler Called on reads, may be nullptr.
+ * @param context User pointer, retrieved by the handlers with `GetContext`.
+ **/
+void LicSimDevice::SetHandlers(
+	LicSimReceive receive_handler,
+	LicSimRequest request_handler,
+	void* context
+) {
+	m_receive = receive_handler;
+	m_request = request_handler;
+	m_context = context;
+}
+
+/**
+ * @brief Drops the assigned address, as a slave reset would.
+ **/
+void LicSimDevice::Reset( ) {
+	m_address = LICD_LISTENER_ADDRESS;
+	m_command = 0;
+}
+
+/**
+ * @brief Handles a write of the master.
+ *
+ * Empty writes are address pings and leave the last command untouched. A
+ * device advertising `LICD_CAPABILITY_CRC` drops register writes failing their
+ * CRC-16, as `LicDevice` does.
+ *
+ * @param data Pointer to the written bytes.
+ * @param size Number of bytes.
+ **/
+void LicSimDevice::Receive( const uint8_t* data, const uint8_t size ) {
+	if ( size == 0 )
+		return;
+
+	const uint8_t command = data[ 0 ];
+
+	m_command = command;
+
+	if ( m_address == LICD_LISTENER_ADDRESS ) {
+		if ( command == LICD_COMMAND_ASSIGN && size > 1 )
+			m_address = data[ 1 ];
+
+		if ( command != LICD_COMMAND_UUID )
+			m_command = 0;
+
+		return;
+	}
+
+	if ( command == LICD_COMMAND_REGISTER && size > 1 ) {
+		uint8_t data_size = size;
+
+		if ( LicCapabilities::has( m_header.flags, LICD_CAPABILITY_CRC ) ) {
+			data_size = ( size >= 4 ) ? size - 2 : 2;
+
+			if ( size < 4 || ( data[ data_size ] | ( data[ data_size + 1 ] << 8 ) ) != LicCRC::crc16( data + 1, data_size - 1 ) )
+				data_size = 2;
+		}
+
+		for ( uint8_t offset = data[ 1 ], byte_id = 2; byte_id < data_size && offset < LICD_SIM_REGISTER_SIZE; byte_id++ )
+			m_registers[ offset++ ] = data[ byte_id ];
+
+		m_command = 0;
+
+		return;
+	}
+
+	if ( m_receive != nullptr )
+		m_receive( *this, data, size );
+}
+
+/**
+ * @brief Handles a read of the master.
+ *
+ * @param data Pointer to the answer buffer.
+ * @param size Number of bytes read.
+ **/
+void LicSimDevice::Request( uint8_t* data, const uint8_t size ) {
+	memset( data, 0, size );
+
+	if ( m_command == LICD_COMMAND_UUID ) {
+		memcpy( data, &m_header, ( size < sizeof( LicDeviceHeader ) ) ? size : sizeof( LicDeviceHeader ) );
+
+		return;
+	}
+
+	if ( m_request != nullptr ) {
+		m_request( *this, m_command, data, size );
+
+		return;
+	}
+
+	m_counter += 1;
+
+	memcpy( data, &m_counter, ( size < sizeof( uint32_t ) ) ? size : sizeof( uint32_t ) );
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the current address of the device.
+ *
+ * @return The address, `LICD_LISTENER_ADDRESS` until assigned.
+ **/
+LicDeviceAddress LicSimDevice::GetAddress( ) const {
+	return m_address;
+}
+
+/**
+ * @brief Retrieves the header of the device.
+ *
+ * @return Reference to the header.
+ **/
+const LicDeviceHeader& LicSimDevice::GetHeader( ) const {
+	return m_header;
+}
+
+/**
+ * @brief Retrieves the register block written by the master.
+ *
+ * @return Pointer to `LICD_SIM_REGISTER_SIZE` bytes.
+ **/
+const uint8_t* LicSimDevice::GetRegisters( ) const {
+	return m_registers;
+}
+
+/**
+ * @brief Retrieves the user pointer given to `SetHandlers`.
+ *
+ * @return The user pointer.
+ **/
+void* LicSimDevice::GetContext( ) const {
+	return m_context;
+}
+
+/**
+ * ====================
+ * LicSimBus
+ * ====================
+ */
+
+LicSimDevice* LicSimBus::s_devices[ LICD_SIM_DEVICE_COUNT ] = { };
+uint8_t LicSimBus::s_device_count = 0;
+uint32_t LicSimBus::s_clock = LICD_DEFAULT_CLOCK;
+LicSimStats LicSimBus::s_stats = LicSimStats( );
+LicSimFaultConfig LicSimBus::s_faults = LicSimFaultConfig( );
+uint32_t LicSimBus::s_fault_state = 1;
+const LicSimFaultEvent* LicSimBus::s_script = nullptr;
+uint32_t LicSimBus::s_script_size = 0;
+uint32_t LicSimBus::s_script_offset = 0;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Plugs the simulated bus in `LicI2cDevTransport`.
+ **/
+void LicSimBus::install( ) {
+	LicI2cDevTransport::setHandler( handle );
+}
+
+/**
+ * @brief Adds a device to the bus.
+ *
+ * @param device Pointer to the device, owned by the caller.
+ * @return true if the device was added; false when the bus is full.
+ **/
+bool LicSimBus::attach( LicSimDevice* device ) {
+	if ( device == nullptr || s_device_count == LICD_SIM_DEVICE_COUNT )
+		return false;
+
+	s_devices[ s_device_count++ ] = device;
+
+	return true;
+}
+
+/**
+ * @brief Removes a device from the bus.
+ *
+ * @param device Pointer to the device.
+ **/
+void LicSimBus::detach( LicSimDevice* device ) {
+	for ( uint8_t device_id = 0; device_id < s_device_count; device_id++ ) {
+		if ( s_devices[ device_id ] != device )
+			continue;
+
+		s_device_count -= 1;
+
+		memmove( s_devices + device_id, s_devices + device_id + 1, ( s_device_count - device_id ) * sizeof( LicSimDevice* ) );
+
+		return;
+	}
+}
+
+/**
+ * @brief Sets the clock used to model the wire time.
+ *
+ * @param clock SCL frequency in Hz.
+ **/
+void LicSimBus::setClock( const uint32_t clock ) {
+	if ( clock > 0 )
+		s_clock = clock;
+}
+
+/**
+ * @brief Sets the random faults injected in the messages.
+ *
+ * @param config Fault rates and timings, the random generator restarts from its seed.
+ **/
+void LicSimBus::setFaults( const LicSimFaultConfig& config ) {
+	s_faults = config;
+	s_fault_state = ( config.seed != 0 ) ? config.seed : 1;
+}
+
+/**
+ * @brief Sets the scripted faults injected in the messages.
+ *
+ * Faults scheduled before the current message index are skipped.
+ *
+ * @param events Faults sorted by message index, owned by the caller, may be nullptr.
+ * @param count Number of faults.
+ **/
+void LicSimBus::setScript( const LicSimFaultEvent* events, const uint32_t count ) {
+	s_script = events;
+	s_script_size = ( events != nullptr ) ? count : 0;
+	s_script_offset = 0;
+}
+
+/**
+ * @brief Stops every random and scripted fault.
+ **/
+void LicSimBus::clearFaults( ) {
+	setFaults( LicSimFaultConfig( ) );
+	setScript( nullptr, 0 );
+}
+
+/**
+ * @brief Clears the traffic counters.
+ *
+ * Message indexes of the fault script count from 0 again.
+ **/
+void LicSimBus::resetStats( ) {
+	s_stats = LicSimStats( );
+	s_script_offset = 0;
+}
+
+/**
+ * @brief Executes an `I2C_RDWR` transaction on the simulated devices.
+ *
+ * Messages run in order, the transaction stops on the first address without
+ * device, as the kernel stops on the first NACK. Injected faults end the
+ * transaction the same way, with the error the adapter would report.
+ *
+ * @param transaction Transaction sent by `LicI2cDevTransport`.
+ * @return 0 on success, `ENXIO` when no device owns an address, `EREMOTEIO`
+ *         on a data NACK, `ETIMEDOUT` when SDA is stuck.
+ **/
+int LicSimBus::handle( struct i2c_rdwr_ioctl_data* transaction ) {
+	s_stats.transactions += 1;
+
+	for ( uint32_t message_id = 0; message_id < transaction->nmsgs; message_id++ ) {
+		struct i2c_msg& message = transaction->msgs[ message_id ];
+		const LicSimFaultKind fault = nextFault( message );
+		const bool is_read = ( message.flags & I2C_M_RD ) != 0;
+		LicSimDevice* device = find( (uint8_t)message.addr );
+		uint32_t size = message.len;
+
+		s_stats.messages += 1;
+
+		if ( fault < LICD_SIM_FAULT_COUNT )
+			s_stats.faults[ fault ] += 1;
+
+		if ( fault == LICD_SIM_FAULT_RESET && device != nullptr )
+			device->Reset( );
+
+		if ( fault == LICD_SIM_FAULT_ADDRESS_NACK || fault == LICD_SIM_FAULT_RESET )
+			device = nullptr;
+
+		if ( device == nullptr ) {
+			s_stats.nacks += 1;
+			s_stats.wire_time += wireTime( 0, s_clock );
+
+			licd_host_advance( wireTime( 0, s_clock ) );
+
+			return ENXIO;
+		}
+
+		if ( fault == LICD_SIM_FAULT_STUCK ) {
+			licd_host_sleep( s_faults.stuck_time );
+
+			return ETIMEDOUT;
+		}
+
+		if ( fault == LICD_SIM_FAULT_DATA_NACK )
+			size = random( message.len );
+
+		if ( is_read ) {
+			device->Request( message.buf, (uint8_t)size );
+
+			if ( fault == LICD_SIM_FAULT_TRUNCATE ) {
+				const uint32_t offset = random( size );
+
+				memset( message.buf + offset, 0xFF, size - offset );
+			}
+		} else if ( fault == LICD_SIM_FAULT_BIT_FLIP ) {
+			uint8_t data[ UINT8_MAX ];
+
+			memcpy( data, message.buf, size );
+
+			data[ random( size ) ] ^= (uint8_t)( 1 << random( 8 ) );
+
+			device->Receive( data, (uint8_t)size );
+		} else
+			device->Receive( message.buf, (uint8_t)size );
+
+		if ( is_read && fault == LICD_SIM_FAULT_BIT_FLIP )
+			message.buf[ random( size ) ] ^= (uint8_t)( 1 << random( 8 ) );
+
+		if ( fault == LICD_SIM_FAULT_STRETCH )
+			licd_host_sleep( s_faults.stretch_time );
+
+		s_stats.bytes += size;
+		s_stats.wire_time += wireTime( size, s_clock );
+
+		licd_host_advance( wireTime( size, s_clock ) );
+
+		if ( fault == LICD_SIM_FAULT_DATA_NACK ) {
+			s_stats.nacks += 1;
+
+			return EREMOTEIO;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Computes the wire time of a message.
+ *
+ * @param size Number of data bytes.
+ * @param clock SCL frequency in Hz.
+ * @return The wire time (in nanoseconds).
+ **/
+uint64_t LicSimBus::wireTime( const uint32_t size, const uint32_t clock ) {
+	const uint64_t bit_count = 9 * ( (uint64_t)size + 1 ) + 2;
+
+	return ( bit_count * 1000000000 ) / clock;
+}
+
+/**
+ * @brief Finds the device answering an address.
+ *
+ * @param address Address of the message.
+ * @return Pointer to the device, nullptr when none answers.
+ **/
+LicSimDevice* LicSimBus::find( const uint8_t address ) {
+	for ( uint8_t device_id = 0; device_id < s_device_count; device_id++ ) {
+		if ( s_devices[ device_id ]->GetAddress( ) == address )
+			return s_devices[ device_id ];
+	}
+
+	return nullptr;
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Picks the fault injected in the next message.
+ *
+ * A scripted fault wins over the random ones, which are drawn in kind order.
+ * Faults that do not apply to the message are dropped.
+ *
+ * @param message Message about to be executed.
+ * @return The fault, `LICD_SIM_FAULT_COUNT` when none.
+ **/
+LicSimFaultKind LicSimBus::nextFault( const struct i2c_msg& message ) {
+	const bool is_read = ( message.flags & I2C_M_RD ) != 0;
+	LicSimFaultKind fault = LICD_SIM_FAULT_COUNT;
+
+	while ( s_script_offset < s_script_size && s_script[ s_script_offset ].message < s_stats.messages )
+		s_script_offset += 1;
+
+	if ( s_script_offset < s_script_size && s_script[ s_script_offset ].message == s_stats.messages )
+		fault = s_script[ s_script_offset++ ].kind;
+	else if ( s_faults.address == LICD_SIM_FAULT_ANY || s_faults.address == message.addr ) {
+		for ( uint8_t kind = 0; kind < LICD_SIM_FAULT_COUNT && fault == LICD_SIM_FAULT_COUNT; kind++ ) {
+			if ( s_faults.rates[ kind ] > 0.f && random( 1000000 ) < s_faults.rates[ kind ] * 1000000.f )
+				fault = (LicSimFaultKind)kind;
+		}
+	}
+
+	switch ( fault ) {
+		case LICD_SIM_FAULT_DATA_NACK : return ( !is_read && message.len > 0 ) ? fault : LICD_SIM_FAULT_COUNT;
+		case LICD_SIM_FAULT_BIT_FLIP : return ( message.len > 0 ) ? fault : LICD_SIM_FAULT_COUNT;
+		case LICD_SIM_FAULT_TRUNCATE : return ( is_read && message.len > 0 ) ? fault : LICD_SIM_FAULT_COUNT;
+
+		default : break;
+	}
+
+	return fault;
+}
+
+/**
+ * @brief Draws a number from the fault random generator.
+ *
+ * The generator is a 32-bit xorshift, seeded by `setFaults`.
+ *
+ * @param range Number of values drawn from.
+ * @return A number in [0, range[, 0 when range is 0.
+ **/
+uint32_t LicSimBus::random( const uint32_t range ) {
+	s_fault_state ^= s_fault_state << 13;
+	s_fault_state ^= s_fault_state >> 17;
+	s_fault_state ^= s_fault_state << 5;
+
+	return ( range > 0 ) ? s_fault_state % range : 0;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the clock used to model the wire time.
+ **/
+uint32_t LicSimBus::getClock( ) {
+	return s_clock;
+}
+
+/**
+ * @brief Retrieves the traffic counters.
+ **/
+const LicSimStats& LicSimBus::getStats( ) {
+	return s_stats;
+}
+
+#endif
@@ -0,0 +1,378 @@
+/**
+ * @file licd_sim.h
+ * @brief Simulated LICD bus for host builds.
+ *
+ * This header defines `LicSimDevice`, a model of a LICD slave, and `LicSimBus`,
+ * a bus of simulated devices plugged in `LicI2cDevTransport` as its transaction
+ * handler. The real `LicDeviceManager` then registers and reads the simulated
+ * devices as it would on `/dev/i2c-N`, without any hardware.
+ *
+ * ## Simulated Device
+ * - A device starts on `LICD_LISTENER_ADDRESS`, answers `UUID` with its header
+ *   and moves to the address sent with `ASSIGN`. Only the first device waiting
+ *   on the listener address answers, the others wait for the next poll.
+ * - `REGISTER` writes are stored in a `LICD_SIM_REGISTER_SIZE` register block.
+ * - Other commands go to the device handlers. Without request handler a device
+ *   answers a counter incremented on every request.
+ *
+ * ## Wire Time
+ * The bus models the time each transaction would take on the wire at its
+ * clock: 9 bits per byte, address included, plus a start and a stop per message.
+ * Under a virtual host clock (see `licd_platform.h`) the wire time also moves
+ * the clock forward.
+ *
+ * ## Fault Injection
+ * The bus can inject faults in the messages it executes, each kind with its
+ * own probability per message, or at scripted message indexes:
+ * - `LICD_SIM_FAULT_ADDRESS_NACK`: the address is not acknowledged.
+ * - `LICD_SIM_FAULT_DATA_NACK`: the slave stops acknowledging a write midway.
+ * - `LICD_SIM_FAULT_BIT_FLIP`: one bit of the message is inverted.
+ * - `LICD_SIM_FAULT_TRUNCATE`: the slave stops driving a read midway, the rest
+ *   reads as `0xFF`.
+ * - `LICD_SIM_FAULT_STRETCH`: the slave stretches the clock.
+ * - `LICD_SIM_FAULT_STUCK`: the slave holds SDA low until the adapter times out.
+ * - `LICD_SIM_FAULT_RESET`: the slave resets, dropping its assigned address.
+ *
+ * Faults only hit the messages of the configured address, and a fault that
+ * does not apply to a message (a data NACK on a read) is not injected. The
+ * random generator is seeded by the configuration, so a run is reproducible.
+ *
+ * ## Usage Example
+ * ```
+ * LicSimDevice device( 0x1234 );
+ *
+ * LicSimBus::attach( &device );
+ * LicSimBus::install( );
+ *
+ * LicDeviceManager manager;
+ *
+ * manager.PollDevice( );
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_SIM_H_
+#define LICD_SIM_H_
+
+#if defined( __linux__ ) && !defined( ARDUINO )
+
+/**
+ * @brief Maximum number of devices on the simulated bus.
+ **/
+#ifndef LICD_SIM_DEVICE_COUNT
+#define LICD_SIM_DEVICE_COUNT 16
+#endif
+
+/**
+ * @brief Size of the register block of a simulated device.
+ **/
+#ifndef LICD_SIM_REGISTER_SIZE
+#define LICD_SIM_REGISTER_SIZE 32
+#endif
+
+/**
+ * @brief Address matching every message in a fault configuration.
+ **/
+#define LICD_SIM_FAULT_ANY 0xFF
+
+class LicSimDevice;
+
+/**
+ * LicSimReceive typedef
+ * @note : Called with the bytes of a user command write, command code first.
+ **/
+typedef void (*LicSimReceive)( LicSimDevice& device, const uint8_t* data, const uint8_t size );
+
+/**
+ * LicSimRequest typedef
+ * @note : Fills the answer to the last command, returns the number of bytes
+ *         written, the rest of the answer reads as 0.
+ **/
+typedef uint8_t (*LicSimRequest)( LicSimDevice& device, const uint8_t command, uint8_t* data, const uint8_t size );
+
+/**
+ * @brief Faults injected by the simulated bus.
+ **/
+enum LicSimFaultKind : uint8_t {
+
+	LICD_SIM_FAULT_ADDRESS_NACK = 0,
+	LICD_SIM_FAULT_DATA_NACK,
+	LICD_SIM_FAULT_BIT_FLIP,
+	LICD_SIM_FAULT_TRUNCATE,
+	LICD_SIM_FAULT_STRETCH,
+	LICD_SIM_FAULT_STUCK,
+	LICD_SIM_FAULT_RESET,
+	LICD_SIM_FAULT_COUNT
+
+};
+
+/**
+ * @brief Random faults of the simulated bus.
+ *
+ * `rates` holds the probability per message of each `LicSimFaultKind`.
+ **/
+struct LicSimFaultConfig {
+
+	float rates[ LICD_SIM_FAULT_COUNT ] = { };
+	uint32_t stretch_time = 100;
+	uint32_t stuck_time = 25000;
+	uint32_t seed = 1;
+	uint8_t address = LICD_SIM_FAULT_ANY;
+
+};
+
+/**
+ * @brief Scripted fault, injected in the message of the given index.
+ *
+ * Message indexes count every message executed since the last `resetStats`.
+ **/
+struct LicSimFaultEvent {
+
+	uint32_t message;
+	LicSimFaultKind kind;
+
+};
+
+/**
+ * @brief Traffic counters of the simulated bus.
+ **/
+struct LicSimStats {
+
+	uint32_t transactions = 0;
+	uint32_t messages = 0;
+	uint32_t nacks = 0;
+	uint64_t bytes = 0;
+	uint64_t wire_time = 0;
+	uint32_t faults[ LICD_SIM_FAULT_COUNT ] = { };
+
+};
+
+/**
+ * @class LicSimDevice
+ * @brief Model of a LICD slave on the simulated bus.
+ * @author : ALVES Quentin
+ **/
+class LicSimDevice final {
+
+private:
+	LicDeviceAddress m_address;
+	LicDeviceHeader m_header;
+	uint8_t m_command;
+	LicSimReceive m_receive;
+	LicSimRequest m_request;
+	void* m_context;
+	uint32_t m_counter;
+	uint8_t m_registers[ LICD_SIM_REGISTER_SIZE ];
+
+public:
+	/**
+	 * @brief Constructor to initialize a device waiting on the listener address.
+	 *
+	 * @param uuid UUID of the device.
+	 * @param flags Capability flags of the device.
+	 **/
+	LicSimDevice( const uint32_t uuid = LICD_DEFAULT_UUID, const uint32_t flags = 0 );
+
+	/**
+	 * @brief Destructor for the device.
+	 **/
+	~LicSimDevice( );
+
+	/**
+	 * @brief Sets the handlers of the user commands.
+	 *
+	 * @param receive_handler Called on user command writes, may be nullptr.
+	 * @param request_handler Called on reads, may be nullptr.
+	 * @param context User pointer, retrieved by the handlers with `GetContext`.
+	 **/
+	void SetHandlers(
+		LicSimReceive receive_handler,
+		LicSimRequest request_handler,
+		void* context = nullptr
+	);
+
+	/**
+	 * @brief Drops the assigned address, as a slave reset would.
+	 **/
+	void Reset( );
+
+	/**
+	 * @brief Handles a write of the master.
+	 *
+	 * @param data Pointer to the written bytes.
+	 * @param size Number of bytes.
+	 **/
+	void Receive( const uint8_t* data, const uint8_t size );
+
+	/**
+	 * @brief Handles a read of the master.
+	 *
+	 * @param data Pointer to the answer buffer.
+	 * @param size Number of bytes read.
+	 **/
+	void Request( uint8_t* data, const uint8_t size );
+
+public:
+	/**
+	 * @brief Retrieves the current address of the device.
+	 *
+	 * @return The address, `LICD_LISTENER_ADDRESS` until assigned.
+	 **/
+	LicDeviceAddress GetAddress( ) const;
+
+	/**
+	 * @brief Retrieves the header of the device.
+	 *
+	 * @return Reference to the header.
+	 **/
+	const LicDeviceHeader& GetHeader( ) const;
+
+	/**
+	 * @brief Retrieves the register block written by the master.
+	 *
+	 * @return Pointer to `LICD_SIM_REGISTER_SIZE` bytes.
+	 **/
+	const uint8_t* GetRegisters( ) const;
+
+	/**
+	 * @brief Retrieves the user pointer given to `SetHandlers`.
+	 *
+	 * @return The user pointer.
+	 **/
+	void* GetContext( ) const;
+
+};
+
+/**
+ * @class LicSimBus
+ * @brief Simulated bus answering `LicI2cDevTransport` transactions.
+ * @author : ALVES Quentin
+ **/
+class LicSimBus final {
+
+private:
+	static LicSimDevice* s_devices[ LICD_SIM_DEVICE_COUNT ];
+	static uint8_t s_device_count;
+	static uint32_t s_clock;
+	static LicSimStats s_stats;
+	static LicSimFaultConfig s_faults;
+	static uint32_t s_fault_state;
+	static const LicSimFaultEvent* s_script;
+	static uint32_t s_script_size;
+	static uint32_t s_script_offset;
+
+public:
+	/**
+	 * @brief Plugs the simulated bus in `LicI2cDevTransport`.
+	 **/
+	static void install( );
+
+	/**
+	 * @brief Adds a device to the bus.
+	 *
+	 * @param device Pointer to the device, owned by the caller.
+	 * @return true if the device was added; false when the bus is full.
+	 **/
+	static bool attach( LicSimDevice* device );
+
+	/**
+	 * @brief Removes a device from the bus.
+	 *
+	 * @param device Pointer to the device.
+	 **/
+	static void detach( LicSimDevice* device );
+
+	/**
+	 * @brief Sets the clock used to model the wire time.
+	 *
+	 * @param clock SCL frequency in Hz.
+	 **/
+	static void setClock( const uint32_t clock );
+
+	/**
+	 * @brief Sets the random faults injected in the messages.
+	 *
+	 * @param config Fault rates and timings, the random generator restarts from its seed.
+	 **/
+	static void setFaults( const LicSimFaultConfig& config );
+
+	/**
+	 * @brief Sets the scripted faults injected in the messages.
+	 *
+	 * @param events Faults sorted by message index, owned by the caller, may be nullptr.
+	 * @param count Number of faults.
+	 **/
+	static void setScript( const LicSimFaultEvent* events, const uint32_t count );
+
+	/**
+	 * @brief Stops every random and scripted fault.
+	 **/
+	static void clearFaults( );
+
+	/**
+	 * @brief Clears the traffic counters.
+	 **/
+	static void resetStats( );
+
+	/**
+	 * @brief Executes an `I2C_RDWR` transaction on the simulated devices.
+	 *
+	 * @param transaction Transaction sent by `LicI2cDevTransport`.
+	 * @return 0 on success, `ENXIO` when no device owns an address, `EREMOTEIO`
+	 *         on a data NACK, `ETIMEDOUT` when SDA is stuck.
+	 **/
+	static int handle( struct i2c_rdwr_ioctl_data* transaction );
+
+	/**
+	 * @brief Computes the wire time of a message.
+	 *
+	 * @param size Number of data bytes.
+	 * @param clock SCL frequency in Hz.
+	 * @return The wire time (in nanoseconds).
+	 **/
+	static uint64_t wireTime( const uint32_t size, const uint32_t clock );
+
+	/**
+	 * @brief Finds the device answering an address.
+	 *
+	 * @param address Address of the message.
+	 * @return Pointer to the device, nullptr when none answers.
+	 **/
+	static LicSimDevice* find( const uint8_t address );
+
+private:
+	/**
+	 * @brief Picks the fault injected in the next message.
+	 *
+	 * @param message Message about to be executed.
+	 * @return The fault, `LICD_SIM_FAULT_COUNT` when none.
+	 **/
+	static LicSimFaultKind nextFault( const struct i2c_msg& message );
+
+	/**
+	 * @brief Draws a number from the fault random generator.
+	 *
+	 * @param range Number of values drawn from.
+	 * @return A number in [0, range[, 0 when range is 0.
+	 **/
+	static uint32_t random( const uint32_t range );
+
+public:
+	/**
+	 * @brief Retrieves the clock used to model the wire time.
+	 **/
+	static uint32_t getClock( );
+
+	/**
+	 * @brief Retrieves the traffic counters.
+	 **/
+	static const LicSimStats& getStats( );
+
+};
+
+#endif
+
+#endif /* !LICD_SIM_H_ */
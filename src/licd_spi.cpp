@@ -0,0 +1,647 @@
+/**
+ * @file licd_spi.cpp
+ * @brief Implementation of the `LicSpiTransport` class.
+ *
+ * The slave side relies on the AVR SPI peripheral and its interrupt, it is only
+ * compiled with `LICD_SPI_SLAVE` so the library never claims the SPI interrupt
+ * of a sketch using another SPI slave.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+#if defined( ARDUINO )
+
+#if defined( __AVR__ ) && defined( LICD_SPI_SLAVE )
+#define LICD_SPI_HAS_SLAVE
+#endif
+
+/**
+ * ====================
+ * LicSpiTransport
+ * ====================
+ */
+
+LicSpiSlot LicSpiTransport::s_slots[ LICD_SPI_SLOT_COUNT ] = { };
+uint8_t LicSpiTransport::s_slot_count = 0;
+uint8_t LicSpiTransport::s_listener_slot = LICD_SPI_SLOT_COUNT;
+bool LicSpiTransport::s_is_slave = false;
+bool LicSpiTransport::s_is_listening = true;
+void (*LicSpiTransport::s_receive)( int ) = nullptr;
+void (*LicSpiTransport::s_request)( void ) = nullptr;
+uint8_t LicSpiTransport::s_tx_address = 0;
+uint8_t LicSpiTransport::s_tx_data[ LICD_FRAME_SIZE ] = { };
+uint8_t LicSpiTransport::s_tx_size = 0;
+bool LicSpiTransport::s_is_overflow = false;
+bool LicSpiTransport::s_is_pending = false;
+uint8_t LicSpiTransport::s_rx_data[ LICD_FRAME_SIZE ] = { };
+uint8_t LicSpiTransport::s_rx_size = 0;
+uint8_t LicSpiTransport::s_rx_offset = 0;
+volatile uint8_t LicSpiTransport::s_in[ LICD_SPI_FRAME_SIZE ] = { };
+volatile uint8_t LicSpiTransport::s_in_size = 0;
+volatile uint8_t LicSpiTransport::s_out[ LICD_SPI_FRAME_SIZE ] = { };
+volatile uint8_t LicSpiTransport::s_out_size = 0;
+volatile uint8_t LicSpiTransport::s_out_index = 0;
+volatile bool LicSpiTransport::s_is_busy = false;
+
+// PUBLIC METHODS
+
+/**
+ * @brief Sets the chip-select lines of the master, in enumeration order.
+ *
+ * The lines are released right away, it can be called before the manager exists.
+ *
+ * @param pins Pointer to the chip-select pins.
+ * @param count Number of pins, at most `LICD_SPI_SLOT_COUNT`.
+ **/
+void LicSpiTransport::setChipSelects( const uint8_t* pins, const uint8_t count ) {
+	s_slot_count = ( count < LICD_SPI_SLOT_COUNT ) ? count : LICD_SPI_SLOT_COUNT;
+	s_listener_slot = LICD_SPI_SLOT_COUNT;
+
+	for ( uint8_t slot_id = 0; slot_id < s_slot_count; slot_id++ ) {
+		s_slots[ slot_id ].pin = pins[ slot_id ];
+		s_slots[ slot_id ].address = 0;
+
+		pinMode( pins[ slot_id ], OUTPUT );
+		digitalWrite( pins[ slot_id ], HIGH );
+	}
+}
+
+/**
+ * @brief Starts the bus as master.
+ **/
+void LicSpiTransport::begin( ) {
+	s_is_slave = false;
+
+	recover( );
+
+	SPI.begin( );
+}
+
+/**
+ * @brief Starts the bus as slave.
+ *
+ * A slave started on the listener address answers the `LICD_SPI_LISTENING`
+ * status until it is started again on its assigned address.
+ *
+ * @param address Address of the slave, only tells if it is assigned, the
+ * chip-select line addresses the slave.
+ **/
+void LicSpiTransport::begin( const uint8_t address ) {
+	s_is_listening = ( address <= LICD_LISTENER_ADDRESS );
+
+#if defined( LICD_SPI_HAS_SLAVE )
+	if ( !s_is_slave ) {
+		pinMode( MISO, OUTPUT );
+		pinMode( SS, INPUT );
+
+		setAnswer( nullptr, 0 );
+
+		s_out_index = 1;
+		SPDR = s_out[ 0 ];
+		SPCR = _BV( SPE ) | _BV( SPIE );
+	} else {
+		noInterrupts( );
+
+		s_out[ 0 ] = s_is_listening ? LICD_SPI_LISTENING : LICD_SPI_READY;
+
+		if ( s_in_size == 0 && !s_is_busy )
+			SPDR = s_out[ 0 ];
+
+		interrupts( );
+	}
+#endif
+
+	s_is_slave = true;
+}
+
+/**
+ * @brief Stops the bus.
+ **/
+void LicSpiTransport::end( ) {
+#if defined( LICD_SPI_HAS_SLAVE )
+	if ( s_is_slave ) {
+		SPCR = 0;
+		s_is_slave = false;
+
+		return;
+	}
+#endif
+
+	SPI.end( );
+}
+
+/**
+ * @brief Does nothing, the bus runs at `LICD_SPI_CLOCK`.
+ **/
+void LicSpiTransport::setClock( const uint32_t clock ) {
+	(void)clock;
+}
+
+/**
+ * @brief Does nothing, busy slaves are retried `LICD_SPI_TIMEOUT`.
+ **/
+void LicSpiTransport::setTimeout( const uint32_t timeout ) {
+	(void)timeout;
+}
+
+/**
+ * @brief Always false, a slave that never gets ready is reported as a NACK.
+ **/
+bool LicSpiTransport::getTimeoutFlag( ) {
+	return false;
+}
+
+/**
+ * @brief Always true, a frame never holds the bus past its chip-select.
+ **/
+bool LicSpiTransport::isIdle( ) {
+	return true;
+}
+
+/**
+ * @brief Releases every chip-select line and forgets the enumerated line.
+ **/
+bool LicSpiTransport::recover( ) {
+	for ( uint8_t slot_id = 0; slot_id < s_slot_count; slot_id++ )
+		digitalWrite( s_slots[ slot_id ].pin, HIGH );
+
+	s_listener_slot = LICD_SPI_SLOT_COUNT;
+
+	return true;
+}
+
+/**
+ * @brief Starts a write to a slave, sending the pending write first.
+ *
+ * @param address Address of the slave.
+ **/
+void LicSpiTransport::beginTransmission( const uint8_t address ) {
+	if ( s_is_pending )
+		sendWrite( );
+
+	s_tx_address = address;
+	s_tx_size = 0;
+	s_is_overflow = false;
+}
+
+/**
+ * @brief Queues one byte of the current write, or of the current answer on a slave.
+ *
+ * @param value Byte to write.
+ * @return The number of bytes queued, 0 when the write exceeds `LICD_FRAME_SIZE`.
+ **/
+size_t LicSpiTransport::write( const uint8_t value ) {
+	if ( s_tx_size == LICD_FRAME_SIZE ) {
+		s_is_overflow = true;
+
+		return 0;
+	}
+
+	s_tx_data[ s_tx_size++ ] = value;
+
+	return 1;
+}
+
+/**
+ * @brief Sends the current write, or keeps it for the next request.
+ *
+ * @param send_stop Whether the write is sent now, it travels in the next `QUERY` otherwise.
+ * @return A `Wire.endTransmission` like status, 0 on success.
+ **/
+uint8_t LicSpiTransport::endTransmission( const bool send_stop ) {
+	if ( s_is_overflow ) {
+		s_tx_size = 0;
+
+		return 1;
+	}
+
+	s_is_pending = true;
+
+	return send_stop ? sendWrite( ) : 0;
+}
+
+/**
+ * @brief Reads bytes from a slave with a `QUERY` then a `READ` frame.
+ *
+ * The `QUERY` carries the pending write to the same slave, if any.
+ *
+ * @param address Address of the slave.
+ * @param size Number of bytes to read.
+ * @return The number of bytes received.
+ **/
+uint8_t LicSpiTransport::requestFrom( const uint8_t address, const uint8_t size ) {
+	uint8_t frame[ LICD_SPI_FRAME_SIZE ];
+	const uint8_t request_size = ( size < LICD_FRAME_SIZE ) ? size : LICD_FRAME_SIZE;
+
+	if ( s_is_pending && s_tx_address != address )
+		sendWrite( );
+
+	if ( !s_is_pending )
+		s_tx_size = 0;
+
+	s_is_pending = false;
+	s_rx_size = 0;
+	s_rx_offset = 0;
+
+	frame[ 0 ] = LICD_SPI_QUERY;
+	frame[ 1 ] = 1 + s_tx_size;
+	frame[ 2 ] = request_size;
+
+	memcpy( frame + 3, s_tx_data, s_tx_size );
+
+	uint16_t crc = LicCRC::crc16( frame, 3 + s_tx_size );
+
+	frame[ 3 + s_tx_size ] = (uint8_t)crc;
+	frame[ 4 + s_tx_size ] = (uint8_t)( crc >> 8 );
+
+	if ( !transfer( address, frame, 5 + s_tx_size ) )
+		return 0;
+
+	memset( frame, 0, request_size + 4 );
+
+	frame[ 0 ] = LICD_SPI_READ;
+	frame[ 1 ] = request_size;
+
+	if ( !transfer( address, frame, request_size + 4 ) )
+		return 0;
+
+	const uint8_t answer_size = frame[ 1 ];
+
+	if ( answer_size > request_size )
+		return 0;
+
+	crc = (uint16_t)frame[ 2 + answer_size ] | ( (uint16_t)frame[ 3 + answer_size ] << 8 );
+
+	if ( LicCRC::crc16( frame + 1, 1 + answer_size ) != crc )
+		return 0;
+
+	memcpy( s_rx_data, frame + 2, answer_size );
+
+	s_rx_size = answer_size;
+
+	return s_rx_size;
+}
+
+/**
+ * @brief Gets the number of received bytes left.
+ **/
+int LicSpiTransport::available( ) {
+	return s_rx_size - s_rx_offset;
+}
+
+/**
+ * @brief Consumes one received byte.
+ *
+ * @return The byte, -1 when none is left.
+ **/
+int LicSpiTransport::read( ) {
+	if ( s_rx_offset == s_rx_size )
+		return -1;
+
+	return s_rx_data[ s_rx_offset++ ];
+}
+
+/**
+ * @brief Gets the next received byte without consuming it.
+ *
+ * @return The byte, -1 when none is left.
+ **/
+int LicSpiTransport::peek( ) {
+	if ( s_rx_offset == s_rx_size )
+		return -1;
+
+	return s_rx_data[ s_rx_offset ];
+}
+
+/**
+ * @brief Registers the slave receive callback, called by `poll`.
+ **/
+void LicSpiTransport::onReceive( void (*handler)( int ) ) {
+	s_receive = handler;
+}
+
+/**
+ * @brief Registers the slave request callback, called by `poll`.
+ **/
+void LicSpiTransport::onRequest( void (*handler)( void ) ) {
+	s_request = handler;
+}
+
+/**
+ * @brief Processes the frame completed by the slave interrupt.
+ *
+ * Handlers run from the sketch loop, not from the SPI interrupt, the answer
+ * is precomputed here and streamed out by the interrupt during the `READ`.
+ * A partial frame left when the chip-select rises is dropped.
+ **/
+void LicSpiTransport::poll( ) {
+#if defined( LICD_SPI_HAS_SLAVE )
+	if ( !s_is_busy ) {
+		noInterrupts( );
+
+		if ( s_in_size > 0 && digitalRead( SS ) == HIGH ) {
+			s_in_size = 0;
+			s_out_index = 1;
+			SPDR = s_out[ 0 ];
+		}
+
+		interrupts( );
+
+		return;
+	}
+
+	uint8_t frame[ LICD_SPI_FRAME_SIZE ];
+	const uint8_t frame_size = s_in[ 1 ];
+
+	for ( uint8_t byte_id = 0; byte_id < frame_size + 4; byte_id++ )
+		frame[ byte_id ] = s_in[ byte_id ];
+
+	const uint16_t crc = (uint16_t)frame[ 2 + frame_size ] | ( (uint16_t)frame[ 3 + frame_size ] << 8 );
+	uint8_t answer_size = 0;
+
+	s_rx_offset = 0;
+	s_rx_size = 0;
+
+	if ( LicCRC::crc16( frame, 2 + frame_size ) == crc ) {
+		if ( frame[ 0 ] == LICD_SPI_WRITE && frame_size > 0 ) {
+			s_rx_size = frame_size;
+
+			memcpy( s_rx_data, frame + 2, frame_size );
+		} else if ( frame[ 0 ] == LICD_SPI_QUERY && frame_size > 1 ) {
+			s_rx_size = frame_size - 1;
+
+			memcpy( s_rx_data, frame + 3, frame_size - 1 );
+		}
+
+		if ( s_rx_size > 0 && s_receive != nullptr )
+			s_receive( s_rx_size );
+
+		if ( frame[ 0 ] == LICD_SPI_QUERY && frame_size > 0 ) {
+			s_tx_size = 0;
+
+			if ( s_request != nullptr )
+				s_request( );
+
+			answer_size = ( s_tx_size < frame[ 2 ] ) ? s_tx_size : frame[ 2 ];
+		}
+	}
+
+	setAnswer( s_tx_data, answer_size );
+
+	noInterrupts( );
+
+	s_in_size = 0;
+	s_out_index = 1;
+	SPDR = s_out[ 0 ];
+	s_is_busy = false;
+
+	interrupts( );
+#endif
+}
+
+/**
+ * @brief Exchanges one byte on the slave side, called by the SPI interrupt.
+ *
+ * The byte sent during the exchange `n` of a frame is `s_out[ n ]`, a frame
+ * starts with the status byte. A complete `WRITE` or `QUERY` makes the slave
+ * busy until `poll` processed it, a complete `READ` drops the answer.
+ *
+ * @param value Byte received from the master.
+ * @return The byte to send during the next exchange.
+ **/
+uint8_t LicSpiTransport::exchange( const uint8_t value ) {
+	if ( s_is_busy )
+		return LICD_SPI_BUSY;
+
+	if ( s_in_size == 0 && value == LICD_SPI_NOP ) {
+		s_out_index = 1;
+
+		return s_out[ 0 ];
+	}
+
+	s_in[ s_in_size++ ] = value;
+
+	if ( s_in_size == 2 && s_in[ 1 ] > 1 + LICD_FRAME_SIZE ) {
+		s_in_size = 0;
+		s_out_index = 1;
+
+		return s_out[ 0 ];
+	}
+
+	if ( s_in_size < 2 || s_in_size < s_in[ 1 ] + 4 )
+		return ( s_out_index < s_out_size ) ? s_out[ s_out_index++ ] : 0;
+
+	if ( s_in[ 0 ] != LICD_SPI_READ ) {
+		s_is_busy = true;
+
+		return LICD_SPI_BUSY;
+	}
+
+	setAnswer( nullptr, 0 );
+
+	s_in_size = 0;
+	s_out_index = 1;
+
+	return s_out[ 0 ];
+}
+
+// PRIVATE METHODS
+
+/**
+ * @brief Sends the pending write in a `WRITE` frame.
+ *
+ * An `ASSIGN` accepted on the listener address binds the enumerated line to the
+ * new address.
+ *
+ * @return A `Wire.endTransmission` like status, 0 on success.
+ **/
+uint8_t LicSpiTransport::sendWrite( ) {
+	uint8_t frame[ LICD_SPI_FRAME_SIZE ];
+
+	s_is_pending = false;
+
+	frame[ 0 ] = LICD_SPI_WRITE;
+	frame[ 1 ] = s_tx_size;
+
+	memcpy( frame + 2, s_tx_data, s_tx_size );
+
+	const uint16_t crc = LicCRC::crc16( frame, 2 + s_tx_size );
+
+	frame[ 2 + s_tx_size ] = (uint8_t)crc;
+	frame[ 3 + s_tx_size ] = (uint8_t)( crc >> 8 );
+
+	if ( !transfer( s_tx_address, frame, 4 + s_tx_size ) )
+		return 2;
+
+	const bool is_assign = ( s_tx_address == LICD_LISTENER_ADDRESS && s_tx_size > 1 && s_tx_data[ 0 ] == LICD_COMMAND_ASSIGN );
+
+	if ( is_assign && s_listener_slot < s_slot_count ) {
+		s_slots[ s_listener_slot ].address = s_tx_data[ 1 ];
+		s_listener_slot = LICD_SPI_SLOT_COUNT;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Sends a frame to a slave, retrying while the slave is busy.
+ *
+ * A line whose slave does not answer, or answers that it waits for an address,
+ * is released, its slave is enumerated again on the listener address. The waits
+ * between attempts run the yield hook of `LicYield`.
+ *
+ * @param address Address of the slave.
+ * @param frame Pointer to the MOSI bytes, replaced by the MISO bytes.
+ * @param size Frame size.
+ * @return true if the slave was ready and the frame went through; false otherwise.
+ **/
+bool LicSpiTransport::transfer( const uint8_t address, uint8_t* frame, const uint8_t size ) {
+	uint8_t exchange_frame[ LICD_SPI_FRAME_SIZE ];
+	const uint64_t deadline = LicClock::now( ) + (uint64_t)LICD_SPI_TIMEOUT * 1000;
+
+	for ( ; ; ) {
+		const uint8_t slot_id = findSlot( address );
+
+		if ( slot_id == LICD_SPI_SLOT_COUNT )
+			return false;
+
+		memcpy( exchange_frame, frame, size );
+
+		const uint8_t status = exchangeFrame( slot_id, exchange_frame, size );
+
+		if ( status == LICD_SPI_LISTENING && address != LICD_LISTENER_ADDRESS ) {
+			s_slots[ slot_id ].address = 0;
+
+			return false;
+		}
+
+		if ( status == LICD_SPI_READY || status == LICD_SPI_LISTENING ) {
+			memcpy( frame, exchange_frame, size );
+
+			return true;
+		}
+
+		if ( status != LICD_SPI_BUSY ) {
+			if ( address == LICD_LISTENER_ADDRESS )
+				s_listener_slot = LICD_SPI_SLOT_COUNT;
+			else
+				s_slots[ slot_id ].address = 0;
+
+			return false;
+		}
+
+		const uint64_t resume_time = LicClock::now( ) + LICD_SPI_TURNAROUND;
+
+		do {
+			if ( !LicYield::run( deadline ) )
+				return false;
+		} while ( LicClock::now( ) < resume_time );
+	}
+}
+
+/**
+ * @brief Exchanges a frame on a chip-select line.
+ *
+ * The frame stops after its first byte when the slave is busy or does not answer.
+ *
+ * @param slot_id Index of the line.
+ * @param frame Pointer to the MOSI bytes, replaced by the MISO bytes.
+ * @param size Frame size.
+ * @return The status byte of the slave.
+ **/
+uint8_t LicSpiTransport::exchangeFrame( const uint8_t slot_id, uint8_t* frame, const uint8_t size ) {
+	SPI.beginTransaction( SPISettings( LICD_SPI_CLOCK, MSBFIRST, SPI_MODE0 ) );
+	digitalWrite( s_slots[ slot_id ].pin, LOW );
+
+	const uint8_t status = SPI.transfer( frame[ 0 ] );
+
+	if ( ( status == LICD_SPI_READY || status == LICD_SPI_LISTENING ) && size > 1 )
+		SPI.transfer( frame + 1, size - 1 );
+
+	frame[ 0 ] = status;
+
+	digitalWrite( s_slots[ slot_id ].pin, HIGH );
+	SPI.endTransaction( );
+
+	return status;
+}
+
+/**
+ * @brief Finds the chip-select line of an address.
+ *
+ * Listener transactions go to the first line without address whose slave
+ * answers a `NOP`, the line stays selected until its `ASSIGN`.
+ *
+ * @param address Address of the slave.
+ * @return The line index, `LICD_SPI_SLOT_COUNT` when none.
+ **/
+uint8_t LicSpiTransport::findSlot( const uint8_t address ) {
+	if ( address != LICD_LISTENER_ADDRESS ) {
+		for ( uint8_t slot_id = 0; slot_id < s_slot_count; slot_id++ ) {
+			if ( s_slots[ slot_id ].address == address )
+				return slot_id;
+		}
+
+		return LICD_SPI_SLOT_COUNT;
+	}
+
+	if ( s_listener_slot < s_slot_count )
+		return s_listener_slot;
+
+	for ( uint8_t slot_id = 0; slot_id < s_slot_count; slot_id++ ) {
+		uint8_t probe = LICD_SPI_NOP;
+
+		if ( s_slots[ slot_id ].address > 0 )
+			continue;
+
+		const uint8_t status = exchangeFrame( slot_id, &probe, 1 );
+
+		if ( status == LICD_SPI_READY || status == LICD_SPI_BUSY || status == LICD_SPI_LISTENING ) {
+			s_listener_slot = slot_id;
+
+			return slot_id;
+		}
+	}
+
+	return LICD_SPI_SLOT_COUNT;
+}
+
+/**
+ * @brief Stores the answer streamed out by the next `READ`.
+ *
+ * @param data Pointer to the answer.
+ * @param size Answer size.
+ **/
+void LicSpiTransport::setAnswer( const uint8_t* data, const uint8_t size ) {
+	uint8_t answer[ LICD_SPI_FRAME_SIZE ];
+
+	answer[ 0 ] = s_is_listening ? LICD_SPI_LISTENING : LICD_SPI_READY;
+	answer[ 1 ] = size;
+
+	if ( size > 0 )
+		memcpy( answer + 2, data, size );
+
+	const uint16_t crc = LicCRC::crc16( answer + 1, 1 + size );
+
+	answer[ 2 + size ] = (uint8_t)crc;
+	answer[ 3 + size ] = (uint8_t)( crc >> 8 );
+
+	for ( uint8_t byte_id = 0; byte_id < size + 4; byte_id++ )
+		s_out[ byte_id ] = answer[ byte_id ];
+
+	s_out_size = size + 4;
+}
+
+#if defined( LICD_SPI_HAS_SLAVE )
+
+ISR( SPI_STC_vect ) {
+	SPDR = LicSpiTransport::exchange( SPDR );
+}
+
+#endif
+
+#endif
@@ -0,0 +1,332 @@
+/**
+ * @file licd_spi.h
+ * @brief LICD transport over SPI with chip-select addressing.
+ *
+ * This header defines `LicSpiTransport`, a transport carrying the LICD protocol
+ * over SPI for slaves sitting on the same board as the master. Every slave owns
+ * a chip-select line from the master table, the chip-select replaces the I2C
+ * address on the wire.
+ *
+ * ## Enumeration
+ * The listener address is mapped onto the chip-select lines: transactions to
+ * `LICD_LISTENER_ADDRESS` go to the first line without address whose slave
+ * answers, and the `ASSIGN` command binds that line to the new address. The
+ * `LicDeviceManager` registration runs unchanged, a line whose slave stops
+ * answering is released and enumerated again. SPI has no address NACK, so a
+ * slave without address answers `LICD_SPI_LISTENING` instead of `LICD_SPI_READY`:
+ * a bound line whose slave reset is released on its next frame.
+ *
+ * ## Frames
+ * | Frame   | MOSI                              | MISO                                      |
+ * |---------|-----------------------------------|-------------------------------------------|
+ * | `WRITE` | `[type][size][payload][crc16]`    | `[status]...`                             |
+ * | `QUERY` | `[type][size][request][payload][crc16]` | `[status]...`                       |
+ * | `READ`  | `[type][size][0...]`              | `[status][size][answer][crc16]`           |
+ *
+ * - SPI is full-duplex, the slave streams out its precomputed answer while the
+ *   next frame streams in. A `QUERY` makes the slave run its receive and request
+ *   handlers once the frame is complete, the `READ` that follows clocks the
+ *   answer out with no turnaround inside the frame.
+ * - The status byte tells if the slave processed the previous frame, and if it
+ *   waits for an address (`LICD_SPI_LISTENING`). The master
+ *   drops the frame after its first byte while the slave is busy, and retries
+ *   every `LICD_SPI_TURNAROUND` until `LICD_SPI_TIMEOUT`. A floating MISO reads
+ *   as neither status and stands for an address NACK.
+ * - The bus runs at `LICD_SPI_CLOCK`, the I2C clocks negotiated by the manager
+ *   do not apply.
+ *
+ * ## Usage Example
+ * ```
+ * // Master
+ * const uint8_t chip_selects[ ] = { 10, 9, 8 };
+ *
+ * LicSpiTransport::setChipSelects( chip_selects, 3 );
+ *
+ * // Slave (AVR, built with LICD_SPI_SLAVE), polls the frames from its loop.
+ * void loop( ) {
+ *     LicSpiTransport::poll( );
+ * }
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_SPI_H_
+#define LICD_SPI_H_
+
+#if defined( ARDUINO )
+
+#include <SPI.h>
+
+/**
+ * @brief SPI clock (in Hz).
+ **/
+#ifndef LICD_SPI_CLOCK
+#define LICD_SPI_CLOCK 4000000
+#endif
+
+/**
+ * @brief Maximum number of chip-select lines.
+ **/
+#ifndef LICD_SPI_SLOT_COUNT
+#define LICD_SPI_SLOT_COUNT 8
+#endif
+
+/**
+ * @brief Delay (in microseconds) between two attempts on a busy slave.
+ **/
+#ifndef LICD_SPI_TURNAROUND
+#define LICD_SPI_TURNAROUND 10
+#endif
+
+/**
+ * @brief Time (in milliseconds) a busy slave is retried before the frame fails.
+ *
+ * A slave stays busy 30 ms after handling an `ASSIGN`, the timeout must be longer.
+ **/
+#ifndef LICD_SPI_TIMEOUT
+#define LICD_SPI_TIMEOUT 40
+#endif
+
+/**
+ * @brief Frame types.
+ **/
+#define LICD_SPI_NOP 0x00
+#define LICD_SPI_WRITE 0x01
+#define LICD_SPI_QUERY 0x02
+#define LICD_SPI_READ 0x03
+
+/**
+ * @brief Slave status bytes.
+ **/
+#define LICD_SPI_READY 0x5A
+#define LICD_SPI_BUSY 0xA5
+#define LICD_SPI_LISTENING 0x3C
+
+/**
+ * @brief Largest frame, a query carrying a full write.
+ **/
+#define LICD_SPI_FRAME_SIZE ( 3 + LICD_FRAME_SIZE + 2 )
+
+/**
+ * @brief Chip-select line of the master table.
+ **/
+struct LicSpiSlot {
+
+	uint8_t pin = 0;
+	uint8_t address = 0;
+
+};
+
+/**
+ * @class LicSpiTransport
+ * @brief LICD transport over SPI with chip-select addressing.
+ * @author : ALVES Quentin
+ **/
+class LicSpiTransport final {
+
+private:
+	static LicSpiSlot s_slots[ LICD_SPI_SLOT_COUNT ];
+	static uint8_t s_slot_count;
+	static uint8_t s_listener_slot;
+	static bool s_is_slave;
+	static bool s_is_listening;
+	static void (*s_receive)( int );
+	static void (*s_request)( void );
+	static uint8_t s_tx_address;
+	static uint8_t s_tx_data[ LICD_FRAME_SIZE ];
+	static uint8_t s_tx_size;
+	static bool s_is_overflow;
+	static bool s_is_pending;
+	static uint8_t s_rx_data[ LICD_FRAME_SIZE ];
+	static uint8_t s_rx_size;
+	static uint8_t s_rx_offset;
+	static volatile uint8_t s_in[ LICD_SPI_FRAME_SIZE ];
+	static volatile uint8_t s_in_size;
+	static volatile uint8_t s_out[ LICD_SPI_FRAME_SIZE ];
+	static volatile uint8_t s_out_size;
+	static volatile uint8_t s_out_index;
+	static volatile bool s_is_busy;
+
+public:
+	/**
+	 * @brief Sets the chip-select lines of the master, in enumeration order.
+	 *
+	 * @param pins Pointer to the chip-select pins.
+	 * @param count Number of pins, at most `LICD_SPI_SLOT_COUNT`.
+	 **/
+	static void setChipSelects( const uint8_t* pins, const uint8_t count );
+
+	/**
+	 * @brief Starts the bus as master.
+	 **/
+	static void begin( );
+
+	/**
+	 * @brief Starts the bus as slave, needs `LICD_SPI_SLAVE` on AVR.
+	 *
+	 * @param address Address of the slave, only tells if it is assigned, the
+	 * chip-select line addresses the slave.
+	 **/
+	static void begin( const uint8_t address );
+
+	/**
+	 * @brief Stops the bus.
+	 **/
+	static void end( );
+
+	/**
+	 * @brief Does nothing, the bus runs at `LICD_SPI_CLOCK`.
+	 **/
+	static void setClock( const uint32_t clock );
+
+	/**
+	 * @brief Does nothing, busy slaves are retried `LICD_SPI_TIMEOUT`.
+	 **/
+	static void setTimeout( const uint32_t timeout );
+
+	/**
+	 * @brief Always false, a slave that never gets ready is reported as a NACK.
+	 **/
+	static bool getTimeoutFlag( );
+
+	/**
+	 * @brief Always true, a frame never holds the bus past its chip-select.
+	 **/
+	static bool isIdle( );
+
+	/**
+	 * @brief Releases every chip-select line.
+	 **/
+	static bool recover( );
+
+	/**
+	 * @brief Starts a write to a slave, sending the pending write first.
+	 *
+	 * @param address Address of the slave.
+	 **/
+	static void beginTransmission( const uint8_t address );
+
+	/**
+	 * @brief Queues one byte of the current write, or of the current answer on a slave.
+	 *
+	 * @param value Byte to write.
+	 * @return The number of bytes queued, 0 when the write exceeds `LICD_FRAME_SIZE`.
+	 **/
+	static size_t write( const uint8_t value );
+
+	/**
+	 * @brief Sends the current write, or keeps it for the next request.
+	 *
+	 * @param send_stop Whether the write is sent now, it travels in the next `QUERY` otherwise.
+	 * @return A `Wire.endTransmission` like status, 0 on success.
+	 **/
+	static uint8_t endTransmission( const bool send_stop );
+
+	/**
+	 * @brief Reads bytes from a slave with a `QUERY` then a `READ` frame.
+	 *
+	 * @param address Address of the slave.
+	 * @param size Number of bytes to read.
+	 * @return The number of bytes received.
+	 **/
+	static uint8_t requestFrom( const uint8_t address, const uint8_t size );
+
+	/**
+	 * @brief Gets the number of received bytes left.
+	 **/
+	static int available( );
+
+	/**
+	 * @brief Consumes one received byte.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int read( );
+
+	/**
+	 * @brief Gets the next received byte without consuming it.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int peek( );
+
+	/**
+	 * @brief Registers the slave receive callback, called by `poll`.
+	 **/
+	static void onReceive( void (*handler)( int ) );
+
+	/**
+	 * @brief Registers the slave request callback, called by `poll`.
+	 **/
+	static void onRequest( void (*handler)( void ) );
+
+	/**
+	 * @brief Processes the frame completed by the slave interrupt.
+	 *
+	 * Handlers run from the sketch loop, not from the SPI interrupt, the answer
+	 * is precomputed here and streamed out by the interrupt during the `READ`.
+	 **/
+	static void poll( );
+
+	/**
+	 * @brief Exchanges one byte on the slave side, called by the SPI interrupt.
+	 *
+	 * @param value Byte received from the master.
+	 * @return The byte to send during the next exchange.
+	 **/
+	static uint8_t exchange( const uint8_t value );
+
+private:
+	/**
+	 * @brief Sends the pending write in a `WRITE` frame.
+	 *
+	 * @return A `Wire.endTransmission` like status, 0 on success.
+	 **/
+	static uint8_t sendWrite( );
+
+	/**
+	 * @brief Sends a frame to a slave, retrying while the slave is busy.
+	 *
+	 * @param address Address of the slave.
+	 * @param frame Pointer to the MOSI bytes, replaced by the MISO bytes.
+	 * @param size Frame size.
+	 * @return true if the slave was ready and the frame went through; false otherwise.
+	 **/
+	static bool transfer( const uint8_t address, uint8_t* frame, const uint8_t size );
+
+	/**
+	 * @brief Exchanges a frame on a chip-select line.
+	 *
+	 * @param slot_id Index of the line.
+	 * @param frame Pointer to the MOSI bytes, replaced by the MISO bytes.
+	 * @param size Frame size.
+	 * @return The status byte of the slave.
+	 **/
+	static uint8_t exchangeFrame( const uint8_t slot_id, uint8_t* frame, const uint8_t size );
+
+	/**
+	 * @brief Finds the chip-select line of an address.
+	 *
+	 * Listener transactions go to the first line without address whose slave answers.
+	 *
+	 * @param address Address of the slave.
+	 * @return The line index, `LICD_SPI_SLOT_COUNT` when none.
+	 **/
+	static uint8_t findSlot( const uint8_t address );
+
+	/**
+	 * @brief Stores the answer streamed out by the next `READ`.
+	 *
+	 * @param data Pointer to the answer.
+	 * @param size Answer size.
+	 **/
+	static void setAnswer( const uint8_t* data, const uint8_t size );
+
+};
+
+#endif
+
+#endif /* !LICD_SPI_H_ */
@@ -0,0 +1,102 @@
+/**
+ * @file licd_stream_buffer.cpp
+ * @brief Implementation of the slave-side stream receive buffer.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#include "licd.h"
+
+/**
+ * ====================
+ * LicStreamBuffer
+ * ====================
+ */
+
+// PUBLIC METHODS
+
+/**
+ * @brief Constructs an empty `LicStreamBuffer`.
+ **/
+LicStreamBuffer::LicStreamBuffer( )
+	: m_head{ 0 },
+	m_tail{ 0 },
+	m_data{ }
+{ }
+
+/**
+ * @brief Destructor for `LicStreamBuffer`.
+ **/
+LicStreamBuffer::~LicStreamBuffer( ) { }
+
+/**
+ * @brief Drops every buffered byte.
+ **/
+void LicStreamBuffer::Clear( ) {
+	m_tail = m_head;
+}
+
+/**
+ * @brief Appends a byte, called by the producer.
+ *
+ * @param value Byte to append.
+ * @return true if the byte was appended; false if the ring is full.
+ **/
+bool LicStreamBuffer::Push( const uint8_t value ) {
+	const uint8_t head = m_head;
+	const uint8_t next = ( head + 1 ) % LICD_STREAM_SIZE;
+
+	if ( next == m_tail )
+		return false;
+
+	m_data[ head ] = value;
+	m_head = next;
+
+	return true;
+}
+
+/**
+ * @brief Removes buffered bytes, called by the consumer.
+ *
+ * @param data Pointer to the memory where the bytes will be stored.
+ * @param size Maximum number of bytes to read.
+ * @return The number of bytes read.
+ **/
+uint32_t LicStreamBuffer::Read( uint8_t* data, const uint32_t size ) {
+	uint8_t tail = m_tail;
+	uint32_t data_offset = 0;
+
+	while ( data_offset < size && tail != m_head ) {
+		data[ data_offset++ ] = m_data[ tail ];
+		tail = ( tail + 1 ) % LICD_STREAM_SIZE;
+	}
+
+	m_tail = tail;
+
+	return data_offset;
+}
+
+// PUBLIC GETTERS
+
+/**
+ * @brief Retrieves the number of buffered bytes.
+ *
+ * @return The number of bytes ready to be read.
+ **/
+uint8_t LicStreamBuffer::GetSize( ) const {
+	const uint8_t head = m_head;
+	const uint8_t tail = m_tail;
+
+	return ( head >= tail ) ? ( head - tail ) : ( LICD_STREAM_SIZE - tail + head );
+}
+
+/**
+ * @brief Retrieves the free space of the ring.
+ *
+ * @return The number of bytes that can still be pushed.
+ **/
+uint8_t LicStreamBuffer::GetFree( ) const {
+	return ( LICD_STREAM_SIZE - 1 ) - GetSize( );
+}
@@ -0,0 +1,85 @@
+/**
+ * @file licd_stream_buffer.h
+ * @brief Provides the slave-side receive buffer of LICD streams.
+ *
+ * This header defines the `LicStreamBuffer` class, a single producer, single
+ * consumer byte ring. The Wire receive interrupt pushes `LICD_COMMAND_STREAM`
+ * payloads into it while the application loop drains it. The free space of the
+ * ring is what the slave advertises to the master as stream credits.
+ *
+ * ## Notes
+ * - Indices are single bytes so they are read and written atomically on 8-bit MCUs,
+ *   `LICD_STREAM_SIZE` must not exceed 255.
+ * - The ring holds at most `LICD_STREAM_SIZE - 1` bytes.
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_STREAM_BUFFER_H_
+#define LICD_STREAM_BUFFER_H_
+
+/**
+ * @class LicStreamBuffer
+ * @brief Single producer, single consumer byte ring.
+ * @author : ALVES Quentin
+ **/
+class LicStreamBuffer final {
+
+private:
+	volatile uint8_t m_head;
+	volatile uint8_t m_tail;
+	uint8_t m_data[ LICD_STREAM_SIZE ];
+
+public:
+	/**
+	 * @brief Constructor to initialize an empty ring.
+	 **/
+	LicStreamBuffer( );
+
+	/**
+	 * @brief Destructor for the ring.
+	 **/
+	~LicStreamBuffer( );
+
+	/**
+	 * @brief Drops every buffered byte.
+	 **/
+	void Clear( );
+
+	/**
+	 * @brief Appends a byte, called by the producer.
+	 * 
+	 * @param value Byte to append.
+	 * @return true if the byte was appended; false if the ring is full.
+	 **/
+	bool Push( const uint8_t value );
+
+	/**
+	 * @brief Removes buffered bytes, called by the consumer.
+	 * 
+	 * @param data Pointer to the memory where the bytes will be stored.
+	 * @param size Maximum number of bytes to read.
+	 * @return The number of bytes read.
+	 **/
+	uint32_t Read( uint8_t* data, const uint32_t size );
+
+public:
+	/**
+	 * @brief Retrieves the number of buffered bytes.
+	 * 
+	 * @return The number of bytes ready to be read.
+	 **/
+	uint8_t GetSize( ) const;
+
+	/**
+	 * @brief Retrieves the free space of the ring.
+	 * 
+	 * @return The number of bytes that can still be pushed.
+	 **/
+	uint8_t GetFree( ) const;
+
+};
+
+#endif /* !LICD_STREAM_BUFFER_H_ */
@@ -0,0 +1,288 @@
+/**
+ * @file licd_transport.h
+ * @brief Defines the bus transport used by the LICD protocol.
+ *
+ * The LICD logic never talks to a bus singleton directly, it goes through
+ * `LicTransport`, a class selected at compile time with `LICD_TRANSPORT`. A
+ * transport only exposes static methods, every call is resolved by the compiler
+ * and inlined, exactly as a direct call to `Wire` would be.
+ *
+ * ## Transports
+ * - `LicWireTransport`: Arduino `Wire` library, default on Arduino.
+ * - `LicI2cDevTransport`: Linux `/dev/i2c-N`, default on Linux host builds (`licd_i2c_dev.h`).
+ * - `LicRs485Transport<Port>`: half-duplex UART / RS-485 multi-drop line (`licd_rs485.h`).
+ * - `LicSpiTransport`: SPI with chip-select addressing, Arduino only (`licd_spi.h`).
+ *
+ * ## Transport Concept
+ * | Method                                | Role                                              |
+ * |---------------------------------------|---------------------------------------------------|
+ * | `begin( )` / `begin( address )`       | Starts the bus as master / as slave at `address`  |
+ * | `end( )`                              | Stops the bus                                     |
+ * | `setClock( clock )`                   | Sets the bus clock (in Hz)                        |
+ * | `setTimeout( timeout )`               | Arms transaction timeouts (in microseconds)       |
+ * | `getTimeoutFlag( )`                   | Reads and clears the transaction timeout flag     |
+ * | `isIdle( )`                           | Checks that no peer holds the bus                 |
+ * | `recover( )`                          | Frees a bus held by a peer                        |
+ * | `beginTransmission( address )`        | Starts a write to a peer                          |
+ * | `write( value )`                      | Queues one byte of the current write              |
+ * | `endTransmission( send_stop )`        | Sends the write, returns a `Wire` like status     |
+ * | `requestFrom( address, size )`        | Reads up to `size` bytes from a peer              |
+ * | `available( )` / `read( )` / `peek( )`| Consumes the received bytes                       |
+ * | `onReceive( h )` / `onRequest( h )`   | Registers the slave callbacks                     |
+ *
+ * ## Usage Example
+ * ```
+ * // Build flags, or a define visible to every library translation unit.
+ * #define LICD_TRANSPORT_HEADER "my_transport.h"
+ * #define LICD_TRANSPORT MyTransport
+ * ```
+ *
+ * @author ALVES Quentin
+ * @date 17/10/2026
+ * @version 1.0
+ **/
+
+#ifndef LICD_TRANSPORT_H_
+#define LICD_TRANSPORT_H_
+
+#if defined( ARDUINO )
+#include <Wire.h>
+#endif
+
+#include "licd_clock.h"
+#include "licd_i2c_dev.h"
+#include "licd_rs485.h"
+#include "licd_spi.h"
+
+#if defined( LICD_TRANSPORT_HEADER )
+#include LICD_TRANSPORT_HEADER
+#endif
+
+/**
+ * @brief Transport class carrying the LICD protocol.
+ *
+ * Defaulted after `LICD_TRANSPORT_HEADER`, which may define it.
+ **/
+#ifndef LICD_TRANSPORT
+#if defined( ARDUINO )
+#define LICD_TRANSPORT LicWireTransport
+#else
+#define LICD_TRANSPORT LicI2cDevTransport
+#endif
+#endif
+
+#if defined( ARDUINO )
+
+/**
+ * @class LicWireTransport
+ * @brief LICD transport over the Arduino `Wire` library.
+ * @author : ALVES Quentin
+ **/
+class LicWireTransport final {
+
+public:
+	/**
+	 * @brief Starts the bus as master.
+	 **/
+	static void begin( ) {
+		Wire.begin( );
+	};
+
+	/**
+	 * @brief Starts the bus as slave.
+	 *
+	 * @param address I2C address of the slave.
+	 **/
+	static void begin( const uint8_t address ) {
+		Wire.begin( address );
+	};
+
+	/**
+	 * @brief Stops the bus, when the Wire implementation supports it.
+	 **/
+	static void end( ) {
+	#if defined( WIRE_HAS_END )
+		Wire.end( );
+	#endif
+	};
+
+	/**
+	 * @brief Sets the SCL frequency.
+	 *
+	 * @param clock SCL frequency (in Hz).
+	 **/
+	static void setClock( const uint32_t clock ) {
+		Wire.setClock( clock );
+	};
+
+	/**
+	 * @brief Arms transaction timeouts, when the Wire implementation supports it.
+	 *
+	 * @param timeout Transaction timeout (in microseconds).
+	 **/
+	static void setTimeout( const uint32_t timeout ) {
+	#if defined( WIRE_HAS_TIMEOUT )
+		Wire.setWireTimeout( timeout, true );
+		Wire.clearWireTimeoutFlag( );
+	#else
+		(void)timeout;
+	#endif
+	};
+
+	/**
+	 * @brief Reads and clears the transaction timeout flag.
+	 *
+	 * @return true if a transaction timed out since the last call; false otherwise.
+	 **/
+	static bool getTimeoutFlag( ) {
+	#if defined( WIRE_HAS_TIMEOUT )
+		const bool is_timeout = Wire.getWireTimeoutFlag( );
+
+		if ( is_timeout )
+			Wire.clearWireTimeoutFlag( );
+
+		return is_timeout;
+	#else
+		return false;
+	#endif
+	};
+
+	/**
+	 * @brief Checks that SDA and SCL are released.
+	 *
+	 * @return true if both lines are high; false otherwise.
+	 **/
+	static bool isIdle( ) {
+		return digitalRead( LICD_SDA_PIN ) == HIGH && digitalRead( LICD_SCL_PIN ) == HIGH;
+	};
+
+	/**
+	 * @brief Frees a bus held by a slave.
+	 *
+	 * A slave reset in the middle of a read may hold SDA low forever, waiting for
+	 * clocks the master will never send. Up to 9 clocks are pulsed on SCL until the
+	 * slave releases SDA, then a STOP condition is generated by hand. The bus must
+	 * be stopped before and started again after.
+	 *
+	 * Lines are only ever pulled low or released: the output latch is cleared
+	 * before a pin turns to output, otherwise the pull-up left it high and the
+	 * pin would drive high against the slave holding the line.
+	 *
+	 * @return true if SDA and SCL are released; false otherwise.
+	 **/
+	static bool recover( ) {
+		pinMode( LICD_SDA_PIN, INPUT_PULLUP );
+		pinMode( LICD_SCL_PIN, INPUT_PULLUP );
+
+		for ( uint8_t clock_id = 0; clock_id < 9 && digitalRead( LICD_SDA_PIN ) == LOW; clock_id++ ) {
+			digitalWrite( LICD_SCL_PIN, LOW );
+			pinMode( LICD_SCL_PIN, OUTPUT );
+			delayMicroseconds( LICD_RECOVERY_HALF_PERIOD );
+			pinMode( LICD_SCL_PIN, INPUT_PULLUP );
+			delayMicroseconds( LICD_RECOVERY_HALF_PERIOD );
+		}
+
+		digitalWrite( LICD_SDA_PIN, LOW );
+		pinMode( LICD_SDA_PIN, OUTPUT );
+		delayMicroseconds( LICD_RECOVERY_HALF_PERIOD );
+		pinMode( LICD_SCL_PIN, INPUT_PULLUP );
+		delayMicroseconds( LICD_RECOVERY_HALF_PERIOD );
+		pinMode( LICD_SDA_PIN, INPUT_PULLUP );
+		delayMicroseconds( LICD_RECOVERY_HALF_PERIOD );
+
+		return isIdle( );
+	};
+
+	/**
+	 * @brief Starts a write to a slave.
+	 *
+	 * @param address I2C address of the slave.
+	 **/
+	static void beginTransmission( const uint8_t address ) {
+		Wire.beginTransmission( address );
+	};
+
+	/**
+	 * @brief Queues one byte of the current write.
+	 *
+	 * @param value Byte to write.
+	 * @return The number of bytes queued.
+	 **/
+	static size_t write( const uint8_t value ) {
+		return Wire.write( value );
+	};
+
+	/**
+	 * @brief Sends the current write.
+	 *
+	 * @param send_stop Whether a STOP condition releases the bus, a repeated start follows otherwise.
+	 * @return The `Wire.endTransmission` status, 0 on success.
+	 **/
+	static uint8_t endTransmission( const bool send_stop ) {
+		return Wire.endTransmission( (uint8_t)send_stop );
+	};
+
+	/**
+	 * @brief Reads bytes from a slave.
+	 *
+	 * @param address I2C address of the slave.
+	 * @param size Number of bytes to read.
+	 * @return The number of bytes received.
+	 **/
+	static uint8_t requestFrom( const uint8_t address, const uint8_t size ) {
+		return Wire.requestFrom( address, size );
+	};
+
+	/**
+	 * @brief Gets the number of received bytes left.
+	 **/
+	static int available( ) {
+		return Wire.available( );
+	};
+
+	/**
+	 * @brief Consumes one received byte.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int read( ) {
+		return Wire.read( );
+	};
+
+	/**
+	 * @brief Gets the next received byte without consuming it.
+	 *
+	 * @return The byte, -1 when none is left.
+	 **/
+	static int peek( ) {
+		return Wire.peek( );
+	};
+
+	/**
+	 * @brief Registers the slave receive callback.
+	 *
+	 * @param handler Function called with the number of bytes received.
+	 **/
+	static void onReceive( void (*handler)( int ) ) {
+		Wire.onReceive( handler );
+	};
+
+	/**
+	 * @brief Registers the slave request callback.
+	 *
+	 * @param handler Function called when the master reads from the slave.
+	 **/
+	static void onRequest( void (*handler)( void ) ) {
+		Wire.onRequest( handler );
+	};
+
+};
+
+#endif
+
+/**
+ * @brief Transport used by the LICD protocol, see `LICD_TRANSPORT`.
+ **/
+typedef LICD_TRANSPORT LicTransport;
+
+#endif /* !LICD_TRANSPORT_H_ */
@@ -4,13 +4,15 @@
  *
  * This header defines the `WireHelper` class, which contains static methods to
  * simplify I2C communication tasks such as reading, writing, and waiting for data
- * availability. The class is designed to work with the Arduino `Wire` library, enabling
- * seamless interaction with I2C slave devices.
+ * availability. The class works on top of `LicTransport`, the Arduino `Wire` library
+ * unless another transport is selected with `LICD_TRANSPORT`.
  *
  * ## Features
  * - Write data to an I2C slave device with type safety.
  * - Read data from an I2C slave device with customizable timeout handling.
- * - Wait for data availability with timeout monitoring.
+ * - Wait for data availability with timeout monitoring, or until a microsecond
+ *   deadline, running the yield hook of `LicYield` meanwhile.
+ * - Write and read sample streams packed with `LicCodec`.
  *
  * ## Usage Example
  * ```
@@ -26,6 +28,11 @@
  *     Serial.println( received_data );
  * }
  *
+ * // Packed sample stream example
+ * int16_t samples[ 16 ];
+ * WireHelper::write_packed( LICD_CODEC_VARINT, samples, 16 );
+ * uint8_t sample_count = WireHelper::read_packed( samples, 16, 100 );
+ *
  * // Wait example
  * if ( WireHelper::wait<int>( 50 ) ) {
  *     Serial.println( "Data available" );
@@ -33,7 +40,7 @@
  * ```
  *
  * ## Notes
- * - Ensure the Wire library is properly initialized before using the helper functions.
+ * - Ensure the transport is properly initialized before using the helper functions.
  * - This header is designed for use in Arduino-compatible environments.
  *
  * @author ALVES Quentin
@@ -44,7 +51,8 @@
 #ifndef _LICD_WIRE_HELPER_H_
 #define _LICD_WIRE_HELPER_H_
 
-#include <Wire.h>
+#include "licd_transport.h"
+#include "licd_codec.h"
 
 /**
  * @class WireHelper
@@ -52,7 +60,7 @@
  * @author : ALVES Quentin
  * 
  * This class encapsulates helper methods to simplify communication with I2C devices.
- * All methods are static and intended for use with the Wire library.
+ * All methods are static and intended for use with `LicTransport`.
  **/
 class WireHelper final {
 
@@ -73,7 +81,7 @@ public:
 		const size_t data_size = sizeof( T ) * count;
 
 		for ( size_t data_offset = 0; data_offset < data_size; data_offset++ )
-			Wire.write( byte_ptr[ data_offset ] );
+			LicTransport::write( byte_ptr[ data_offset ] );
 	};
 
 	/**
@@ -87,19 +95,86 @@ public:
 	 **/
 	template<typename T>
 	static bool read( T* data, const uint32_t count, const uint64_t timeout ) {
-		if ( count == 0 || !wait( timeout ) )
+		return read_until( data, count, LicClock::now( ) + timeout * 1000 );
+	};
+
+	/**
+	 * @brief Reads data from an I2C slave device before a deadline.
+	 * 
+	 * @tparam T : The type of data to be read.
+	 * @param data : Pointer to the memory where the read data will be stored.
+	 * @param count : Number of elements of type T to read (must be >= 1).
+	 * @param deadline : Time of `LicClock::now` (in microseconds) ending the wait for the data.
+	 * @return true if the read operation was successful; false otherwise.
+	 **/
+	template<typename T>
+	static bool read_until( T* data, const uint32_t count, const uint64_t deadline ) {
+		if ( count == 0 || !wait_until<T>( deadline ) )
 			return false;
 
 		const size_t data_size = sizeof( T ) * count;
 		uint8_t* byte_ptr = reinterpret_cast<uint8_t*>( data );
 		size_t data_offset = 0;
 
-		while ( Wire.available( ) && data_offset < data_size )
-			byte_ptr[ data_offset++ ] = (uint8_t)Wire.read( );
+		while ( LicTransport::available( ) && data_offset < data_size )
+			byte_ptr[ data_offset++ ] = (uint8_t)LicTransport::read( );
 
 		return ( data_offset == data_size );
 	};
 
+	/**
+	 * @brief Writes a sample stream packed as a single `LicCodec` frame.
+	 * 
+	 * The frame never exceeds `LICD_FRAME_SIZE` bytes, trailing samples that do
+	 * not fit are dropped and the frame sample count reflects it.
+	 * 
+	 * @tparam T : The integer sample type.
+	 * @param mode : Codec mode used to pack the samples.
+	 * @param samples : Pointer to the samples to write.
+	 * @param count : Number of samples to write.
+	 * @return The number of samples written.
+	 **/
+	template<typename T>
+	static uint8_t write_packed( const LicCodecMode mode, const T* samples, const uint8_t count ) {
+		uint8_t frame[ LICD_FRAME_SIZE ];
+		const uint8_t frame_size = LicCodec::encode( mode, samples, count, frame, LICD_FRAME_SIZE );
+
+		write( frame, frame_size );
+
+		return frame[ 1 ];
+	};
+
+	/**
+	 * @brief Reads a sample stream packed as a single `LicCodec` frame.
+	 * 
+	 * The master must have requested up to `LICD_FRAME_SIZE` bytes, the frame
+	 * header tells how many of them belong to the payload.
+	 * 
+	 * @tparam T : The integer sample type.
+	 * @param samples : Pointer to the memory where decoded samples will be stored.
+	 * @param capacity : Maximum number of samples to decode.
+	 * @param timeout : Maximum time (in milliseconds) to wait for the frame header.
+	 * @return The number of decoded samples, 0 on timeout or malformed frame.
+	 **/
+	template<typename T>
+	static uint8_t read_packed( T* samples, const uint8_t capacity, const uint64_t timeout ) {
+		uint8_t frame[ LICD_FRAME_SIZE ];
+
+		if ( !read( frame, LICD_CODEC_HEADER_SIZE, timeout ) )
+			return 0;
+
+		uint8_t frame_size = LICD_CODEC_HEADER_SIZE;
+		const uint8_t payload_size = frame[ 2 ];
+
+		while ( LicTransport::available( ) && frame_size < LICD_FRAME_SIZE && frame_size < LICD_CODEC_HEADER_SIZE + payload_size )
+			frame[ frame_size++ ] = (uint8_t)LicTransport::read( );
+
+		while ( LicTransport::available( ) )
+			LicTransport::read( );
+
+		return LicCodec::decode( frame, frame_size, samples, capacity );
+	};
+
 public:
 	/**
 	 * @brief Waits for data availability from an I2C slave device.
@@ -110,10 +185,23 @@ public:
 	 **/
 	template<typename T>
 	static bool wait( const uint64_t timeout ) {
-		uint64_t start_time = millis( );
+		return wait_until<T>( LicClock::now( ) + timeout * 1000 );
+	};
 
-		while ( Wire.available( ) < sizeof( T ) ) {
-			if ( millis( ) - start_time > timeout ) {
+	/**
+	 * @brief Waits for data availability from an I2C slave device until a deadline.
+	 * 
+	 * Every turn of the wait runs `LicYield::run`, giving the waiting time to
+	 * the yield hook.
+	 * 
+	 * @tparam T : The type of data to wait for.
+	 * @param deadline : Time of `LicClock::now` (in microseconds) ending the wait.
+	 * @return true if data becomes available before the deadline; false otherwise.
+	 **/
+	template<typename T>
+	static bool wait_until( const uint64_t deadline ) {
+		while ( LicTransport::available( ) < (int)sizeof( T ) ) {
+			if ( !LicYield::run( deadline ) ) {
 				Serial.print( "[ERR] Wire : Waiting for data as timeout or not enough data as been available." );
 
 				return false;